@@ -60,6 +60,8 @@ ie_option (ENABLE_TESTS "unit and functional tests" OFF)
 
 ie_option (ENABLE_GAPI_TESTS "unit tests for GAPI kernels" OFF)
 
+ie_option (ENABLE_BENCHMARKS "microbenchmarks of the internal components, see tests/benchmarks" OFF)
+
 ie_option (GAPI_TEST_PERF "if GAPI unit tests should examine performance" OFF)
 
 
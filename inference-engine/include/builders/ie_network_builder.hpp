@@ -11,10 +11,12 @@
 #include <ie_context.hpp>
 #include <ie_common.h>
 #include <ie_blob.h>
+#include <unordered_map>
 #include <utility>
 #include <memory>
 #include <string>
 #include <vector>
+#include <list>
 #include <map>
 
 namespace InferenceEngine {
@@ -67,6 +69,12 @@ public:
      * @param network constant reference to INetwork object
      */
     Network(const Context& ieContext, const INetwork& network);
+    /**
+     * @brief The copy constructor
+     *
+     * @param network Network builder to copy
+     */
+    Network(const Network& network);
 
     /**
      * @brief Virtual destructor
@@ -169,7 +177,22 @@ private:
     const size_t version;
     std::string name;
     std::vector<Layer> layers;
-    std::vector<Connection> connections;
+    std::list<Connection> connections;
+
+    // Positions of the layers by id and layer ids by name, getLayers() gives away the layers
+    // so these are checked and rebuilt on use. All ids below freeId are used.
+    mutable std::unordered_map<idx_t, size_t> layerIndex;
+    mutable std::unordered_map<std::string, idx_t> nameIndex;
+    mutable idx_t freeId = 0;
+    mutable size_t indexedLayers = 0;
+    // Set once a mutable layer is given away, the names missing in nameIndex are then looked up in the layers
+    bool layersGivenAway = false;
+    // Connections of every layer in the order they were added
+    std::unordered_map<idx_t, std::vector<std::list<Connection>::iterator>> connectionIndex;
+
+    void indexLayers(bool force = false) const;
+    const Layer* findLayer(idx_t layerId) const;
+    bool isNameUsed(const std::string& layerName) const;
 };
 
 /**
@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 
@@ -79,6 +80,17 @@ public:
         CALL_STATUS_FNC(SetBlob, name.c_str(), data);
     }
 
+    /**
+     * @brief Sets a source frame whose regions fill the consecutive batch slots of the input during pre-processing
+     * @note: The input must have a resize algorithm set, the number of regions must be equal to its batch size
+     * @param name Name of the input
+     * @param data Reference to the source frame blob
+     * @param rois Regions of the frame, one per batch slot of the input
+     */
+    void SetBlob(const std::string &name, const Blob::Ptr &data, const std::vector<ROI> &rois) {
+        CALL_STATUS_FNC(SetBlobROIs, name.c_str(), data, rois);
+    }
+
     /**
      * @brief Wraps original method
      * IInferRequest::GetBlob
@@ -0,0 +1,338 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the driver that scores many frame sequences (utterances) concurrently
+ * over the infer requests of loaded networks
+ * @file ie_streaming_driver.hpp
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpp/ie_executable_network.hpp"
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Feature frames of one utterance and scores produced for them
+ */
+struct StreamingUtterance {
+    /** position of the utterance in the input, completed utterances are reported in this order */
+    size_t index = 0;
+    std::string name;
+    uint32_t numFrames = 0;
+    uint32_t numFrameElements = 0;
+    /** numFrames x numFrameElements row major features */
+    std::vector<float> features;
+    /** numFrames x numScoresPerFrame row major scores, filled by the driver */
+    std::vector<float> scores;
+    uint32_t numScoresPerFrame = 0;
+};
+
+/**
+ * @brief Aggregate throughput of a StreamingDriver::run() call
+ */
+struct StreamingStatistics {
+    size_t utterances = 0;
+    size_t frames = 0;
+    /** number of propagate calls, each one covers up to batch size frames */
+    size_t inferCalls = 0;
+    /** batch rows that were filled with zeroes because no frames were ready */
+    size_t paddedFrames = 0;
+    double totalTimeMs = 0.0;
+
+    double framesPerSecond() const {
+        return totalTimeMs > 0.0 ? 1000.0 * frames / totalTimeMs : 0.0;
+    }
+
+    /** @brief Processing time to audio duration ratio, below 1.0 is faster than real time */
+    double realTimeFactor(double frameShiftMs = 10.0) const {
+        return frames ? totalTimeMs / (frames * frameShiftMs) : 0.0;
+    }
+};
+
+/**
+ * @brief Scores a stream of utterances over a set of infer requests.
+ *
+ * Stateless models: all requests belong to one executable network (one GNA request slot per
+ * request) and every batch is filled with frames of as many utterances as needed, so
+ * a propagate never runs half empty while there are frames left in the stream.
+ *
+ * Models with memory layers: the recurrent state is owned by the executable network, so
+ * every network gets a single request and scores one utterance at a time with its frames
+ * in order. The state is reset between utterances. Utterances are interleaved across
+ * networks, so several of them are in flight at once.
+ */
+class StreamingDriver {
+public:
+    /** returns false when there are no more utterances */
+    using Source = std::function<bool(StreamingUtterance &)>;
+    /** receives completed utterances in input order */
+    using Sink = std::function<void(StreamingUtterance &)>;
+
+    /**
+     * @param networks loaded networks with a single input and a single FP32 output
+     * @param requestsPerNetwork concurrent requests per network, ignored for stateful models
+     */
+    StreamingDriver(const std::vector<ExecutableNetwork> &networks, size_t requestsPerNetwork) {
+        if (networks.empty()) {
+            THROW_IE_EXCEPTION << "StreamingDriver requires at least one network";
+        }
+        auto first = networks.front();
+        if (first.GetInputsInfo().size() != 1 || first.GetOutputsInfo().size() != 1) {
+            THROW_IE_EXCEPTION << "StreamingDriver supports only topologies with 1 input and 1 output";
+        }
+        _inputName = first.GetInputsInfo().begin()->first;
+        _outputName = first.GetOutputsInfo().begin()->first;
+        _stateful = !first.QueryState().empty();
+
+        if (!_stateful && networks.size() > 1) {
+            THROW_IE_EXCEPTION << "Stateless models are scored with several requests of a single network";
+        }
+
+        size_t requests = _stateful ? 1 : std::max<size_t>(requestsPerNetwork, 1);
+        for (auto network : networks) {
+            _lanes.emplace_back(new Lane());
+            _lanes.back()->network = network;
+            for (size_t i = 0; i < requests; i++) {
+                _lanes.back()->requests.emplace_back(new Request(network.CreateInferRequest()));
+            }
+        }
+
+        auto &request = _lanes.front()->requests.front()->request;
+        _inputFrameSize = 0;
+        _batchSize = request.GetBlob(_inputName)->getTensorDesc().getDims()[0];
+        _numScoresPerFrame = request.GetBlob(_outputName)->size() / _batchSize;
+    }
+
+    /** @brief whether the model has memory layers and utterances are pinned to networks */
+    bool stateful() const {
+        return _stateful;
+    }
+
+    size_t batchSize() const {
+        return _batchSize;
+    }
+
+    /**
+     * @brief Scores all utterances of the source. Up to maxActive utterances are kept
+     * in memory at once, 0 means twice the number of requests.
+     */
+    StreamingStatistics run(const Source &source, const Sink &sink, size_t maxActive = 0) {
+        _source = source;
+        _sink = sink;
+        _stats = StreamingStatistics();
+        _exhausted = false;
+        _nextIndex = 0;
+        _maxActive = maxActive ? maxActive : 2 * requestsCount();
+
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (;;) {
+            for (auto &lane : _lanes) {
+                for (auto &request : lane->requests) {
+                    if (!request->busy && !submit(*lane, *request)) break;
+                }
+            }
+            if (_inflight.empty()) break;
+
+            // requests of one model take the same time, so waiting the oldest one keeps all of them busy
+            auto lane = _inflight.front().first;
+            auto request = _inflight.front().second;
+            _inflight.pop_front();
+            complete(*lane, *request);
+        }
+        _stats.totalTimeMs = std::chrono::duration<double, std::milli>(
+                std::chrono::high_resolution_clock::now() - t0).count();
+
+        if (!_active.empty() || !_completed.empty()) {
+            THROW_IE_EXCEPTION << "StreamingDriver finished with unscored utterances";
+        }
+        return _stats;
+    }
+
+private:
+    struct Active {
+        StreamingUtterance utterance;
+        uint32_t submitted = 0;
+        uint32_t scored = 0;
+    };
+    using ActivePtr = std::shared_ptr<Active>;
+
+    struct Request {
+        explicit Request(InferRequest request) : request(request) {}
+        InferRequest request;
+        bool busy = false;
+        /** utterance and its frame for every filled batch row */
+        std::vector<std::pair<ActivePtr, uint32_t>> rows;
+    };
+
+    struct Lane {
+        ExecutableNetwork network;
+        std::vector<std::unique_ptr<Request>> requests;
+        /** utterance pinned to this network, stateful models only */
+        ActivePtr current;
+    };
+
+    size_t requestsCount() const {
+        size_t count = 0;
+        for (auto &lane : _lanes) count += lane->requests.size();
+        return count;
+    }
+
+    ActivePtr pull() {
+        if (_exhausted) return nullptr;
+        auto active = std::make_shared<Active>();
+        if (!_source(active->utterance)) {
+            _exhausted = true;
+            return nullptr;
+        }
+        auto &utt = active->utterance;
+        utt.index = _nextIndex++;
+        if (!_inputFrameSize) {
+            _inputFrameSize = utt.numFrameElements;
+            auto &request = _lanes.front()->requests.front()->request;
+            if (request.GetBlob(_inputName)->size() != _inputFrameSize * _batchSize) {
+                THROW_IE_EXCEPTION << "network input size(" << request.GetBlob(_inputName)->size()
+                                   << ") mismatch to utterance frame size (" << _inputFrameSize * _batchSize << ")";
+            }
+        }
+        if (utt.numFrameElements != _inputFrameSize || utt.features.size() < utt.numFrames * _inputFrameSize) {
+            THROW_IE_EXCEPTION << "utterance " << utt.name << " has unexpected frame size";
+        }
+        utt.numScoresPerFrame = static_cast<uint32_t>(_numScoresPerFrame);
+        utt.scores.assign(utt.numFrames * _numScoresPerFrame, 0.0f);
+        _active.push_back(active);
+        if (utt.numFrames == 0) {
+            retire(active);
+        }
+        return active;
+    }
+
+    /** @brief next utterance with frames left to submit for a stateless model */
+    ActivePtr nextPending() {
+        for (auto &active : _active) {
+            if (active->submitted < active->utterance.numFrames) return active;
+        }
+        while (_active.size() < _maxActive) {
+            auto active = pull();
+            if (!active) break;
+            if (active->utterance.numFrames) return active;
+        }
+        return nullptr;
+    }
+
+    /** @brief fills the batch and starts the request, returns false if there is nothing to submit */
+    bool submit(Lane &lane, Request &request) {
+        request.rows.clear();
+        if (_stateful) {
+            if (lane.current && lane.current->submitted == lane.current->utterance.numFrames) {
+                return false;  // its last frames are in flight, next utterance must not see this state
+            }
+            while (!lane.current && _active.size() < _maxActive) {
+                lane.current = pull();
+                if (!lane.current) return false;
+                if (!lane.current->utterance.numFrames) lane.current = nullptr;
+            }
+            if (!lane.current) return false;
+            auto &active = lane.current;
+            while (request.rows.size() < _batchSize && active->submitted < active->utterance.numFrames) {
+                request.rows.emplace_back(active, active->submitted++);
+            }
+        } else {
+            while (request.rows.size() < _batchSize) {
+                auto active = nextPending();
+                if (!active) break;
+                while (request.rows.size() < _batchSize && active->submitted < active->utterance.numFrames) {
+                    request.rows.emplace_back(active, active->submitted++);
+                }
+            }
+            if (request.rows.empty()) return false;
+        }
+
+        auto input = request.request.GetBlob(_inputName);
+        auto dst = input->buffer().as<float *>();
+        for (auto &row : request.rows) {
+            std::memcpy(dst, &row.first->utterance.features[row.second * _inputFrameSize],
+                        _inputFrameSize * sizeof(float));
+            dst += _inputFrameSize;
+        }
+        std::fill(dst, input->buffer().as<float *>() + input->size(), 0.0f);
+
+        request.request.StartAsync();
+        request.busy = true;
+        _inflight.emplace_back(&lane, &request);
+        _stats.inferCalls++;
+        _stats.paddedFrames += _batchSize - request.rows.size();
+        return true;
+    }
+
+    void complete(Lane &lane, Request &request) {
+        request.request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        request.busy = false;
+
+        auto src = request.request.GetBlob(_outputName)->buffer().as<const float *>();
+        for (auto &row : request.rows) {
+            auto &active = row.first;
+            std::memcpy(&active->utterance.scores[row.second * _numScoresPerFrame], src,
+                        _numScoresPerFrame * sizeof(float));
+            src += _numScoresPerFrame;
+            if (++active->scored == active->utterance.numFrames) {
+                if (_stateful) {
+                    for (auto &&state : lane.network.QueryState()) {
+                        state.Reset();
+                    }
+                    lane.current = nullptr;
+                }
+                retire(active);
+            }
+        }
+        request.rows.clear();
+    }
+
+    /** @brief passes completed utterances to the sink in input order */
+    void retire(const ActivePtr &active) {
+        _active.erase(std::find(_active.begin(), _active.end(), active));
+        _stats.utterances++;
+        _stats.frames += active->utterance.numFrames;
+        _completed[active->utterance.index] = active;
+
+        size_t next = _stats.utterances - _completed.size();
+        for (auto it = _completed.begin(); it != _completed.end() && it->first == next; next++) {
+            _sink(it->second->utterance);
+            it = _completed.erase(it);
+        }
+    }
+
+    std::vector<std::unique_ptr<Lane>> _lanes;
+    std::deque<std::pair<Lane *, Request *>> _inflight;
+    std::vector<ActivePtr> _active;
+    std::map<size_t, ActivePtr> _completed;
+
+    std::string _inputName;
+    std::string _outputName;
+    bool _stateful = false;
+    size_t _batchSize = 1;
+    size_t _inputFrameSize = 0;
+    size_t _numScoresPerFrame = 0;
+
+    Source _source;
+    Sink _sink;
+    size_t _maxActive = 0;
+    size_t _nextIndex = 0;
+    bool _exhausted = false;
+    StreamingStatistics _stats;
+};
+
+}  // namespace InferenceEngine
@@ -93,6 +93,9 @@ private:
         return true;
     }
 
+    /**
+     * Iterative DFS, so the depth of the network is not limited by the stack
+     */
     template<class T>
     inline bool DFS(std::unordered_map<idx_t, bool> &visited,
                     const std::shared_ptr<LT> &layer,
@@ -102,12 +105,31 @@ private:
             return true;
         }
 
-        if (visitBefore)
-            visit(layer);
-
-        visited[layer->getId()] = false;
-        for (const auto &connection : network->getLayerConnections(layer->getId())) {
-            if (connection.to().layerId() == layer->getId()) {
+        struct Frame {
+            std::shared_ptr<LT> layer;
+            std::vector<Connection> connections;
+            size_t next;
+        };
+        std::vector<Frame> stack;
+        auto enter = [&](const std::shared_ptr<LT> &current) {
+            if (visitBefore)
+                visit(current);
+            visited[current->getId()] = false;
+            stack.push_back({current, network->getLayerConnections(current->getId()), 0});
+        };
+
+        enter(layer);
+        while (!stack.empty()) {
+            Frame &frame = stack.back();
+            if (frame.next == frame.connections.size()) {
+                if (!visitBefore)
+                    visit(frame.layer);
+                visited[frame.layer->getId()] = true;
+                stack.pop_back();
+                continue;
+            }
+            const Connection connection = frame.connections[frame.next++];
+            if (connection.to().layerId() == frame.layer->getId()) {
                 continue;
             }
             const auto outLayer = network->getLayer(connection.to().layerId());
@@ -121,14 +143,8 @@ private:
                 }
                 continue;
             }
-
-            if (!DFS(visited, outLayer, visit, visitBefore)) {
-                return false;
-            }
+            enter(outLayer);
         }
-        if (!visitBefore)
-            visit(layer);
-        visited[layer->getId()] = true;
         return true;
     }
 };
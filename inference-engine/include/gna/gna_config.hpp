@@ -74,5 +74,12 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
+
+/**
+* @brief if enabled, read only part of a model imported from file is used directly from memory mapped file,
+* only RW part is copied into GNA memory. Supported for models exported with format version 1.2 and newer,
+* and requires GNA library which accepts weights outside of memory allocated with GNAAlloc(), default value is NO
+*/
+DECLARE_GNA_CONFIG_KEY(IMPORT_ZERO_COPY);
 }  // namespace GNAConfigParams
 }  // namespace InferenceEngine
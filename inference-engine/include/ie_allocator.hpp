@@ -11,6 +11,8 @@
 #include <details/ie_irelease.hpp>
 #include <ie_api.h>
 
+#include <cstddef>
+
 namespace InferenceEngine {
 
 /**
@@ -62,4 +64,42 @@ public:
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept;
 
+/**
+ * @struct AllocatorStatistics
+ * @brief Represents usage counters of the memory pool behind the default allocator.
+ */
+struct AllocatorStatistics {
+    /**
+     * @brief Number of bytes currently allocated by blobs
+     */
+    size_t bytesLive = 0;
+    /**
+     * @brief Maximal value of bytesLive observed since the process start
+     */
+    size_t bytesPeak = 0;
+    /**
+     * @brief Number of bytes kept in the pool for reuse
+     */
+    size_t bytesCached = 0;
+    /**
+     * @brief Total number of allocation requests
+     */
+    size_t allocations = 0;
+    /**
+     * @brief Number of allocation requests served from the pool without a system call
+     */
+    size_t poolHits = 0;
+};
+
+/**
+ * @brief Collects usage counters of the default allocator.
+ * @param stats Structure to be filled with the current counters
+ */
+INFERENCE_ENGINE_API(void) GetDefaultAllocatorStatistics(InferenceEngine::AllocatorStatistics *stats) noexcept;
+
+/**
+ * @brief Returns all memory cached by the default allocator back to the system.
+ */
+INFERENCE_ENGINE_API(void) ReleaseDefaultAllocatorCache() noexcept;
+
 }  // namespace InferenceEngine
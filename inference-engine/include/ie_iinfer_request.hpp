@@ -14,6 +14,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <details/ie_irelease.hpp>
 
 namespace InferenceEngine {
@@ -132,6 +133,19 @@ public:
     * @return Enumeration of the resulted action: OK (0) for success
     */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets a source frame whose regions are cropped, resized and placed to the consecutive batch slots of
+    * the input during pre-processing, so one request classifies all the regions of the frame.
+    * @note The input must have a resize algorithm set, the number of regions must be equal to its batch size.
+    * @param name Name of the input
+    * @param data Reference to the source frame blob with batch 1
+    * @param rois Regions of the frame, the i-th one fills the i-th batch slot
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success
+    */
+    virtual InferenceEngine::StatusCode SetBlobROIs(const char *name, const Blob::Ptr &data, const std::vector<ROI> &rois,
+                                                    ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -58,12 +58,58 @@ DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 * - KEY_CPU_THROUGHPUT_AUTO creates bare minimum of streams to improve the performance,
 *   this is the most portable option if you have no insights into how many cores you target machine will have
 *   (and what is the optimal number of streams)
+* - KEY_CPU_THROUGHPUT_TUNE benchmarks a few streams/threads splits on synthetic inputs when loading the network
+*   and picks the one with the best throughput (under the KEY_CPU_THROUGHPUT_LATENCY_CAP, if specified),
+*   the decision is cached per model and CPU, the model is identified by a hash of its topology and all weights,
+*   so hashing takes time proportional to the weights size and a retrained model is tuned anew
 * - finally, specifying the positive integer value creates the requested number of streams
 */
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
+DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_TUNE);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+* @brief The maximal mean latency (in milliseconds) of a request allowed for the CPU_THROUGHPUT_TUNE mode.
+* 0 (default) means that the streams/threads split is picked for the best throughput regardless of the latency
+*/
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_LATENCY_CAP);
+
+/**
+* @brief The file that keeps the decisions of the CPU_THROUGHPUT_TUNE mode between the runs.
+* Along with the decisions the file lists the throughput and latency measured for every split.
+* Empty string (default) means that the decisions are cached only within the process
+*/
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_TUNE_CACHE);
+
+/**
+* @brief The name for the option of executing independent branches of the network concurrently.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* The independent layers share the threads of the stream, which helps wide topologies
+* (e.g. Inception-like) with many small layers that do not saturate the cores individually.
+* Pays off with the TBB threading, with OpenMP the layers of the branches run single-threaded.
+*/
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+* @brief The name for the option of executing the batch of a request by parts (micro-batches).
+* The whole network is executed for a micro-batch before the next one, so the activations stay in the cache.
+* The graph is not split into separate chains, every micro-batch runs all the layers with the same primitives.
+* This option should be used with values: PluginConfigParams::NO (default),
+* PluginConfigParams::YES (the micro-batch size is chosen by the L2 cache size) or a positive micro-batch size.
+* Ignored for the topologies that don't support dynamic batch.
+*/
+DECLARE_CONFIG_KEY(CPU_MICRO_BATCH);
+
+/**
+* @brief The name for the option of executing pruned FullyConnected and 1x1 Convolution layers by sparse kernels.
+* The weights of a layer are compressed into blocks of output channels when the share of the blocks with a non-zero
+* value is below a threshold. This option should be used with values: PluginConfigParams::NO (default),
+* PluginConfigParams::YES (the threshold is estimated for the shape of a layer) or a density threshold in (0, 1].
+*/
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS);
+
 
 /**
 * @brief The name for setting performance counters option.
@@ -62,6 +62,10 @@ static const char batch_size_message[] = "Optional. Batch size value. If not spe
 static const char infer_threads_pinning_message[] = "Optional. Enable (\"YES\" is default value) or disable (\"NO\")" \
                                                   "CPU threads pinning for CPU-involved inference.";
 
+// @brief message for CPU micro-batching option
+static const char infer_micro_batch_message[] = "Optional. Execute the batch by micro-batches of the given size, " \
+                                                "\"YES\" picks the size by the cache size, \"NO\" (default) disables it.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -107,6 +111,9 @@ DEFINE_int32(b, 0, batch_size_message);
 
 // @brief Enable plugin messages
 DEFINE_string(pin, "YES", infer_threads_pinning_message);
+
+/// @brief Micro-batching of the CPU inference (compare across -b values)
+DEFINE_string(micro_batch, "NO", infer_micro_batch_message);
 /**
 * @brief This function show a help message
 */
@@ -130,4 +137,5 @@ static void showUsage() {
     std::cout << "    Some CPU-specific performance options" << std::endl;
     std::cout << "    -nthreads \"<integer>\"   " << infer_num_threads_message << std::endl;
     std::cout << "    -pin \"YES\"/\"NO\"       " << infer_threads_pinning_message << std::endl;
+    std::cout << "    -micro_batch \"<integer>\"/\"YES\"/\"NO\" " << infer_micro_batch_message << std::endl;
 }
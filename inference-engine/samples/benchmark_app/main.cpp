@@ -192,6 +192,8 @@ int main(int argc, char *argv[]) {
                 networkConfig[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(FLAGS_nthreads);
             // pin threads for CPU portion of inference
             networkConfig[PluginConfigParams::KEY_CPU_BIND_THREAD] = FLAGS_pin;
+            // execute large batches by cache-sized parts
+            networkConfig[PluginConfigParams::KEY_CPU_MICRO_BATCH] = FLAGS_micro_batch;
             // for pure CPU execution, more throughput-oriented execution via streams
             if (FLAGS_api == "async" && FLAGS_d == "CPU")
                 networkConfig[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(FLAGS_nireq);
@@ -25,6 +25,7 @@
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <samples/args_helper.hpp>
+#include <cpp/ie_streaming_driver.hpp>
 
 #ifndef ALIGN
 #define ALIGN(memSize, pad)   ((static_cast<int>((memSize) + pad - 1) / pad) * pad)
@@ -386,6 +387,84 @@ void sumPerformanceCounters(std::map<std::string, InferenceEngine::InferenceEngi
     }
 }
 
+/**
+ * @brief Scores all utterances of the input ark file with the streaming driver and reports aggregate throughput
+ */
+void ScoreUtterancesStreaming(const std::vector<ExecutableNetwork> &networks, const std::string &inputArkName) {
+    StreamingDriver driver(networks, static_cast<size_t>(FLAGS_nthreads));
+    slog::info << "Streaming " << (driver.stateful() ? "stateful model over " + std::to_string(networks.size()) +
+                                   " network(s)" : "stateless model, batches mix utterances") << slog::endl;
+
+    uint32_t numUtterances(0), numBytes(0);
+    GetKaldiArkInfo(inputArkName.c_str(), 0, &numUtterances, &numBytes);
+
+    uint32_t nextUtterance = 0;
+    std::vector<uint8_t> buffer;
+    auto source = [&](StreamingUtterance &utt) {
+        if (nextUtterance == numUtterances) {
+            return false;
+        }
+        uint32_t numBytesPerElement(0);
+        GetKaldiArkInfo(inputArkName.c_str(), nextUtterance, nullptr, &numBytes);
+        buffer.resize(numBytes);
+        LoadKaldiArkArray(inputArkName.c_str(), nextUtterance, utt.name, buffer,
+                          &utt.numFrames, &utt.numFrameElements, &numBytesPerElement);
+        if (numBytesPerElement != sizeof(float) ||
+            buffer.size() < static_cast<size_t>(utt.numFrames) * utt.numFrameElements * sizeof(float)) {
+            throw std::logic_error("utterance " + utt.name + " does not contain FP32 features");
+        }
+        utt.features.resize(utt.numFrames * utt.numFrameElements);
+        std::memcpy(utt.features.data(), buffer.data(), utt.features.size() * sizeof(float));
+        nextUtterance++;
+        return true;
+    };
+
+    std::vector<uint8_t> ptrReferenceScores;
+    auto sink = [&](StreamingUtterance &utt) {
+        if (!FLAGS_o.empty()) {
+            SaveKaldiArkArray(FLAGS_o.c_str(), utt.index != 0, utt.name, utt.scores.data(),
+                              utt.numFrames, utt.numScoresPerFrame);
+        }
+        std::cout << "Utterance " << utt.index << ": " << utt.name << ", " << utt.numFrames << " frames" << std::endl;
+        if (!FLAGS_r.empty()) {
+            std::string refUtteranceName;
+            uint32_t n(0), numBytesReference(0), numFramesReference(0), numFrameElementsReference(0),
+                    numBytesPerElementReference(0);
+            GetKaldiArkInfo(FLAGS_r.c_str(), static_cast<uint32_t>(utt.index), &n, &numBytesReference);
+            ptrReferenceScores.resize(numBytesReference);
+            LoadKaldiArkArray(FLAGS_r.c_str(), static_cast<uint32_t>(utt.index), refUtteranceName, ptrReferenceScores,
+                              &numFramesReference, &numFrameElementsReference, &numBytesPerElementReference);
+            if (numFramesReference != utt.numFrames || numFrameElementsReference != utt.numScoresPerFrame) {
+                throw std::logic_error("reference scores of utterance " + utt.name + " have unexpected size");
+            }
+
+            score_error_t frameError, totalError;
+            ClearScoreError(&totalError);
+            totalError.threshold = frameError.threshold = MAX_SCORE_DIFFERENCE;
+            for (uint32_t frame = 0; frame < utt.numFrames; frame++) {
+                CompareScores(&utt.scores[frame * utt.numScoresPerFrame],
+                              &ptrReferenceScores[frame * numFrameElementsReference * numBytesPerElementReference],
+                              &frameError,
+                              1,
+                              numFrameElementsReference);
+                UpdateScoreError(&frameError, &totalError);
+            }
+            printReferenceCompareResults(totalError, utt.numFrames, std::cout);
+        }
+    };
+
+    auto stats = driver.run(source, sink);
+
+    /** Show aggregate performance results **/
+    std::cout << "Utterances scored:\t\t\t" << stats.utterances << std::endl;
+    std::cout << "Frames scored:\t\t\t\t" << stats.frames << " frames" << std::endl;
+    std::cout << "Infer calls:\t\t\t\t" << stats.inferCalls << " (" << stats.paddedFrames
+              << " padded frames, batch size " << driver.batchSize() << ")" << std::endl;
+    std::cout << "Total time in Infer (HW and SW):\t" << stats.totalTimeMs << " ms" << std::endl;
+    std::cout << "Throughput:\t\t\t\t" << stats.framesPerSecond() << " frames/s" << std::endl;
+    std::cout << "Real-time factor (10 ms frames):\t" << stats.realTimeFactor() << std::endl << std::endl;
+}
+
 bool ParseAndCheckCommandLine(int argc, char *argv[]) {
     // ---------------------------Parsing and validation of input args--------------------------------------
     slog::info << "Parsing input parameters" << slog::endl;
@@ -447,6 +526,10 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Not valid value for 'nthreads' argument. It should be > 0 ");
     }
 
+    if (FLAGS_stream && FLAGS_pc) {
+        throw std::logic_error("Per-layer performance report is not supported in streaming mode (-stream).");
+    }
+
     return true;
 }
 
@@ -566,15 +649,16 @@ int main(int argc, char *argv[]) {
         if (useGna) {
             genericPluginConfig.insert(std::begin(gnaPluginConfig), std::end(gnaPluginConfig));
         }
-        auto t0 = Time::now();
-        ExecutableNetwork executableNet;
-        if (!FLAGS_m.empty()) {
-            slog::info << "Loading model to the plugin" << slog::endl;
-            executableNet = plugin.LoadNetwork(netBuilder.getNetwork(), genericPluginConfig);
-        } else {
+        auto loadNetwork = [&]() -> ExecutableNetwork {
+            if (!FLAGS_m.empty()) {
+                slog::info << "Loading model to the plugin" << slog::endl;
+                return plugin.LoadNetwork(netBuilder.getNetwork(), genericPluginConfig);
+            }
             slog::info << "Importing model to the plugin" << slog::endl;
-            executableNet = plugin.ImportNetwork(FLAGS_rg.c_str(), genericPluginConfig);
-        }
+            return plugin.ImportNetwork(FLAGS_rg.c_str(), genericPluginConfig);
+        };
+        auto t0 = Time::now();
+        ExecutableNetwork executableNet = loadNetwork();
 
 
         ms loadTime = std::chrono::duration_cast<ms>(Time::now() - t0);
@@ -595,6 +679,24 @@ int main(int argc, char *argv[]) {
             return 0;
         }
 
+        if (FLAGS_stream) {
+            std::vector<ExecutableNetwork> networks = {executableNet};
+            if (!executableNet.QueryState().empty() && FLAGS_nthreads > 1) {
+                /** memory layers keep a single state per network, so every concurrent utterance needs its own copy **/
+                slog::info << "Model has memory layers, loading " << FLAGS_nthreads << " instances of it" << slog::endl;
+                if (useGna) {
+                    genericPluginConfig[GNAConfigParams::KEY_GNA_LIB_N_THREADS] = "1";
+                }
+                networks.clear();
+                for (int i = 0; i < FLAGS_nthreads; i++) {
+                    networks.push_back(loadNetwork());
+                }
+            }
+            ScoreUtterancesStreaming(networks, inputArkName);
+            slog::info << "Execution successful" << slog::endl;
+            return 0;
+        }
+
         std::vector<std::pair<InferRequest, size_t>> inferRequests(FLAGS_nthreads);
         for (auto& inferRequest : inferRequests) {
             inferRequest = {executableNet.CreateInferRequest(), -1};
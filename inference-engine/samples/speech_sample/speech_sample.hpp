@@ -74,6 +74,11 @@ static const char batch_size_message[] = "Batch size 1-8 (default 1)";
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for concurrent async" \
 " inference requests on the GNA.";
 
+/// @brief message for streaming mode
+static const char streaming_message[] = "Optional. Score all utterances concurrently: frames of different utterances share" \
+" a batch for models without memory layers, models with memory layers are loaded -nthreads times" \
+" and every instance scores its own utterance.";
+
 /// \brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -133,6 +138,9 @@ DEFINE_int32(bs, 1, batch_size_message);
 /// @brief Number of threads to use for inference on the CPU (also affects Hetero cases)
 DEFINE_int32(nthreads, 1, infer_num_threads_message);
 
+/// @brief Score utterances with the streaming driver
+DEFINE_bool(stream, false, streaming_message);
+
 /**
  * \brief This function show a help message
  */
@@ -159,5 +167,6 @@ static void showUsage() {
     std::cout << "    -wg \"<path>\"            " << write_gna_model_message << std::endl;
     std::cout << "    -we \"<path>\"            " << write_embedded_model_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"   " << infer_num_threads_message << std::endl;
+    std::cout << "    -stream                   " << streaming_message << std::endl;
 }
 
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <utility>
 #include <functional>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -55,33 +56,40 @@ public:
         float* dst_data = outputs[0]->buffer();
 
         int num = count(in_dims) / dim;
-        std::vector<std::pair<float, int> > src_vector(dim);
 
-        for (int i = 0; i < num; ++i) {
-            for (int j = 0; j < dim; ++j) {
-                src_vector[j] = std::make_pair(
-                        src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
-            }
-
-            std::partial_sort(src_vector.begin(), src_vector.begin() + top_k_,
-                              src_vector.end(), std::greater<std::pair<float, int> >());
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            int start = 0, end = 0;
+            splitter(num, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            std::vector<std::pair<float, int> > src_vector(dim);
+            for (int i = start; i < end; ++i) {
+                for (int j = 0; j < dim; ++j) {
+                    src_vector[j] = std::make_pair(
+                            src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
+                }
 
-            for (int j = 0; j < top_k_; ++j) {
-                if (out_max_val_) {
-                    if (has_axis_) {
-                        // Produces max_val per axis
-                        dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].first;
+                std::partial_sort(src_vector.begin(), src_vector.begin() + top_k_,
+                                  src_vector.end(), std::greater<std::pair<float, int> >());
+
+                for (int j = 0; j < top_k_; ++j) {
+                    if (out_max_val_) {
+                        if (has_axis_) {
+                            // Produces max_val per axis
+                            dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].first;
+                        } else {
+                            // Produces max_ind and max_val
+                            dst_data[2 * i * top_k_ + j] = src_vector[j].second;
+                            dst_data[2 * i * top_k_ + top_k_ + j] = src_vector[j].first;
+                        }
                     } else {
-                        // Produces max_ind and max_val
-                        dst_data[2 * i * top_k_ + j] = src_vector[j].second;
-                        dst_data[2 * i * top_k_ + top_k_ + j] = src_vector[j].first;
+                        // Produces max_ind per axis
+                        dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].second;
                     }
-                } else {
-                    // Produces max_ind per axis
-                    dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].second;
                 }
             }
-        }
+        });
 
         return OK;
     }
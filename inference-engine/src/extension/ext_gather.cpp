@@ -11,6 +11,10 @@
 #include <cassert>
 #include <algorithm>
 #include <limits>
+#include <cstring>
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 #include "ie_parallel.hpp"
 #include "simple_copy.h"
 
@@ -24,6 +28,58 @@ inline void clipping(int *idx, const int min, const int max) {
     return;
 }
 
+//  Lookups issued ahead of the one being copied, enough to hide DRAM latency of random rows
+static const size_t prefetch_distance = 8;
+
+inline void prefetchRow(const void *row, size_t bytes) {
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const char *p = reinterpret_cast<const char *>(row);
+    for (size_t offset = 0; offset < bytes; offset += 64)
+        _mm_prefetch(p + offset, _MM_HINT_T0);
+#endif
+}
+
+//  Element of a half precision dictionary
+struct fp16_t {
+    uint16_t bits;
+};
+
+inline float toFloat(float v) { return v; }
+inline float toFloat(int8_t v) { return static_cast<float>(v); }
+inline float toFloat(uint8_t v) { return static_cast<float>(v); }
+inline float toFloat(fp16_t v) {
+    uint32_t sign = static_cast<uint32_t>(v.bits & 0x8000u) << 16;
+    uint32_t exponent = (v.bits >> 10) & 0x1fu;
+    uint32_t mantissa = v.bits & 0x3ffu;
+    uint32_t bits;
+    if (exponent == 0x1fu) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        //  Denormal half is a normal float
+        exponent = 113;
+        while (!(mantissa & 0x400u)) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+template <typename dict_t, bool accumulate>
+inline void decodeRow(float *dst, const dict_t *row, size_t length, float scale, float shift) {
+    for (size_t k = 0; k < length; k++) {
+        float v = toFloat(row[k]) * scale + shift;
+        dst[k] = accumulate ? dst[k] + v : v;
+    }
+}
+
 class GatherImpl: public ILayerExecImpl {
 public:
     StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
@@ -42,6 +98,12 @@ public:
             }
         }
 
+        //  Embedding lookups are configured with dense plain layouts only
+        if (embedding) {
+            withHoles = NONE;
+            return OK;
+        }
+
         //  Check for holes in tensors
         SizeVector dictionary_dims = config.inConfs[GATHER_DICTIONARY].desc.getDims();
         SizeVector indexes_dims = config.inConfs[GATHER_INDEXES].desc.getDims();
@@ -85,9 +147,26 @@ public:
 
     explicit GatherImpl(const CNNLayer* layer) {
         try {
-            if (layer->insData.size() != 2 || layer->outData.empty())
+            //  The dictionary may be a layer blob instead of the first input. It is a view of the
+            //  network weights, so a weights blob over a memory mapped file is never copied.
+            auto dictionaryBlob = layer->blobs.find("dictionary");
+            if (dictionaryBlob != layer->blobs.end()) {
+                embeddedDictionary = dictionaryBlob->second;
+                GATHER_INDEXES = 0;
+            }
+
+            if (layer->insData.size() != (embeddedDictionary ? 1 : 2) || layer->outData.empty())
                 THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
 
+            std::string reduceMode = layer->GetParamAsString("reduce", "none");
+            if (reduceMode == "sum")
+                reduce = Reduce::SUM;
+            else if (reduceMode == "mean")
+                reduce = Reduce::MEAN;
+            else if (reduceMode != "none")
+                THROW_IE_EXCEPTION << "Unsupported reduce mode " << reduceMode << ". Only none|sum|mean are supported!";
+            embedding = embeddedDictionary || reduce != Reduce::NONE;
+
             Precision inIdxPrecision = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getPrecision();
             if (inIdxPrecision != Precision::FP32 &&
                 inIdxPrecision != Precision::I32 &&
@@ -97,44 +176,51 @@ public:
                 inIdxPrecision != Precision::I8)
                 THROW_IE_EXCEPTION << "Incorrect input precision. Only FP32|I32|U16|I16|U8|I8 are supported!";
 
-            //  Remove redundant dimensions
-            const SizeVector& dictionary_dims = layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getDims();
-            size_t actualAxis = 0;
-            SizeVector dims_actual;
-            for (size_t i = 0; i < dictionary_dims.size(); i++) {
-                if (dictionary_dims[i] > 1) {
-                    for (size_t j = i; j < dictionary_dims.size(); j++)
-                        dims_actual.push_back(dictionary_dims[j]);
-                    break;
-                }
+            if (embeddedDictionary) {
+                initEmbeddedDictionary(layer);
+            } else {
+                initDictionaryInput(layer);
             }
+            if (embedding && numDictionaries != 1)
+                THROW_IE_EXCEPTION << "Embedding lookups support only gathering along the outermost dictionary axis!";
 
-            if (dims_actual.size() == 0)
-                THROW_IE_EXCEPTION << "Incorrect input parameters dimension!";
-
-            axis = static_cast<int>(layer->GetParamAsInt("axis"));
-            // Dictionary must be at least rank axis + 1
-            if (axis > 0 && (dims_actual.size() - axis) < 1)
-                THROW_IE_EXCEPTION << "Incorrect input parameters dimensions and axis number!";
-            else if (axis < 0 && (static_cast<int>(dims_actual.size()) + axis) < 0)
-                THROW_IE_EXCEPTION << "Incorrect input parameters dimensions and axis number!";
-
-            if (axis < 0)
-                axis += dims_actual.size();
-
-            //  Find number of dictionaries, index range and data length
-            for (size_t i = 0; i < axis; i++)
-                numDictionaries *= dims_actual[i];
-            indexRange = dims_actual[axis];
-            for (size_t i = axis + 1; i < dims_actual.size(); i++)
-                dataLength *= dims_actual[i];
+            const SizeVector& indexes_dims = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getDims();
+            if (reduce != Reduce::NONE) {
+                if (indexes_dims.empty() || indexes_dims.back() == 0)
+                    THROW_IE_EXCEPTION << "Incorrect indexes dimensions for the reduce mode!";
+                bagSize = indexes_dims.back();
+            }
 
-            if (dataLength == 0)
-                THROW_IE_EXCEPTION << "Incorrect input parameters dimension!";
+            if (embedding) {
+                //  Lookups are written row by row into a dense output
+                const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
+                size_t idx_size = 1;
+                for (auto dim : indexes_dims)
+                    idx_size *= dim;
+                size_t out_size = 1;
+                for (auto dim : out_dims)
+                    out_size *= dim;
+                if (out_size != idx_size / bagSize * dataLength)
+                    THROW_IE_EXCEPTION << "Incorrect output dimensions for the looked up rows!";
+                LayerConfig config;
+                DataConfig dataConfigIdx, dataConfigDct, dataConfigOut;
+                dataConfigIdx.desc = TensorDesc(inIdxPrecision, indexes_dims, TensorDesc::getLayoutByDims(indexes_dims));
+                if (!embeddedDictionary) {
+                    const SizeVector& dictionary_dims = layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getDims();
+                    dataConfigDct.desc = TensorDesc(Precision::FP32, dictionary_dims, TensorDesc::getLayoutByDims(dictionary_dims));
+                    config.inConfs.push_back(dataConfigDct);
+                }
+                config.inConfs.push_back(dataConfigIdx);
+                dataConfigOut.desc = TensorDesc(Precision::FP32, out_dims, TensorDesc::getLayoutByDims(out_dims));
+                config.outConfs.push_back(dataConfigOut);
+                config.dynBatchSupport = false;
+                confs.push_back(config);
+                return;
+            }
 
             LayerConfig config;
             DataConfig dataConfigIdx, dataConfigDct;
-            const SizeVector& indexes_dims = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getDims();
+            const SizeVector& dictionary_dims = layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getDims();
             dataConfigDct.desc = TensorDesc(InferenceEngine::Precision(InferenceEngine::Precision::FP32), dictionary_dims, InferenceEngine::Layout::ANY);
             dataConfigIdx.desc = TensorDesc(inIdxPrecision, indexes_dims, InferenceEngine::Layout::ANY);
             if (GATHER_DICTIONARY == 0) {
@@ -171,22 +257,22 @@ public:
                        ResponseDesc *resp) noexcept override {
         switch (inputs[GATHER_INDEXES]->precision()) {
             case Precision::FP32:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const float *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0], withHoles);
+                lookup<float>(inputs, outputs[0]);
                 break;
             case Precision::I32:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const int32_t *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0], withHoles);
+                lookup<int32_t>(inputs, outputs[0]);
                 break;
             case Precision::U16:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const uint16_t *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0], withHoles);
+                lookup<uint16_t>(inputs, outputs[0]);
                 break;
             case Precision::I16:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const int16_t *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0], withHoles);
+                lookup<int16_t>(inputs, outputs[0]);
                 break;
             case Precision::U8:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const uint8_t *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0], withHoles);
+                lookup<uint8_t>(inputs, outputs[0]);
                 break;
             case Precision::I8:
-                gather(inputs[GATHER_INDEXES]->cbuffer().as<const int8_t *>(), inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0], withHoles);
+                lookup<int8_t>(inputs, outputs[0]);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -207,18 +293,174 @@ private:
         ALL = 2
     };
 
+    void initDictionaryInput(const CNNLayer* layer) {
+        //  Remove redundant dimensions
+        const SizeVector& dictionary_dims = layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getDims();
+        size_t actualAxis = 0;
+        SizeVector dims_actual;
+        for (size_t i = 0; i < dictionary_dims.size(); i++) {
+            if (dictionary_dims[i] > 1) {
+                for (size_t j = i; j < dictionary_dims.size(); j++)
+                    dims_actual.push_back(dictionary_dims[j]);
+                break;
+            }
+        }
+
+        if (dims_actual.size() == 0)
+            THROW_IE_EXCEPTION << "Incorrect input parameters dimension!";
+
+        axis = static_cast<int>(layer->GetParamAsInt("axis"));
+        // Dictionary must be at least rank axis + 1
+        if (axis > 0 && (dims_actual.size() - axis) < 1)
+            THROW_IE_EXCEPTION << "Incorrect input parameters dimensions and axis number!";
+        else if (axis < 0 && (static_cast<int>(dims_actual.size()) + axis) < 0)
+            THROW_IE_EXCEPTION << "Incorrect input parameters dimensions and axis number!";
+
+        if (axis < 0)
+            axis += dims_actual.size();
+
+        //  Find number of dictionaries, index range and data length
+        for (size_t i = 0; i < axis; i++)
+            numDictionaries *= dims_actual[i];
+        indexRange = dims_actual[axis];
+        for (size_t i = axis + 1; i < dims_actual.size(); i++)
+            dataLength *= dims_actual[i];
+
+        if (dataLength == 0)
+            THROW_IE_EXCEPTION << "Incorrect input parameters dimension!";
+    }
+
+    void initEmbeddedDictionary(const CNNLayer* layer) {
+        Precision dictPrecision = embeddedDictionary->precision();
+        if (dictPrecision != Precision::FP32 &&
+            dictPrecision != Precision::FP16 &&
+            dictPrecision != Precision::I8 &&
+            dictPrecision != Precision::U8)
+            THROW_IE_EXCEPTION << "Incorrect dictionary precision. Only FP32|FP16|I8|U8 are supported!";
+
+        dataLength = layer->GetParamAsUInt("embedding_size");
+        if (dataLength == 0 || embeddedDictionary->size() % dataLength != 0)
+            THROW_IE_EXCEPTION << "Dictionary size " << embeddedDictionary->size()
+                               << " is not a multiple of the embedding size " << dataLength << "!";
+        indexRange = embeddedDictionary->size() / dataLength;
+
+        //  Per-row dequantization parameters of compressed dictionaries
+        auto findRowParams = [&](const char* name) {
+            auto blob = layer->blobs.find(name);
+            if (blob == layer->blobs.end())
+                return Blob::Ptr();
+            if (blob->second->precision() != Precision::FP32 || blob->second->size() != indexRange)
+                THROW_IE_EXCEPTION << "Incorrect " << name << " blob. It must have one FP32 value per dictionary row!";
+            return blob->second;
+        };
+        rowScales = findRowParams("scales");
+        rowShifts = findRowParams("shifts");
+    }
+
+    enum class Reduce { NONE, SUM, MEAN };
+
+    template <typename index_t>
+    void lookup(std::vector<Blob::Ptr>& inputs, Blob::Ptr output);
     template <typename data_t>
     void gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output, bool withHoles);
+    template <typename index_t, typename dict_t>
+    void embeddingBag(const index_t *src_dataIdx, size_t numIndexes, const dict_t *src_dataDict, float *dst_data);
 
     int axis = 0;
     size_t numDictionaries = 1;
     size_t indexRange = 0;
     size_t dataLength = 1;
     const size_t GATHER_DICTIONARY = 0;
-    const size_t GATHER_INDEXES = 1;
+    size_t GATHER_INDEXES = 1;
     HolesMode withHoles = ALL;
+
+    //  Embedding lookups: dictionary blob of the layer, its per-row scales and shifts,
+    //  and rows of every bagSize consecutive indexes reduced into one output row
+    bool embedding = false;
+    Blob::Ptr embeddedDictionary;
+    Blob::Ptr rowScales;
+    Blob::Ptr rowShifts;
+    Reduce reduce = Reduce::NONE;
+    size_t bagSize = 1;
 };
 
+template <typename index_t>
+void GatherImpl::lookup(std::vector<Blob::Ptr>& inputs, Blob::Ptr output) {
+    const index_t *src_dataIdx = inputs[GATHER_INDEXES]->cbuffer().as<const index_t *>();
+    if (!embedding) {
+        gather(src_dataIdx, inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], output, withHoles);
+        return;
+    }
+
+    src_dataIdx += inputs[GATHER_INDEXES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    size_t numIndexes = inputs[GATHER_INDEXES]->size();
+    float *dst_data = output->buffer().as<float *>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+    Blob::Ptr dictionary = embeddedDictionary ? embeddedDictionary : inputs[GATHER_DICTIONARY];
+    size_t dictOffset = embeddedDictionary ? 0 : dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    switch (dictionary->precision()) {
+        case Precision::FP32:
+            embeddingBag(src_dataIdx, numIndexes, dictionary->cbuffer().as<const float *>() + dictOffset, dst_data);
+            break;
+        case Precision::FP16:
+            embeddingBag(src_dataIdx, numIndexes, dictionary->cbuffer().as<const fp16_t *>() + dictOffset, dst_data);
+            break;
+        case Precision::I8:
+            embeddingBag(src_dataIdx, numIndexes, dictionary->cbuffer().as<const int8_t *>() + dictOffset, dst_data);
+            break;
+        case Precision::U8:
+            embeddingBag(src_dataIdx, numIndexes, dictionary->cbuffer().as<const uint8_t *>() + dictOffset, dst_data);
+            break;
+        default:
+            //  Rejected when the layer is created
+            break;
+    }
+}
+
+template <typename index_t, typename dict_t>
+void GatherImpl::embeddingBag(const index_t *src_dataIdx, size_t numIndexes, const dict_t *src_dataDict, float *dst_data) {
+    const float *scales = rowScales ? rowScales->cbuffer().as<const float *>() : nullptr;
+    const float *shifts = rowShifts ? rowShifts->cbuffer().as<const float *>() : nullptr;
+    const float bagScale = reduce == Reduce::MEAN ? 1.0f / bagSize : 1.0f;
+    const size_t bags = numIndexes / bagSize;
+    const size_t rowBytes = dataLength * sizeof(dict_t);
+
+    auto rowOf = [&](size_t i) {
+        int idx = static_cast<int>(src_dataIdx[i]);
+        clipping(&idx, 0, indexRange);
+        return static_cast<size_t>(idx);
+    };
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(bags, nthr, ithr, start, end);
+
+        //  Every thread walks its lookups in order and requests the rows of the next ones
+        //  while the current row is decoded, so random rows of a huge table arrive in time
+        const size_t first = start * bagSize;
+        const size_t last = end * bagSize;
+        for (size_t i = first; i < std::min(last, first + prefetch_distance); i++)
+            prefetchRow(src_dataDict + rowOf(i) * dataLength, rowBytes);
+
+        for (size_t b = start; b < end; b++) {
+            float *dst = dst_data + b * dataLength;
+            for (size_t j = 0; j < bagSize; j++) {
+                size_t i = b * bagSize + j;
+                if (i + prefetch_distance < last)
+                    prefetchRow(src_dataDict + rowOf(i + prefetch_distance) * dataLength, rowBytes);
+
+                size_t row = rowOf(i);
+                float scale = (scales ? scales[row] : 1.0f) * bagScale;
+                float shift = (shifts ? shifts[row] : 0.0f) * bagScale;
+                if (j == 0)
+                    decodeRow<dict_t, false>(dst, src_dataDict + row * dataLength, dataLength, scale, shift);
+                else
+                    decodeRow<dict_t, true>(dst, src_dataDict + row * dataLength, dataLength, scale, shift);
+            }
+        }
+    });
+}
+
 template <typename data_t>
 void GatherImpl::gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output, bool withHoles) {
     size_t src_dataIdxSize = indexes->size();
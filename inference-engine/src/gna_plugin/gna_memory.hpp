@@ -4,9 +4,11 @@
 
 #pragma once
 #include "gna_mem_requests.hpp"
+#include "memory_solver.hpp"
 #include <memory>
 #include <vector>
 #include <list>
+#include <limits>
 #include <algorithm>
 #include <functional>
 
@@ -27,6 +29,12 @@ namespace GNAPluginNS {
 
 
 
+/**
+ * @brief returns execution order index of a component that owns pointer updated by a memory request,
+ * or negative value if pointer doesn't belong to any component
+ */
+using LifetimeResolver = std::function<int(const void *ptr_out)>;
+
 /**
  * @brief encapsulate various request to allocate GNA specific memory,
  * in order to issue single allocation call and configure actual pointers in requests
@@ -42,6 +50,12 @@ class GNAMemory : public GNAMemRequestsQueue {
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap;
     size_t _page_alignment = 1;
+    LifetimeResolver _lifetime;
+    // offsets of RW requests planned with respect to their lifetimes
+    std::vector<size_t> _rw_offsets;
+    // RW bytes taken by the requests before the page alignment, with and without the buffers reuse
+    size_t _rw_bytes_used = 0;
+    size_t _rw_bytes_used_no_reuse = 0;
 
     class GNAMemRequestsReadOnlyQueue : public GNAMemRequestsQueue {
         std::reference_wrapper<GNAMemRequestsQueue> _that;
@@ -72,27 +86,19 @@ class GNAMemory : public GNAMemRequestsQueue {
         return readOnlyFrontEnd;
     }
 
+    /**
+     * @brief enables sharing of RW memory between allocation requests with non intersecting lifetimes
+     * Lifetime of a request spans over execution indexes of all components owning its pointer or pointers
+     * binded to it. Requests not owned by components entirely, as well as store requests keep dedicated memory
+     */
+    void setLifetimeResolver(LifetimeResolver resolver) {
+        _lifetime = resolver;
+    }
+
     /**
      * @brief calculates size required for all requests, allocates memory and updates pointers
      */
     void commit() {
-        // 1st stage -- looking for expandable bind requests:
-        for (auto &originated : _future_heap) {
-            if (originated._type == REQUEST_BIND) continue;
-            size_t offset = 0;
-            iterate_binded(originated, [&](MemRequest & reference, MemRequest & binded) {
-                if (&originated == &reference) {
-                    offset = 0;
-                }
-                offset += binded._offset;
-                auto current = offset + ALIGN(binded._num_elements * binded._element_size, binded._alignment);
-                auto original_no_pad = ALIGN(originated._num_elements * originated._element_size, originated._alignment);
-                auto original_with_pad = ALIGN(originated._num_elements * originated._element_size + originated._padding, originated._alignment);
-
-                originated._padding = ALIGN(std::max(original_with_pad, current), originated._alignment) - original_no_pad;
-            });
-        }
-
         updateSectionsSizes();
 
         _total = _rw_section_size + _ro_section_size;
@@ -100,14 +106,16 @@ class GNAMemory : public GNAMemRequestsQueue {
         // allocation with memory setting to 0 internally
         heap = allocate(_total);
         auto setupOffsets = [&](std::function<bool(MemRequest & request)> filter, size_t offset) {
-            for (auto &re : _future_heap) {
+            for (size_t i = 0; i != _future_heap.size(); i++) {
+                auto &re = _future_heap[i];
                 if (re._type == REQUEST_BIND) continue;
                 if (filter(re)) continue;
 
                 auto sz = re._element_size * re._num_elements;
 
                 if (re._ptr_out != nullptr) {
-                    auto cptr = heap.get() + offset;
+                    auto planned = _lifetime && re._region == REGION_RW;
+                    auto cptr = heap.get() + (planned ? _rw_offsets[i] : offset);
                     *reinterpret_cast<void **>(re._ptr_out) = cptr;
                     // std::cout << "ALLOCATED=" << cptr << ", size=" << re._element_size * re._num_elements << "\n";
                     iterate_binded(re, [](MemRequest & reference, MemRequest & binded) {
@@ -159,6 +167,22 @@ class GNAMemory : public GNAMemRequestsQueue {
         return _rw_section_size;
     }
 
+    /**
+     * @brief RW bytes taken by the requests, unlike getRWBytes() not rounded up to the page alignment
+     */
+    size_t getRWBytesUsed() {
+        updateSectionsSizes();
+        return _rw_bytes_used;
+    }
+
+    /**
+     * @brief RW bytes the requests would take if every request had dedicated memory
+     */
+    size_t getRWBytesUsedWithoutReuse() {
+        updateSectionsSizes();
+        return _rw_bytes_used_no_reuse;
+    }
+
     size_t getTotalBytes() {
         updateSectionsSizes();
         return _total;
@@ -197,7 +221,96 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
  protected:
+    /**
+     * @brief bind request might refer to bigger buffer than originally requested, so original request gets padded
+     */
+    void expandBindedRequests() {
+        for (auto &originated : _future_heap) {
+            if (originated._type == REQUEST_BIND) continue;
+            size_t offset = 0;
+            iterate_binded(originated, [&](MemRequest & reference, MemRequest & binded) {
+                if (&originated == &reference) {
+                    offset = 0;
+                }
+                offset += binded._offset;
+                auto current = offset + ALIGN(binded._num_elements * binded._element_size, binded._alignment);
+                auto original_no_pad = ALIGN(originated._num_elements * originated._element_size, originated._alignment);
+                auto original_with_pad = ALIGN(originated._num_elements * originated._element_size + originated._padding, originated._alignment);
+
+                originated._padding = ALIGN(std::max(original_with_pad, current), originated._alignment) - original_no_pad;
+            });
+        }
+    }
+
+    /**
+     * @brief collects first and last execution index of components that use memory of given request
+     * @return false if memory is used outside of components, thus has to outlive whole execution
+     */
+    bool getLifetime(MemRequest & request, int & first, int & last) {
+        bool owned = true;
+        first = std::numeric_limits<int>::max();
+        last = -1;
+        auto visit = [&](const void * ptr) {
+            int idx = _lifetime(ptr);
+            if (idx < 0) {
+                owned = false;
+                return;
+            }
+            first = std::min(first, idx);
+            last = std::max(last, idx);
+        };
+        visit(request._ptr_out);
+        iterate_binded(request, [&](MemRequest & reference, MemRequest & binded) {
+            visit(binded._ptr_out);
+        });
+        return owned && last >= 0;
+    }
+
+    /**
+     * @brief places RW requests with known lifetime into shared space using MemorySolver, the rest
+     * requests are placed after it one by one
+     * @return size of RW section
+     */
+    size_t planReadWriteSection() {
+        // solver operates with abstract units, all shared buffers are aligned to 64 bytes
+        const size_t unit = 64;
+        std::vector<InferenceEngine::MemorySolver::Box> boxes;
+        std::vector<size_t> dedicated;
+        _rw_offsets.assign(_future_heap.size(), 0);
+
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
+            if (re._type == REQUEST_BIND || re._region != REGION_RW) continue;
+
+            int first = 0, last = 0;
+            // only allocations might be shared, stored data has to stay intact
+            if (re._type != REQUEST_ALLOCATE || unit % re._alignment != 0 || !getLifetime(re, first, last)) {
+                dedicated.push_back(i);
+                continue;
+            }
+            auto units = ALIGN(re._num_elements * re._element_size + re._padding, unit) / unit;
+            boxes.push_back({first, last, std::max(static_cast<int>(units), 1), static_cast<int>(i)});
+        }
+
+        size_t offset = 0;
+        if (!boxes.empty()) {
+            InferenceEngine::MemorySolver solver(boxes);
+            offset = solver.solve() * unit;
+            for (auto &box : boxes) {
+                _rw_offsets[box.id] = solver.getOffset(box.id) * unit;
+            }
+        }
+        for (auto i : dedicated) {
+            auto &re = _future_heap[i];
+            _rw_offsets[i] = offset;
+            offset += ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
+        }
+        return offset;
+    }
+
     void updateSectionsSizes() {
+        expandBindedRequests();
+
         // count total size and size of read/write regions
         _rw_section_size = 0;
         _ro_section_size = 0;
@@ -220,6 +333,11 @@ class GNAMemory : public GNAMemRequestsQueue {
                 _ro_section_size += current;
             }
         }
+        _rw_bytes_used_no_reuse = _rw_section_size;
+        if (_lifetime) {
+            _rw_section_size = planReadWriteSection();
+        }
+        _rw_bytes_used = _rw_section_size;
         _rw_section_size = ALIGN(_rw_section_size, _page_alignment);
         _ro_section_size = ALIGN(_ro_section_size, _page_alignment);
     }
@@ -4,11 +4,22 @@
 
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <details/ie_exception.hpp>
+#include <fstream>
 #include <ios>
 #include <iomanip>
+#include <sstream>
 #ifndef _WIN32
 #include <mm_malloc.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <malloc.h>
 #endif
 #include <gna-api-types-xnn.h>
 #include "gna_model_serial.hpp"
@@ -39,6 +50,26 @@ inline void readOffset(T & ptr, void *base,  std::istream & is) {
     ptr = reinterpret_cast<T>(reinterpret_cast<uint8_t *>(base) + offset);
 }
 
+/**
+ * @brief resolves offsets of RW section against one base and the rest of them against another
+ */
+struct SectionBase {
+    void *rw;
+    void *ro;
+    uint64_t rwSize;
+
+    void *operator()(uint64_t offset) const {
+        return offset < rwSize ? rw : ro;
+    }
+};
+
+template <class T>
+inline void readOffset(T & ptr, const SectionBase &base, std::istream & is) {
+    uint64_t offset = 0ull;
+    readBits(offset, is);
+    ptr = reinterpret_cast<T>(reinterpret_cast<uint8_t *>(base(offset)) + offset);
+}
+
 union {
     uint16_t s;
     uint8_t  c[2];
@@ -50,11 +81,15 @@ bool is_little_endian() {
 
 const int gna_header_magic = is_little_endian() ?  0x4d414e47 : 0x474e414d;
 
+constexpr uint32_t GNAModelSerial::graphAlignment;
+
 ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
     is.exceptions(std::istream::failbit);
 
-    ModelHeader header;
-    readBits(header, is);
+    ModelHeader header = {};
+    // magic and header size go first, fields missing in older versions keep their default values
+    const size_t prefixSize = offsetof(ModelHeader, version);
+    is.read(reinterpret_cast<char *>(&header), prefixSize);
     if (*reinterpret_cast<int*>(header.gnam) != gna_header_magic) {
         THROW_GNA_EXCEPTION << "Imported file unsupported: magic number should be GNAM(0x474e414d), but was 0x"
                            << std::setfill('0') <<
@@ -63,11 +98,29 @@ ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
                            std::hex << std::setw(2) << static_cast<short>(header.gnam[2]) <<
                            std::hex << std::setw(2) << static_cast<short>(header.gnam[3]);
     }
+    // version 1.1 header ends right before alignment field
+    const size_t minimalSize = offsetof(ModelHeader, alignment);
+    if (header.headerSize < minimalSize) {
+        THROW_GNA_EXCEPTION << "Unsupported header size minimal value is : " << minimalSize << ", but read: " << header.headerSize;
+    }
+    is.read(reinterpret_cast<char *>(&header) + prefixSize, std::min<size_t>(header.headerSize, sizeof(header)) - prefixSize);
     if (header.version.major < 1) {
         THROW_GNA_EXCEPTION << "Imported file unsupported: major version sould be > 1";
     }
-    if (header.headerSize < sizeof(header)) {
-        THROW_GNA_EXCEPTION << "Unsupported header size minimal value is : " << sizeof (header) << ", but read: " << header.headerSize;
+    // version 1.1 files have no alignment field and keep the graph right after layers definition
+    if (header.headerSize >= offsetof(ModelHeader, alignment) + sizeof(header.alignment)) {
+        if (header.alignment != graphAlignment) {
+            THROW_GNA_EXCEPTION << "Imported file unsupported: gna graph alignment should be " << graphAlignment
+                                << ", but was " << header.alignment;
+        }
+        if (header.graphOffset % header.alignment != 0) {
+            THROW_GNA_EXCEPTION << "Imported file corrupted: gna graph offset " << header.graphOffset
+                                << " is not aligned to " << header.alignment;
+        }
+    }
+    if (header.rwSectionSize > header.gnaMemSize) {
+        THROW_GNA_EXCEPTION << "Imported file corrupted: RW section size " << header.rwSectionSize
+                            << " exceeds gna graph size " << header.gnaMemSize;
     }
     /*
      * extra data need to be added into new header and modify check as appropriate
@@ -80,10 +133,44 @@ ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
     return header;
 }
 
-void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize,  std::istream & is) {
+uint64_t GNAModelSerial::Checksum(const void *data, size_t size) {
+    const uint64_t prime = 0x100000001b3ull;
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i != size; i++) {
+        hash = (hash ^ bytes[i]) * prime;
+    }
+    return hash;
+}
+
+void GNAModelSerial::Import(void *basePointer, const ModelHeader &header, std::istream & is) {
+    ImportStructure(basePointer, basePointer, header, is);
+
+    // since version 1.2 gna graph is aligned in file
+    if (header.graphOffset != 0) {
+        is.seekg(header.graphOffset, std::ios_base::beg);
+    }
+    // once structure has been read lets read whole gna graph
+    is.read(reinterpret_cast<char*>(basePointer), header.gnaMemSize);
+}
+
+void GNAModelSerial::ImportStructure(void *rwBasePointer,
+                                     const void *roBasePointer,
+                                     const ModelHeader &header,
+                                     std::istream & is) {
     is.exceptions(std::istream::failbit);
 
-    auto readPwl = [&is, basePointer] (intel_pwl_func_t & value) {
+    // GNA does not modify RO section, so it is fine to point it to read only memory
+    const SectionBase basePointer {rwBasePointer, const_cast<void *>(roBasePointer), header.rwSectionSize};
+
+    auto readPwl = [&is, &basePointer] (intel_pwl_func_t & value) {
         readBits(value.nSegments, is);
         if (value.nSegments != 0) {
             readOffset(value.pSegments, basePointer, is);
@@ -177,10 +264,6 @@ void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize,  std::istrea
            (*pstates)[i] = {pSegment, segmentSz};
        }
     }
-
-
-    // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
 }
 
 #define offsetFromBase(field)\
@@ -192,9 +275,16 @@ getOffsetFromBase(field, #field)
  * @param ptr_nnet
  * @param gnaAllocSize - it can be calculated based on nnet, however it will overcomplicate export
  * about base adress it is relatively easy to calculate
- * @param os
+ * @param stream
  */
-void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostream & os) const {
+void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostream & stream) const {
+    stream.exceptions(std::ostream::failbit);
+    if (rwSectionSize > gnaGraphSize) {
+        THROW_GNA_EXCEPTION << "RW section size " << rwSectionSize << " exceeds gna graph size " << gnaGraphSize;
+    }
+
+    // layers are serialized first, since offset of aligned gna graph depends on their size
+    std::ostringstream os;
     os.exceptions(std::ostream::failbit);
 
     std::vector<intel_nnet_layer_t>
@@ -231,7 +321,7 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
     /**
      * writing header
      */
-    ModelHeader header;
+    ModelHeader header = {};
     header.gnam[0] = 'G';
     header.gnam[1] = 'N';
     header.gnam[2] = 'A';
@@ -246,9 +336,9 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
     header.headerSize = sizeof(ModelHeader);
     header.nRotateRows = nRotateRows;
     header.nRotateColumns = nRotateColumns;
-
-
-    writeBits(header, os);
+    header.alignment = graphAlignment;
+    header.rwSectionSize = rwSectionSize;
+    header.roChecksum = Checksum(reinterpret_cast<uint8_t*>(basePointer) + rwSectionSize, gnaGraphSize - rwSectionSize);
 
     for (auto & layer : layers) {
         writeBits(layer.nInputColumns, os);
@@ -315,6 +405,61 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
         writeBits(state.second, os);
     }
 
+    auto structure = os.str();
+    auto structureEnd = header.headerSize + structure.size();
+    header.graphOffset = (structureEnd + graphAlignment - 1) / graphAlignment * graphAlignment;
+
+    writeBits(header, stream);
+    stream.write(structure.data(), structure.size());
+    std::vector<char> padding(header.graphOffset - structureEnd, 0);
+    stream.write(padding.data(), padding.size());
+
     // once structure has been written lets push gna graph
-    os.write(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    stream.write(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+}
+
+GNAMappedFile::GNAMappedFile(const std::string &fileName) {
+#ifndef _WIN32
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd != -1) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr != MAP_FAILED) {
+                _data = reinterpret_cast<const uint8_t *>(ptr);
+                _size = st.st_size;
+                _mapped = true;
+            }
+        }
+        close(fd);
+    }
+    if (_mapped) {
+        return;
+    }
+#endif
+    std::ifstream is(fileName, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+    if (!is) {
+        THROW_GNA_EXCEPTION << "Cannot open file to import model: " << fileName;
+    }
+    _size = static_cast<size_t>(is.tellg());
+    auto buffer = reinterpret_cast<char *>(_mm_malloc(std::max<size_t>(_size, 1), GNAModelSerial::graphAlignment));
+    if (buffer == nullptr) {
+        THROW_GNA_EXCEPTION << "could not allocate " << _size << " bytes to read " << fileName;
+    }
+    _data = reinterpret_cast<const uint8_t *>(buffer);
+    is.seekg(0, std::ios_base::beg);
+    if (!is.read(buffer, _size)) {
+        _mm_free(buffer);
+        THROW_GNA_EXCEPTION << "Cannot read model file: " << fileName;
+    }
+}
+
+GNAMappedFile::~GNAMappedFile() {
+#ifndef _WIN32
+    if (_mapped) {
+        munmap(const_cast<uint8_t *>(_data), _size);
+        return;
+    }
+#endif
+    _mm_free(const_cast<uint8_t *>(_data));
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <istream>
+#include <string>
 #include <vector>
 #include <utility>
 #include "gna-api.h"
@@ -15,10 +16,11 @@
  * version history
  * 1.0 - basic support
  * 1.1 - added memory information
+ * 1.2 - gna graph aligned in file, size of RW section and checksum of RO section
  */
 
 #define HEADER_MAJOR 1
-#define HEADER_MINOR 1
+#define HEADER_MINOR 2
 
 /**
  * @brief Header version 1.0
@@ -88,6 +90,23 @@ struct ModelHeader {
     EndPoint input;
     EndPoint output;
 
+    /**
+     * @brief Alignment of gna graph offset in file, fields below are available since version 1.2
+     */
+    uint32_t alignment = 1u;
+    /**
+     * @brief Offset of gna graph from the beginning of file, 0 - graph follows layers definition
+     */
+    uint64_t graphOffset = 0ull;
+    /**
+     * @brief Gna graph starts with RW section of this size, rest of the graph is read only
+     */
+    uint64_t rwSectionSize = 0ull;
+    /**
+     * @brief GNAModelSerial::Checksum() of RO section, 0 - not available
+     */
+    uint64_t roChecksum = 0ull;
+
     /**
      * Reserved Data might be here
      */
@@ -137,6 +156,7 @@ private:
     RuntimeEndPoint input, output;
     uint32_t nRotateRows = 0;
     uint32_t nRotateColumns = 0;
+    uint64_t rwSectionSize = 0;
 
     MemoryType states, *pstates = nullptr;
 
@@ -169,6 +189,14 @@ private:
       return *this;
     }
 
+    /**
+     * @brief size of RW section at the beginning of gna graph, rest of it is exported as read only
+     */
+    GNAModelSerial & SetReadWriteSectionSize(uint64_t size) {
+        rwSectionSize = size;
+        return *this;
+    }
+
     /**
      * mark certain part of gna_blob as state (in future naming is possible)
      * @param descriptor_ptr
@@ -194,7 +222,27 @@ private:
      * @param basePointer
      * @param is - stream without header structure - TBD heder might be needed
      */
-    void Import(void *basePointer, size_t gnaGraphSize, std::istream &is);
+    void Import(void *basePointer, const ModelHeader &header, std::istream &is);
+
+    /**
+     * @brief Import layers and memory information only, gna graph is not read.
+     * Offsets inside of RW section are resolved against rwBasePointer, rest of them against roBasePointer,
+     * so read only part of graph can be used directly from memory mapped file
+     * @param rwBasePointer - preallocated RW section
+     * @param roBasePointer - beginning of gna graph the RO section is a part of
+     * @param is - stream positioned right after header
+     */
+    void ImportStructure(void *rwBasePointer, const void *roBasePointer, const ModelHeader &header, std::istream &is);
+
+    /**
+     * @brief FNV-1a hash over 64-bit words, tail bytes are hashed one by one
+     */
+    static uint64_t Checksum(const void *data, size_t size);
+
+    /**
+     * @brief alignment of gna graph in exported file, allows to memory map it
+     */
+    static constexpr uint32_t graphAlignment = 4096;
 
     /**
      * save gna graph to an outpus stream
@@ -206,4 +254,30 @@ private:
     void Export(void *basePtr,
                 size_t gnaGraphSize,
                 std::ostream &os) const;
-};
\ No newline at end of file
+};
+/**
+ * @brief read only view of exported model file, memory mapped where platform supports it,
+ * otherwise file is read into page aligned buffer
+ */
+class GNAMappedFile {
+    const uint8_t *_data = nullptr;
+    size_t _size = 0;
+    bool _mapped = false;
+
+ public:
+    explicit GNAMappedFile(const std::string &fileName);
+    ~GNAMappedFile();
+
+    GNAMappedFile(const GNAMappedFile &) = delete;
+    GNAMappedFile & operator = (const GNAMappedFile &) = delete;
+
+    const uint8_t *data() const {
+        return _data;
+    }
+    size_t size() const {
+        return _size;
+    }
+    bool mapped() const {
+        return _mapped;
+    }
+};
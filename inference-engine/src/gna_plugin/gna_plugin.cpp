@@ -1364,6 +1364,16 @@ GNAPlugin::GNAPlugin(const std::map<std::string, std::string>& configMap) {
         }
     });
 
+    if_set(GNA_CONFIG_KEY(IMPORT_ZERO_COPY), [&] {
+        if (value == PluginConfigParams::YES) {
+            import_zero_copy = true;
+        } else if (value == PluginConfigParams::NO) {
+            import_zero_copy = false;
+        } else {
+            THROW_GNA_EXCEPTION << "GNA zero copy import should be YES/NO, but not" << value;
+        }
+    });
+
     if_set(CONFIG_KEY(PERF_COUNT), [&] {
         if (value == PluginConfigParams::YES) {
             performance_counting = true;
@@ -1542,6 +1552,14 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
         gnamem.reset(new gna_memory_type(make_polymorph<std::allocator<uint8_t>>()));
     }
 
+    // intermediate buffers used by components only might share memory, the same in float mode:
+    // padding of a reused buffer keeps finite outputs of earlier layers which meet zero padded weights
+    if (compact_mode) {
+        gnamem->setLifetimeResolver([this](const void *ptr) {
+            return componentExecutionIndex(ptr);
+        });
+    }
+
     // creating intel dnn_t structures from network
     auto sortedNet = CNNNetSortTopologically(*newNet);
     std::vector<CNNLayerPtr> sortedNoMem;
@@ -1616,6 +1634,8 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
     }
 
     gnamem->commit();
+    gnalog() << "RW section size: " << gnamem->getRWBytes() << " bytes, used " << gnamem->getRWBytesUsed()
+             << " bytes, without buffers reuse: " << gnamem->getRWBytesUsedWithoutReuse() << " bytes\n";
 
     dnn.Init(gnamem->getBasePtr(),
              gnamem->getTotalBytes(),
@@ -1734,7 +1754,18 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &input, Infere
     }*/
 }
 
+void GNAPlugin::ValidateImportedModel() {
+    std::call_once(imported->validated, [this] {
+        if (GNAModelSerial::Checksum(imported->ptr, imported->size) != imported->checksum) {
+            THROW_GNA_EXCEPTION << "Imported model corrupted: checksum of read only section mismatch";
+        }
+    });
+}
+
 uint32_t GNAPlugin::QueueInference(const InferenceEngine::Blob &input, InferenceEngine::BlobMap &result) {
+    if (imported && imported->ptr != nullptr) {
+        ValidateImportedModel();
+    }
     auto inputLayout = input.layout();
     if (inputLayout != Layout::NC && inputLayout != Layout::CN && inputLayout != NCHW) {
         THROW_GNA_EXCEPTION << "Expected input blob to have Layout::NC or Layout::CN, but was: " << input.layout();
@@ -1945,15 +1976,45 @@ InferenceEngine::IExecutableNetwork::Ptr GNAPlugin::ImportNetwork(const std::str
                                         gna_openmp_multithreading));
     gnamem.reset(new gna_memory_type(make_polymorph<GNAAllocator>(*gnadevice.get()), PAGE_SIZE_BYTES));
 
-    void *basePtr = nullptr;
-    gnamem->reserve_ptr(&basePtr, header.gnaMemSize);
-    gnamem->commit();
-
     nnets.push_back(std::make_tuple(make_shared<CPPWrapper<intel_nnet_type_t>>(header.layersCount), -1, InferenceEngine::BlobMap()));
     std::get<0>(nnets.back())->obj.nGroup = header.nGroup;
     GNAModelSerial::MemoryType  mt;
     auto serial = GNAModelSerial(&std::get<0>(nnets.back())->obj, mt);
-    serial.Import(basePtr, header.gnaMemSize, inputStream);
+
+    void *basePtr = nullptr;
+    imported.reset();
+    if (header.graphOffset == 0) {
+        // graph is not aligned in file, so it is read right after layers
+        gnamem->reserve_ptr(&basePtr, header.gnaMemSize);
+        gnamem->commit();
+        serial.Import(basePtr, header, inputStream);
+    } else {
+        auto file = std::make_shared<GNAMappedFile>(modelFileName);
+        if (file->size() < header.graphOffset + header.gnaMemSize) {
+            THROW_GNA_EXCEPTION << "Imported file corrupted: " << file->size() << " bytes, but gna graph ends at "
+                                << header.graphOffset + header.gnaMemSize;
+        }
+        auto graph = file->data() + header.graphOffset;
+        // with zero copy GNA memory holds only RW section, RO section is used from file mapping
+        bool zeroCopy = import_zero_copy && header.graphOffset % PAGE_SIZE_BYTES == 0;
+        auto gnaBytes = zeroCopy ? header.rwSectionSize : header.gnaMemSize;
+
+        gnamem->reserve_ptr(&basePtr, gnaBytes);
+        gnamem->commit();
+        serial.ImportStructure(basePtr, zeroCopy ? graph : basePtr, header, inputStream);
+        std::copy(graph, graph + gnaBytes, reinterpret_cast<uint8_t *>(basePtr));
+
+        imported = std::make_shared<ImportedSection>();
+        if (zeroCopy) {
+            imported->file = file;
+        }
+        if (header.roChecksum != 0) {
+            imported->ptr = zeroCopy ? graph + header.rwSectionSize
+                                     : reinterpret_cast<uint8_t *>(basePtr) + header.rwSectionSize;
+            imported->size = header.gnaMemSize - header.rwSectionSize;
+            imported->checksum = header.roChecksum;
+        }
+    }
 
     ptr_inputs_global.push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + header.input.descriptor_offset));
     ptr_outputs_global.push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + header.output.descriptor_offset));
@@ -2033,6 +2094,10 @@ void GNAPlugin::Export(const std::string &fileName) {
         serial.AddState(memoryConnection.second.gna_ptr, memoryConnection.second.reserved_size);
     }
 
+    if (imported && imported->file) {
+        THROW_GNA_EXCEPTION << "Cannot export model imported with " << GNA_CONFIG_KEY(IMPORT_ZERO_COPY);
+    }
+    serial.SetReadWriteSectionSize(gnamem->getRWBytes());
     serial.Export(gnamem->getBasePtr(), gnamem->getTotalBytes(), outStream);
 }
 
@@ -2144,6 +2209,23 @@ void GNAPlugin::connectOutput(InferenceEngine::CNNLayerPtr layer, void *ptr, voi
     }
 }
 
+int GNAPlugin::componentExecutionIndex(const void *ptr) const {
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    int index = -1;
+    for (auto &&item : dnnComponentsForLayer) {
+        auto &component = item.second;
+        // activation and pooling are merged into preceding GNA layer, so they are executed at the same time
+        if (index < 0 || (component.operation != kDnnPiecewiselinearOp && component.operation != kDnnMaxPoolOp)) {
+            index++;
+        }
+        auto begin = reinterpret_cast<uintptr_t>(&component);
+        if (address >= begin && address < begin + sizeof(component)) {
+            return index;
+        }
+    }
+    return -1;
+}
+
 intel_dnn_component_t * GNAPlugin::findDnnLayer(CNNLayerPtr __layer) {
     auto component = std::find_if(begin(dnnComponentsForLayer),
                         end(dnnComponentsForLayer),
@@ -8,8 +8,10 @@
 #include "dnn.h"
 #include "gna_memory.hpp"
 #include "gna_device.hpp"
+#include "gna_model_serial.hpp"
 #include <map>
 #include <list>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <memory>
@@ -75,6 +77,7 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     bool compact_mode = true;
     bool exclusive_async_requests = false;
     bool uniformPwlDesign = false;
+    bool import_zero_copy = false;
     uint8_t gna_lib_async_threads_num = 1;
     bool gna_openmp_multithreading = false;
     // precision of GNA hardware model
@@ -170,6 +173,11 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
      */
     InferenceEngine::InputsDataMap GetInputs() {return inputsDataMap;}
     InferenceEngine::OutputsDataMap GetOutputs() {return outputsDataMap;}
+    /**
+     * @brief bytes of GNA memory taken by inputs, outputs, states and intermediate buffers,
+     * not rounded up to the page alignment of the RW section
+     */
+    size_t GetRWBytesUsed() {return gnamem ? gnamem->getRWBytesUsed() : 0;}
     /**
      * QueryState API
      * @return
@@ -345,6 +353,12 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
      */
     intel_dnn_component_t * findDnnLayer(InferenceEngine::CNNLayerPtr __layer);
 
+    /**
+     * @brief returns index of GNA layer in execution order which component owns given pointer, or -1
+     * @param ptr - address of a pointer inside dnn component
+     */
+    int componentExecutionIndex(const void *ptr) const;
+
     using allocator_type = PolymorphAllocator<uint8_t>;
     using gna_memory_type = GNAMemory<allocator_type>;
 
@@ -355,6 +369,23 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     uint32_t rwSegmentSize = 0;
     std::unique_ptr<gna_memory_type> gnamem;
 
+    /**
+     * @brief RO section of imported model, its checksum is validated once before first inference
+     */
+    struct ImportedSection {
+        /**
+         * @brief keeps file mapping alive when RO section is used directly from it
+         */
+        std::shared_ptr<GNAMappedFile> file;
+        const uint8_t *ptr = nullptr;
+        size_t size = 0;
+        uint64_t checksum = 0;
+        std::once_flag validated;
+    };
+    std::shared_ptr<ImportedSection> imported;
+
+    void ValidateImportedModel();
+
     /**
      * Connects either memory output, or generic output to a layer
      * @param layer - layer pointer
@@ -34,6 +34,11 @@ typedef struct {
     double b;
 } pwl_t;
 
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+} pwl_cache_stats_t;
+
 typedef struct {
     double slope;
     uint64_t slope_scale = 0;
@@ -68,3 +73,8 @@ void PwlDesignOpt16(const DnnActivation activation_type,
                 std::vector<intel_pwl_segment_t> &ptr_segment,
                 const float scale_in,
                 const float scale_out);
+/**
+ * @brief PwlDesignOpt16 memoizes designed segments by activation, scale factors and allowed error
+ */
+pwl_cache_stats_t PwlDesignCacheStatistics();
+void PwlDesignCacheClear();
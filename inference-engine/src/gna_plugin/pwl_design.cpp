@@ -6,7 +6,11 @@
 #include "gna_plugin_log.hpp"
 #include <vector>
 #include <algorithm>
+#include <deque>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #define FLOAT_TO_INT16(a) static_cast<int16_t>(((a) < 0)?((a) - 0.5):((a) + 0.5))
 #define FLOAT_TO_INT32(a) static_cast<int32_t>(((a) < 0)?((a)-0.5):((a)+0.5))
@@ -483,19 +487,125 @@ void make_gna_pwl(const DnnActivation  fun,
     }
 }
 
+namespace {
+
+/**
+ * @brief Process wide memo of PwlDesignOpt16 results.
+ * Segment fits depend only on the function and the allowed error, while GNA segments
+ * additionally depend on the scale factors, so both are kept: a network with many LSTM cells
+ * designs each sigmoid/tanh once, and a network reloaded with the same quantization
+ * reuses all of its segments.
+ */
+class PwlDesignCache {
+ public:
+    using SearchKey = std::tuple<int, double, double, double, double, int>;
+    using SegmentsKey = std::tuple<int, float, float, float, float>;
+
+    static PwlDesignCache & instance() {
+        static PwlDesignCache cache;
+        return cache;
+    }
+
+    std::vector<pwl_t> search(const DnnActivationType fun,
+                              const double l_bound,
+                              const double u_bound,
+                              const double threshold,
+                              const double allowed_err_pct,
+                              const int samples) {
+        SearchKey key(fun, l_bound, u_bound, threshold, allowed_err_pct, samples);
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            auto it = fits.find(key);
+            if (it != fits.end()) {
+                return it->second;
+            }
+        }
+        double err_pct = 0.0;
+        auto pwl = pwl_search(fun, l_bound, u_bound, threshold, allowed_err_pct, samples, err_pct);
+        std::lock_guard<std::mutex> lock(guard);
+        fits[key] = pwl;
+        return pwl;
+    }
+
+    bool find(const SegmentsKey &key, std::vector<intel_pwl_segment_t> &segments) {
+        std::lock_guard<std::mutex> lock(guard);
+        auto it = designs.find(key);
+        if (it == designs.end()) {
+            stats.misses++;
+            return false;
+        }
+        stats.hits++;
+        segments = it->second;
+        return true;
+    }
+
+    void insert(const SegmentsKey &key, const std::vector<intel_pwl_segment_t> &segments) {
+        std::lock_guard<std::mutex> lock(guard);
+        if (designs.count(key)) {
+            return;
+        }
+        // every loaded network may bring its own scale factors, so the oldest designs are dropped
+        if (designs.size() == kMaxDesigns) {
+            designs.erase(order.front());
+            order.pop_front();
+        }
+        designs[key] = segments;
+        order.push_back(key);
+    }
+
+    pwl_cache_stats_t statistics() {
+        std::lock_guard<std::mutex> lock(guard);
+        return stats;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(guard);
+        fits.clear();
+        designs.clear();
+        order.clear();
+        stats = pwl_cache_stats_t();
+    }
+
+ private:
+    /** fits are bounded by the set of functions, designs are bounded explicitly */
+    static constexpr size_t kMaxDesigns = 256;
+
+    std::mutex guard;
+    std::map<SearchKey, std::vector<pwl_t>> fits;
+    std::map<SegmentsKey, std::vector<intel_pwl_segment_t>> designs;
+    std::deque<SegmentsKey> order;
+    pwl_cache_stats_t stats = {};
+};
+
+}  // namespace
+
+pwl_cache_stats_t PwlDesignCacheStatistics() {
+    return PwlDesignCache::instance().statistics();
+}
+
+void PwlDesignCacheClear() {
+    PwlDesignCache::instance().clear();
+}
+
 void PwlDesignOpt16(const DnnActivation activation_type,
                     std::vector<intel_pwl_segment_t> &ptr_segment,
                     const float scale_in,
                     const float scale_out) {
+    auto &cache = PwlDesignCache::instance();
+    PwlDesignCache::SegmentsKey key(activation_type.type, activation_type.negative_slope,
+                                    scale_in, scale_out, PWL_MAX_ERR_PERCENT);
+    if (cache.find(key, ptr_segment)) {
+        return;
+    }
+
     std::vector<pwl_t> pwl;
-    double err_pct = 0.0;
     switch (activation_type) {
         case kActSigmoid:
-            pwl = pwl_search(kActSigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = cache.search(kActSigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES);
             make_gna_pwl(activation_type, pwl, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActTanh:
-            pwl = pwl_search(kActTanh, -TANH_DOMAIN, TANH_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = cache.search(kActTanh, -TANH_DOMAIN, TANH_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES);
             make_gna_pwl(activation_type, pwl, -TANH_DOMAIN, TANH_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActRelu:
@@ -511,8 +621,9 @@ void PwlDesignOpt16(const DnnActivation activation_type,
             make_gna_pwl(activation_type, pwl, KALDI_LSTM_CLIP_LOWER, KALDI_LSTM_CLIP_UPPER, scale_in, scale_out, ptr_segment);
             break;
         default:
-            break;
+            return;
     }
+    cache.insert(key, ptr_segment);
 }
 
 void PwlDesign16(const DnnActivation activation_type,
@@ -15,6 +15,7 @@
 #include "precision_ex.hpp"
 #include "pwl.h"
 #include "gna_layer_info.hpp"
+#include "gna_plugin_log.hpp"
 
 namespace GNAPluginNS {
 namespace details {
@@ -209,6 +210,7 @@ inline void quantizeWeightsBiases(const QuantDesc & quantDesc,
     // TODO: replace this into fixed scale quantizer then
 
     auto quantData = InferenceEngine::getInjectedData<QuantizedLayerParams>(*wl);
+    quantization_stats_t stats = {};
     {
         fnc(wl->_weights->buffer().as<float *>(),
             wl->_biases ? wl->_biases->buffer().as<float *>() : nullptr,
@@ -220,7 +222,13 @@ inline void quantizeWeightsBiases(const QuantDesc & quantDesc,
             num_rows,
             num_columns,
             num_rows_padded,
-            num_columns_padded);
+            num_columns_padded,
+            &stats);
+    }
+    if (stats.num_weights_saturated + stats.num_biases_saturated > 0) {
+        gnalog() << wl->name << ": " << stats.num_weights_saturated << " / " << stats.num_weights
+                 << " weights and " << stats.num_biases_saturated << " / " << stats.num_biases
+                 << " biases saturated\n";
     }
     wl->_weights = intWeights;
     wl->_biases = intBiases;
@@ -304,6 +312,7 @@ inline void quantizeWeightsBiasesConv(const QuantDesc & quantDesc,
     // TODO: replace this into fixed scale quantizer then
 
     auto quantData = InferenceEngine::getInjectedData<QuantizedLayerParams>(*conv);
+    quantization_stats_t stats = {};
     {
         fnc(conv->_weights->buffer().as<float *>(),
             conv->_biases ? conv->_biases->buffer().as<float *>() : nullptr,
@@ -315,7 +324,13 @@ inline void quantizeWeightsBiasesConv(const QuantDesc & quantDesc,
             num_rows,
             num_columns,
             num_rows_padded,
-            num_columns_padded);
+            num_columns_padded,
+            &stats);
+    }
+    if (stats.num_weights_saturated + stats.num_biases_saturated > 0) {
+        gnalog() << conv->name << ": " << stats.num_weights_saturated << " / " << stats.num_weights
+                 << " weights and " << stats.num_biases_saturated << " / " << stats.num_biases
+                 << " biases saturated\n";
     }
     conv->_weights = intWeights;
     conv->_biases = intBiases;
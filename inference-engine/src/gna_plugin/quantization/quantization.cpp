@@ -2,10 +2,168 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <vector>
+#include <ie_parallel.hpp>
 #include "quantization.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GNA_QUANTIZATION_SSE2
+#endif
+
+namespace {
+
+/**
+ * @brief largest absolute value of the array, rows are split between threads
+ */
+float MaxAbsValue(const float *ptr_float_memory, size_t num_elements) {
+    std::vector<float> partial_max(parallel_get_max_threads(), 0.0f);
+    InferenceEngine::parallel_nt(parallel_get_max_threads(), [&](int ithr, int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(num_elements, nthr, ithr, start, end);
+        float max = 0.0f;
+        for (size_t i = start; i < end; i++) {
+            max = std::max(max, std::fabs(ptr_float_memory[i]));
+        }
+        partial_max[ithr] = max;
+    });
+    return *std::max_element(partial_max.begin(), partial_max.end());
+}
+
+#ifdef GNA_QUANTIZATION_SSE2
+inline uint32_t CountBits4(int mask) {
+    static const uint8_t bits[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+    return bits[mask & 0xF];
+}
+
+/**
+ * @brief w * scale rounded half away from zero and clamped to [min_value, max_value], NaN becomes 0
+ * @return value, number of saturated lanes is added to num_saturate
+ */
+inline __m128 ScaleRoundClamp(__m128 w, __m128 scale, __m128 min_value, __m128 max_value, uint32_t &num_saturate) {
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    // +0.5 for positive weights, -0.5 otherwise - same as the scalar code
+    __m128 rounding = _mm_or_ps(half, _mm_andnot_ps(_mm_cmpgt_ps(w, _mm_setzero_ps()), sign));
+    __m128 value = _mm_add_ps(_mm_mul_ps(w, scale), rounding);
+    num_saturate += CountBits4(_mm_movemask_ps(_mm_or_ps(_mm_cmpgt_ps(value, max_value),
+                                                         _mm_cmplt_ps(value, min_value))));
+    value = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+    return _mm_min_ps(_mm_max_ps(value, min_value), max_value);
+}
+#endif
+
+template <class T>
+inline T ScaleRoundClamp(float w, float scale, uint32_t &num_saturate) {
+    float rounding_value = (w > 0) ? 0.5f : -0.5f;
+    float value = w * scale + rounding_value;
+    if (value > std::numeric_limits<T>::max()) {
+        num_saturate++;
+        return std::numeric_limits<T>::max();
+    }
+    if (value < std::numeric_limits<T>::min()) {
+        num_saturate++;
+        return std::numeric_limits<T>::min();
+    }
+    return value == value ? static_cast<T>(value) : 0;
+}
+
+/**
+ * @brief quantizes one row of weights and zeroes its padding
+ * @return number of saturated weights
+ */
+uint32_t QuantizeRow(const float *ptr_float, int16_t *ptr_int, uint32_t num_columns, uint32_t num_columns_padded,
+                     float scale_factor) {
+    uint32_t num_saturate = 0;
+    uint32_t col = 0;
+#ifdef GNA_QUANTIZATION_SSE2
+    const __m128 scale = _mm_set1_ps(scale_factor);
+    const __m128 min_value = _mm_set1_ps(-32768.0f);
+    const __m128 max_value = _mm_set1_ps(32767.0f);
+    for (; col + 8 <= num_columns; col += 8) {
+        __m128 lo = ScaleRoundClamp(_mm_loadu_ps(ptr_float + col), scale, min_value, max_value, num_saturate);
+        __m128 hi = ScaleRoundClamp(_mm_loadu_ps(ptr_float + col + 4), scale, min_value, max_value, num_saturate);
+        __m128i packed = _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr_int + col), packed);
+    }
+#endif
+    for (; col < num_columns; col++) {
+        ptr_int[col] = ScaleRoundClamp<int16_t>(ptr_float[col], scale_factor, num_saturate);
+    }
+    std::fill(ptr_int + num_columns, ptr_int + num_columns_padded, 0);
+    return num_saturate;
+}
+
+uint32_t QuantizeRow(const float *ptr_float, int8_t *ptr_int, uint32_t num_columns, uint32_t num_columns_padded,
+                     float scale_factor) {
+    uint32_t num_saturate = 0;
+    uint32_t col = 0;
+#ifdef GNA_QUANTIZATION_SSE2
+    const __m128 scale = _mm_set1_ps(scale_factor);
+    const __m128 min_value = _mm_set1_ps(-128.0f);
+    const __m128 max_value = _mm_set1_ps(127.0f);
+    for (; col + 8 <= num_columns; col += 8) {
+        __m128 lo = ScaleRoundClamp(_mm_loadu_ps(ptr_float + col), scale, min_value, max_value, num_saturate);
+        __m128 hi = ScaleRoundClamp(_mm_loadu_ps(ptr_float + col + 4), scale, min_value, max_value, num_saturate);
+        __m128i packed = _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(ptr_int + col), _mm_packs_epi16(packed, packed));
+    }
+#endif
+    for (; col < num_columns; col++) {
+        ptr_int[col] = ScaleRoundClamp<int8_t>(ptr_float[col], scale_factor, num_saturate);
+    }
+    std::fill(ptr_int + num_columns, ptr_int + num_columns_padded, 0);
+    return num_saturate;
+}
+
+/**
+ * @brief quantizes rows in parallel and zeroes padding rows
+ * @return number of saturated weights
+ */
+template <class T, class RowScale>
+uint32_t QuantizeWeights(const float *ptr_float_weights, T *ptr_int_weights, uint32_t num_rows, uint32_t num_columns,
+                         uint32_t num_rows_padded, uint32_t num_columns_padded, const RowScale &row_scale) {
+    uint32_t num_saturate = 0;
+    num_saturate = InferenceEngine::parallel_sum(num_rows, num_saturate, [&](uint32_t row) -> uint32_t {
+        return QuantizeRow(ptr_float_weights + static_cast<size_t>(row) * num_columns,
+                           ptr_int_weights + static_cast<size_t>(row) * num_columns_padded,
+                           num_columns, num_columns_padded, row_scale(row));
+    });
+    std::fill(ptr_int_weights + static_cast<size_t>(num_rows) * num_columns_padded,
+              ptr_int_weights + static_cast<size_t>(num_rows_padded) * num_columns_padded, 0);
+    return num_saturate;
+}
+
+int32_t QuantizeBias(float bias, float scale_factor, uint32_t &num_saturate) {
+    float rounding_value = (bias > 0) ? 0.5f : -0.5f;
+    float value = bias * scale_factor + rounding_value;
+    if (value > 2147483647.0) {
+        num_saturate++;
+        return 2147483647L;
+    } else if (value < -2147483648.0) {
+        num_saturate++;
+        return -2147483648LL;
+    }
+    return static_cast<int32_t>(value);
+}
+
+void UpdateStats(quantization_stats_t *ptr_stats, uint32_t num_weights, uint32_t num_weights_saturated,
+                 uint32_t num_biases, uint32_t num_biases_saturated) {
+    if (ptr_stats != nullptr) {
+        ptr_stats->num_weights = num_weights;
+        ptr_stats->num_weights_saturated = num_weights_saturated;
+        ptr_stats->num_biases = num_biases;
+        ptr_stats->num_biases_saturated = num_biases_saturated;
+    }
+}
+
+}  // namespace
+
 void QuantizeAffine16(float *ptr_float_weights,
                       float *ptr_float_biases,
                       int16_t *ptr_int_weights,
@@ -16,87 +174,36 @@ void QuantizeAffine16(float *ptr_float_weights,
                       uint32_t num_rows,
                       uint32_t num_columns,
                       uint32_t num_rows_padded,
-                      uint32_t num_columns_padded) {
-    uint32_t num_saturate = 0;
-
+                      uint32_t num_columns_padded,
+                      quantization_stats_t *ptr_stats) {
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i * num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsValue(ptr_float_weights, static_cast<size_t>(num_rows) * num_columns);
 
         *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_2B_WEIGHT) / max_weight;
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
 
-    for (uint32_t row = 0; row < num_rows; row++) {
-        for (uint32_t col = 0; col < num_columns; col++) {
-            float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-            float value = ptr_float_weights[row * num_columns + col] * *ptr_weight_scale_factor + rounding_value;
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            if (value > 32767.0) {
-                *ptr_weight_16 = 32767;
-                num_saturate++;
-            } else if (value < -32768.0) {
-                *ptr_weight_16 = -32768;
-                num_saturate++;
-            } else {
-                *ptr_weight_16 = (int16_t) value;
-            }
-        }
-        for (uint32_t col = num_columns; col < num_columns_padded; col++) {
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_16 = 0;
-        }
-    }
-    for (uint32_t row = num_rows; row < num_rows_padded; row++) {
-        for (uint32_t col = 0; col < num_columns_padded; col++) {
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_16 = 0;
-        }
-    }
+    const float weight_scale_factor = *ptr_weight_scale_factor;
+    uint32_t num_weights_saturated = QuantizeWeights(ptr_float_weights, ptr_int_weights,
+                                                     num_rows, num_columns, num_rows_padded, num_columns_padded,
+                                                     [weight_scale_factor](uint32_t) { return weight_scale_factor; });
 
     // case for element wise layer
+    uint32_t num_biases_saturated = 0;
     if (ptr_float_biases != nullptr && ptr_int_biases != nullptr) {
         for (uint32_t j = 0; j < num_rows; j++) {
-            float rounding_value = (ptr_float_biases[j] > 0) ? 0.5f : -0.5f;
-            float value = ptr_float_biases[j] * *ptr_output_scale_factor + rounding_value;
-            if (value > 2147483647.0) {
-                ptr_int_biases[j] = 2147483647L;
-                num_saturate++;
-            } else if (value < -2147483648.0) {
-                ptr_int_biases[j] = -2147483648LL;
-                num_saturate++;
-            } else {
-                ptr_int_biases[j] = (int32_t) value;
-            }
+            ptr_int_biases[j] = QuantizeBias(ptr_float_biases[j], *ptr_output_scale_factor, num_biases_saturated);
         }
         for (uint32_t j = num_rows; j < num_rows_padded; j++) {
             ptr_int_biases[j] = 0;
         }
     }
 
-    if (num_saturate > 0) {
+    UpdateStats(ptr_stats, num_rows * num_columns, num_weights_saturated, num_rows, num_biases_saturated);
+    if (num_weights_saturated + num_biases_saturated > 0) {
         QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine16()\n",
-                     num_saturate,
+                     num_weights_saturated + num_biases_saturated,
                      num_rows * num_columns + num_rows);
     }
 }
@@ -111,54 +218,26 @@ void FixedQuantizeAffine16(float *ptr_float_weights,
                            uint32_t num_rows,
                            uint32_t num_columns,
                            uint32_t num_rows_padded,
-                           uint32_t num_columns_padded) {
-    uint32_t num_saturate = 0;
-
-    for (uint32_t row = 0; row < num_rows; row++) {
-        for (uint32_t col = 0; col < num_columns; col++) {
-            float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-            float value = ptr_float_weights[row * num_columns + col] * weight_scale_factor + rounding_value;
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            if (value > 32767.0) {
-                *ptr_weight_16 = 32767;
-                num_saturate++;
-            } else if (value < -32768.0) {
-                *ptr_weight_16 = -32768;
-                num_saturate++;
-            } else {
-                *ptr_weight_16 = (int16_t) value;
-            }
-        }
-    }
-    for (uint32_t row = num_rows; row < num_rows_padded; row++) {
-        for (uint32_t col = 0; col < num_columns_padded; col++) {
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_16 = 0;
-        }
-    }
+                           uint32_t num_columns_padded,
+                           quantization_stats_t *ptr_stats) {
+    uint32_t num_weights_saturated = QuantizeWeights(ptr_float_weights, ptr_int_weights,
+                                                     num_rows, num_columns, num_rows_padded, num_columns_padded,
+                                                     [weight_scale_factor](uint32_t) { return weight_scale_factor; });
 
     *ptr_output_scale_factor = input_scale_factor * weight_scale_factor;
 
+    uint32_t num_biases_saturated = 0;
     for (uint32_t j = 0; j < num_rows; j++) {
-        float rounding_value = (ptr_float_biases[j] > 0) ? 0.5f : -0.5f;
-        float value = ptr_float_biases[j] * *ptr_output_scale_factor + rounding_value;
-        if (value > 2147483647.0) {
-            ptr_int_biases[j] = 2147483647L;
-            num_saturate++;
-        } else if (value < -2147483648.0) {
-            ptr_int_biases[j] = -2147483648LL;
-            num_saturate++;
-        } else {
-            ptr_int_biases[j] = (int32_t) value;
-        }
+        ptr_int_biases[j] = QuantizeBias(ptr_float_biases[j], *ptr_output_scale_factor, num_biases_saturated);
     }
     for (uint32_t j = num_rows; j < num_rows_padded; j++) {
         ptr_int_biases[j] = 0;
     }
 
-    if (num_saturate > 0) {
+    UpdateStats(ptr_stats, num_rows * num_columns, num_weights_saturated, num_rows, num_biases_saturated);
+    if (num_weights_saturated + num_biases_saturated > 0) {
         QUANTWARNING("Warning:  %d / %d saturations in FixedQuantizeAffine16()\n",
-                     num_saturate,
+                     num_weights_saturated + num_biases_saturated,
                      num_rows * num_columns + num_rows);
     }
 }
@@ -495,32 +574,11 @@ void QuantizeAffine8(float *ptr_float_weights, float *ptr_float_biases,
                      int8_t *ptr_int_weights, intel_compound_bias_t *ptr_int_biases,
                      float input_scale_factor, float *ptr_weight_scale_factor,
                      float *ptr_output_scale_factor, uint32_t num_rows, uint32_t num_columns,
-                     uint32_t num_rows_padded, uint32_t num_columns_padded) {
-    uint32_t num_saturate = 0;
-
+                     uint32_t num_rows_padded, uint32_t num_columns_padded,
+                     quantization_stats_t *ptr_stats) {
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i*num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsValue(ptr_float_weights, static_cast<size_t>(num_rows) * num_columns);
 
         *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_1B_WEIGHT) / max_weight;
 
@@ -532,68 +590,37 @@ void QuantizeAffine8(float *ptr_float_weights, float *ptr_float_biases,
         *ptr_weight_scale_factor = MAX_OUT_MULTIPLIER * *ptr_weight_scale_factor;  //  increase dynamic range by max multiplier
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
-    float valueAcc = 0.0;
-    for (uint32_t row = 0; row < num_rows; row++) {
+
+    const float weight_scale_factor = *ptr_weight_scale_factor;
+    auto row_scale = [&](uint32_t row) {
         float scaled_row_max = 0;
-        float rounding_value, value;
+        const float *ptr_row = ptr_float_weights + static_cast<size_t>(row) * num_columns;
         for (uint32_t col = 0; col < num_columns; col++) {
-            value = ptr_float_weights[row*num_columns + col] * *ptr_weight_scale_factor;
-            valueAcc += value;
-            if (fabs(value) > scaled_row_max) {
-                scaled_row_max = fabs(value);
-            }
+            scaled_row_max = std::max(scaled_row_max, std::fabs(ptr_row[col] * weight_scale_factor));
         }
-
-        value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
+        float value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
         ptr_int_biases[row].multiplier = (uint8_t) (value + 0.5);
-        for (uint32_t col = 0; col < num_columns; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row*num_columns_padded + col);
-            rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-
-
-            value = ptr_float_weights[row*num_columns + col] * (*ptr_weight_scale_factor / ptr_int_biases[row].multiplier) + rounding_value;
-            if (value > 127.0) {
-                *ptr_weight_8 = 127;
-                num_saturate++;
-            } else if (value < -128.0) {
-                *ptr_weight_8 = -128;
-                num_saturate++;
-            } else {
-                *ptr_weight_8 = (int8_t)value;
-            }
-        }
-        for (uint32_t col = num_columns; col < num_columns_padded; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row*num_columns_padded + col);
-            *ptr_weight_8 = 0;
-        }
-    }
+        return weight_scale_factor / ptr_int_biases[row].multiplier;
+    };
+    uint32_t num_weights_saturated = QuantizeWeights(ptr_float_weights, ptr_int_weights,
+                                                     num_rows, num_columns, num_rows_padded, num_columns_padded,
+                                                     row_scale);
     for (uint32_t row = num_rows; row < num_rows_padded; row++) {
-        for (uint32_t col = 0; col < num_columns_padded; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row*num_columns_padded + col);
-            *ptr_weight_8 = 0;
-        }
         ptr_int_biases[row].multiplier = 0;
     }
 
     // bias value of the bas will be only used when input bias provided
+    uint32_t num_biases_saturated = 0;
     if (ptr_float_biases != nullptr) {
         for (uint32_t j = 0; j < num_rows; j++) {
-            float rounding_value = (ptr_float_biases[j] > 0) ? 0.5f : -0.5f;
-            float value = ptr_float_biases[j] * *ptr_output_scale_factor + rounding_value;
-            if (value > 2147483647.0) {
-                ptr_int_biases[j].bias = 2147483647L;
-                num_saturate++;
-            } else if (value < -2147483648.0) {
-                ptr_int_biases[j].bias = -2147483648LL;
-                num_saturate++;
-            } else {
-                ptr_int_biases[j].bias = (int32_t) value;
-            }
+            ptr_int_biases[j].bias = QuantizeBias(ptr_float_biases[j], *ptr_output_scale_factor, num_biases_saturated);
         }
     }
 
-    if (num_saturate > 0) {
-        QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine8()\n", num_saturate, num_rows * num_columns + num_rows);
+    UpdateStats(ptr_stats, num_rows * num_columns, num_weights_saturated, num_rows, num_biases_saturated);
+    if (num_weights_saturated + num_biases_saturated > 0) {
+        QUANTWARNING("Warning:  %d / %d saturations in QuantizeAffine8()\n",
+                     num_weights_saturated + num_biases_saturated, num_rows * num_columns + num_rows);
     }
 }
 
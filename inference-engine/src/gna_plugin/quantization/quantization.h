@@ -20,6 +20,16 @@
 #define QUANTWARNING(...)
 #endif
 
+/**
+ * @brief number of values quantized by an affine quantization call and how many of them were clamped
+ */
+typedef struct {
+    uint32_t num_weights;
+    uint32_t num_weights_saturated;
+    uint32_t num_biases;
+    uint32_t num_biases_saturated;
+} quantization_stats_t;
+
 void QuantizeAffine16(float *ptr_float_weights,
                       float *ptr_float_biases,
                       int16_t *ptr_int_weights,
@@ -30,7 +40,8 @@ void QuantizeAffine16(float *ptr_float_weights,
                       uint32_t num_rows,
                       uint32_t num_columns,
                       uint32_t num_rows_padded,
-                      uint32_t num_columns_padded);
+                      uint32_t num_columns_padded,
+                      quantization_stats_t *ptr_stats = nullptr);
 void FixedQuantizeAffine16(float *ptr_float_weights,
                            float *ptr_float_biases,
                            int16_t *ptr_int_weights,
@@ -41,7 +52,8 @@ void FixedQuantizeAffine16(float *ptr_float_weights,
                            uint32_t num_rows,
                            uint32_t num_columns,
                            uint32_t num_rows_padded,
-                           uint32_t num_columns_padded);
+                           uint32_t num_columns_padded,
+                           quantization_stats_t *ptr_stats = nullptr);
 float ScaleFactorForQuantization(void *ptr_float_memory, float target_max, size_t num_elements);
 float ScaleFactorForQuantization(std::vector<std::vector<float>> &input_vectors, float target_max);
 float ScaleFactorForQuantization(std::vector<std::vector<float>> &input_vectors,
@@ -90,7 +102,8 @@ void DeQuantizeVector32(int32_t *ptr_int_memory,
 
 void QuantizeAffine8(float *ptr_float_weights, float *ptr_float_biases, int8_t *ptr_int_weights, intel_compound_bias_t *ptr_int_biases,
                      float input_scale_factor, float *ptr_weight_scale_factor, float *ptr_output_scale_factor,
-                     uint32_t num_rows, uint32_t num_columns, uint32_t num_rows_padded, uint32_t num_columns_padded);
+                     uint32_t num_rows, uint32_t num_columns, uint32_t num_rows_padded, uint32_t num_columns_padded,
+                     quantization_stats_t *ptr_stats = nullptr);
 void QuantizeBias8(float *ptr_float_biases, intel_compound_bias_t  *ptr_int_biases, float input_scale_factor,
                    float weight_scale_factor, float *ptr_output_scale_factor, uint32_t num_rows);
 bool IntegrityCheckAffine8(float *ptr_float_weights, float *ptr_float_biases, int8_t *ptr_int_weights, intel_compound_bias_t *ptr_int_biases,
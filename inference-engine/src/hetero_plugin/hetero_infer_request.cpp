@@ -97,7 +97,11 @@ void HeteroInferRequest::updateInOutIfNeeded() {
             if (iti != _inputs.end()) {
                 auto it = _preProcData.find(ioname);
                 if (it != _preProcData.end()) {
-                    if (it->second.getRoiBlob() != _blobs[ioname]) {
+                    if (!it->second.getRois().empty()) {
+                        // the regions may have changed for the same frame
+                        r->SetBlob(ioname, it->second.getRoiBlob(), it->second.getRois());
+                        _blobs[ioname] = iti->second;
+                    } else if (it->second.getRoiBlob() != _blobs[ioname]) {
                         r->SetBlob(ioname.c_str(), it->second.getRoiBlob());
                         _blobs[ioname] = iti->second;
                     }
@@ -7,6 +7,12 @@
 #ifdef HAVE_SSE
 #include "blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "blob_transform_avx512.hpp"
+#endif
 
 #include <cstdint>
 #include <cstdlib>
@@ -15,6 +21,56 @@
 
 namespace InferenceEngine {
 
+// NHWC <-> NCHW copy of 3 channels with the kernels of an ISA namespace, the widest ISA the CPU supports goes first
+#define BLOB_COPY_4D_C3_SIMD(ISA, WITH_ISA) \
+    if (src->layout() == NHWC && dst->layout() == NCHW && C == 3                    \
+        && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 &&           \
+        WITH_ISA()) {                                                               \
+        if (PRC == Precision::U8) {                                                 \
+            ISA::blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), \
+                                         reinterpret_cast<      uint8_t*>(dst_ptr), \
+                                         N_src_stride, H_src_stride,                \
+                                         N_dst_stride, H_dst_stride, C_dst_stride,  \
+                                         static_cast<int>(N), static_cast<int>(H),  \
+                                         static_cast<int>(W));                      \
+            return;                                                                 \
+        }                                                                           \
+                                                                                    \
+        if (PRC == Precision::FP32) {                                               \
+            ISA::blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr),  \
+                                          reinterpret_cast<      float*>(dst_ptr),  \
+                                          N_src_stride, H_src_stride,               \
+                                          N_dst_stride, H_dst_stride, C_dst_stride, \
+                                          static_cast<int>(N), static_cast<int>(H), \
+                                          static_cast<int>(W));                     \
+            return;                                                                 \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    if (src->layout() == NCHW && dst->layout() == NHWC && C == 3 &&                 \
+        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 &&              \
+        WITH_ISA()) {                                                               \
+        if (PRC == Precision::U8) {                                                 \
+            ISA::blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), \
+                                         reinterpret_cast<      uint8_t*>(dst_ptr), \
+                                         N_src_stride, H_src_stride, C_src_stride,  \
+                                         N_dst_stride, H_dst_stride,                \
+                                         static_cast<int>(N), static_cast<int>(H),  \
+                                         static_cast<int>(W));                      \
+            return;                                                                 \
+        }                                                                           \
+                                                                                    \
+        if (PRC == Precision::FP32) {                                               \
+            ISA::blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),  \
+                                          reinterpret_cast<      float*>(dst_ptr),  \
+                                          N_src_stride, H_src_stride, C_src_stride, \
+                                          N_dst_stride, H_dst_stride,               \
+                                          static_cast<int>(N), static_cast<int>(H), \
+                                          static_cast<int>(W));                     \
+            return;                                                                 \
+        }                                                                           \
+    }
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -48,54 +104,16 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
 
     src_ptr += dst_blk_desc.getOffsetPadding();
 
-#ifdef HAVE_SSE
-    if (src->layout() == NHWC && dst->layout() == NCHW && C == 3
-        && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 &&
-        with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<      uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride,
-                                    N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<      float*>(dst_ptr),
-                                     N_src_stride, H_src_stride,
-                                     N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
+#ifdef HAVE_AVX512
+    BLOB_COPY_4D_C3_SIMD(avx512, with_cpu_x86_avx512_core)
+#endif
 
-    if (src->layout() == NCHW && dst->layout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 &&
-        with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<      uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride,
-                                    N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
+#ifdef HAVE_AVX2
+    BLOB_COPY_4D_C3_SIMD(avx2, with_cpu_x86_avx2)
+#endif
 
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<      float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride,
-                                     N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
+#ifdef HAVE_SSE
+    BLOB_COPY_4D_C3_SIMD(InferenceEngine, with_cpu_x86_sse42)
 #endif  // HAVE_SSE
 
     if (src->layout() == NHWC && dst->layout() == NCHW) {
@@ -135,6 +153,8 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     }
 }
 
+#undef BLOB_COPY_4D_C3_SIMD
+
 static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->precision()) {
         case Precision::FP32:
@@ -8,6 +8,7 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <algorithm>
 #include <utility>
 #include <memory>
 #include <vector>
@@ -36,24 +37,23 @@ Builder::Network::Network(const ICNNNetwork &network): Builder::Network(Context(
 Builder::Network::Network(const Context& ieContext, const std::string &name): ctx(ieContext), name(name), version(3) {}
 
 Builder::Network::Network(const Context& ieContext, const INetwork &network): ctx(ieContext), name(network.getName()), version(3) {
+    std::unordered_set<Connection, details::ConnectionHash> addedConnections;
     for (const auto& layer : network) {
         layers.push_back(Layer(layer));
         const auto layerConnections = network.getLayerConnections(layer->getId());
         for (const auto& connection : layerConnections) {
-            bool found = false;
-            for (const auto& con : connections) {
-                if (con == connection) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                connections.push_back(connection);
-            }
+            if (addedConnections.insert(connection).second)
+                connect(connection.from(), connection.to());
         }
     }
 }
 
+Builder::Network::Network(const Network& network): ctx(network.ctx), version(network.version), name(network.name),
+                                                    layers(network.layers) {
+    for (const auto& connection : network.connections)
+        connect(connection.from(), connection.to());
+}
+
 Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network): ctx(ieContext), name(network.getName()), version(0) {
     auto allInputs = CNNNetGetAllInputLayers(network);
     InputsDataMap inputs;
@@ -97,7 +97,7 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network):
     };
 
     auto addPreProcessFor = [&](const InputInfo::Ptr& inputInfo) {
-        auto inputLayer = getLayer(name2id[inputInfo->name()]);
+        auto inputLayer = static_cast<const Network*>(this)->getLayer(name2id[inputInfo->name()]);
         if (inputLayer.getType().empty() && inputLayer.getName().empty())
             return;
 
@@ -276,8 +276,8 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network):
             count_out++;
         }
     }
-    while (!queueLayers.empty()) {
-        auto cnnLayerPtr = *queueLayers.begin();
+    for (size_t i = 0; i < queueLayers.size(); i++) {
+        auto cnnLayerPtr = queueLayers[i];
 
         if (name2id.find(cnnLayerPtr->name) == name2id.end()) {
             createGenericFromCNNLayer(cnnLayerPtr);
@@ -288,8 +288,6 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network):
                 }
             }
         }
-
-        queueLayers.erase(queueLayers.begin());
     }
     std::map<std::string, DataPtr> output;
     network.getOutputsInfo(output);
@@ -299,7 +297,7 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network):
         if (name2id.find(creator->name) == name2id.end())
             THROW_IE_EXCEPTION << "Cannot find output layer " << creator->name;
 
-        auto lastLayer = getLayer(name2id[creator->name]);
+        auto lastLayer = static_cast<const Network*>(this)->getLayer(name2id[creator->name]);
         if (lastLayer.getName() == "" && lastLayer.getType().empty())
             THROW_IE_EXCEPTION << "Cannot find output layer " << creator->name;
 
@@ -318,7 +316,7 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network):
             }
         }
 
-        connections.push_back(Connection({lastLayer.getId(), inIdx}, {outLayerId}));
+        connect({lastLayer.getId(), inIdx}, {outLayerId});
     }
 
     for (const auto dataPtr : dataPtrs) {
@@ -349,7 +347,7 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network):
                     break;
                 }
             }
-            connections.push_back(Connection({name2id[cnnInputLayer->name], inIdx}, {name2id[it.second->name], outIdx}));
+            connect({name2id[cnnInputLayer->name], inIdx}, {name2id[it.second->name], outIdx});
         }
     }
 
@@ -359,6 +357,7 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork &network):
 }
 
 std::vector<Builder::Layer>& Builder::Network::getLayers() {
+    layersGivenAway = true;
     return layers;
 }
 
@@ -375,69 +374,115 @@ idx_t Builder::Network::addLayer(const std::vector<PortInfo> &inputs,
     return layer_id;
 }
 
-idx_t Builder::Network::addLayer(const Layer& layer) {
-    auto getAvailableId = [&](idx_t defaultId) {
-        if (defaultId == (std::numeric_limits<idx_t>::max)())
-            defaultId = 0;
-
-        auto it = layers.begin();
-        while (it != layers.end()) {
-            for (it = layers.begin(); it != layers.end(); it++) {
-                if (it->getId() == defaultId) {
-                    defaultId++;
-                    break;
-                }
-            }
-        }
-        return defaultId;
-    };
-    auto generateAvailableName = [&](const std::string& name, idx_t id) {
-        const std::string idName = "id" + std::to_string(id);
-        std::string generatedName(name);
-        if (generatedName.empty())
-            generatedName = idName;
-        bool nameIsUnique(false);
-        while (!nameIsUnique) {
-            nameIsUnique = true;
-            for (const auto& layer : layers) {
-                if (generatedName == layer.getName()) {
-                    nameIsUnique = false;
-                    generatedName += "_" + idName;
-                }
-            }
+void Builder::Network::indexLayers(bool force) const {
+    if (!force && indexedLayers == layers.size())
+        return;
+    layerIndex.clear();
+    nameIndex.clear();
+    freeId = 0;
+    for (size_t i = 0; i < layers.size(); i++) {
+        layerIndex.emplace(layers[i].getId(), i);
+        nameIndex.emplace(layers[i].getName(), layers[i].getId());
+    }
+    indexedLayers = layers.size();
+}
+
+const Builder::Layer* Builder::Network::findLayer(idx_t layerId) const {
+    indexLayers();
+    auto it = layerIndex.find(layerId);
+    if (it != layerIndex.end() && (it->second >= layers.size() || layers[it->second].getId() != layerId)) {
+        indexLayers(true);
+        it = layerIndex.find(layerId);
+    }
+    return it == layerIndex.end() ? nullptr : &layers[it->second];
+}
+
+bool Builder::Network::isNameUsed(const std::string& layerName) const {
+    indexLayers();
+    auto it = nameIndex.find(layerName);
+    if (it != nameIndex.end()) {
+        const Layer* layer = findLayer(it->second);
+        if (layer && layer->getName() == layerName)
+            return true;
+        // The layer was renamed or removed
+        nameIndex.erase(it);
+    }
+    // A layer given away by getLayer()/getLayers() may have been renamed to this name
+    if (!layersGivenAway)
+        return false;
+    for (const auto& layer : layers) {
+        if (layer.getName() == layerName) {
+            nameIndex[layerName] = layer.getId();
+            return true;
         }
-        return generatedName;
-    };
-    idx_t generatedId = getAvailableId(layer.getId());
-    const auto name = generateAvailableName(layer.getName(), generatedId);
+    }
+    return false;
+}
+
+idx_t Builder::Network::addLayer(const Layer& layer) {
+    indexLayers();
+    idx_t generatedId = layer.getId();
+    if (generatedId == (std::numeric_limits<idx_t>::max)())
+        generatedId = 0;
+    const bool fromFreeId = generatedId <= freeId;
+    generatedId = (std::max)(generatedId, freeId);
+    while (findLayer(generatedId))
+        generatedId++;
+    if (fromFreeId)
+        freeId = generatedId + 1;
+
+    const std::string idName = "id" + std::to_string(generatedId);
+    std::string generatedName = layer.getName().empty() ? idName : layer.getName();
+    while (isNameUsed(generatedName))
+        generatedName += "_" + idName;
+
     layers.emplace_back(generatedId, layer);
-    layers[layers.size() - 1].getName() = name;
+    layers.back().getName() = generatedName;
+    layerIndex[generatedId] = layers.size() - 1;
+    nameIndex[generatedName] = generatedId;
+    indexedLayers = layers.size();
     return generatedId;
 }
 
 void Builder::Network::connect(const PortInfo& input, const PortInfo& output) {
-    connections.emplace_back(input, output);
+    auto connection = connections.emplace(connections.end(), input, output);
+    connectionIndex[input.layerId()].push_back(connection);
+    if (output.layerId() != input.layerId())
+        connectionIndex[output.layerId()].push_back(connection);
 }
 
 void Builder::Network::removeLayer(idx_t layerId) {
-    auto it = layers.begin();
-    for (; it != layers.end(); it++) {
-        if (it->getId() == layerId) {
-            break;
-        }
-    }
-    if (it != layers.end())
-        layers.erase(it);
+    const Layer* layer = findLayer(layerId);
+    if (!layer)
+        return;
+    auto name = nameIndex.find(layer->getName());
+    if (name != nameIndex.end() && name->second == layerId)
+        nameIndex.erase(name);
+
+    size_t position = layerIndex[layerId];
+    layers.erase(layers.begin() + position);
+    layerIndex.erase(layerId);
+    for (size_t i = position; i < layers.size(); i++)
+        layerIndex[layers[i].getId()] = i;
+    indexedLayers = layers.size();
+    freeId = (std::min)(freeId, layerId);
 }
 
 void Builder::Network::disconnect(const Connection& connection) {
-    auto it = connections.begin();
-    for (; it != connections.end(); it++) {
-        if (connection == *it)
-            break;
+    auto fromConnections = connectionIndex.find(connection.from().layerId());
+    if (fromConnections == connectionIndex.end())
+        return;
+    auto it = std::find_if(fromConnections->second.begin(), fromConnections->second.end(),
+                           [&](const std::list<Connection>::iterator& con) { return *con == connection; });
+    if (it == fromConnections->second.end())
+        return;
+    auto con = *it;
+    fromConnections->second.erase(it);
+    if (connection.to().layerId() != connection.from().layerId()) {
+        auto& toConnections = connectionIndex[connection.to().layerId()];
+        toConnections.erase(std::find(toConnections.begin(), toConnections.end(), con));
     }
-    if (it != connections.end())
-        connections.erase(it);
+    connections.erase(con);
 }
 
 const INetwork::Ptr Builder::Network::build() const {
@@ -673,26 +718,23 @@ Builder::Network::operator const INetwork::Ptr() const {
 }
 
 const Builder::Layer &Builder::Network::getLayer(idx_t layerId) const {
-    for (auto& layer : getLayers()) {
-        if (layer.getId() == layerId)
-            return layer;
-    }
-    THROW_IE_EXCEPTION << "Cannot find layer with id: " << layerId;
+    const Layer* layer = findLayer(layerId);
+    if (!layer)
+        THROW_IE_EXCEPTION << "Cannot find layer with id: " << layerId;
+    return *layer;
 }
 
 Builder::Layer &Builder::Network::getLayer(idx_t layerId) {
-    for (auto& layer : getLayers()) {
-        if (layer.getId() == layerId)
-            return layer;
-    }
-    THROW_IE_EXCEPTION << "Cannot find layer with id: " << layerId;
+    layersGivenAway = true;
+    return const_cast<Layer&>(static_cast<const Network*>(this)->getLayer(layerId));
 }
 
 const std::vector<Connection> Builder::Network::getLayerConnections(idx_t layerId) const noexcept {
     std::vector<Connection> layerConnections;
-    for (const auto connection : connections) {
-        if (connection.from().layerId() == layerId || connection.to().layerId() == layerId)
-            layerConnections.push_back(connection);
-    }
+    auto it = connectionIndex.find(layerId);
+    if (it == connectionIndex.end())
+        return layerConnections;
+    for (const auto& connection : it->second)
+        layerConnections.push_back(*connection);
     return layerConnections;
 }
@@ -85,6 +85,14 @@ public:
 
     void addLayer(const CNNLayerPtr& layer) noexcept override;
 
+    void removeLayer(const std::string& layerName) {
+        _layers.erase(layerName);
+    }
+
+    void removeData(const std::string& dataName) {
+        _data.erase(dataName);
+    }
+
     StatusCode getLayerByName(const char* layerName, CNNLayerPtr& out, ResponseDesc* resp) const noexcept override;
 
     // deprecated, as there is no ResponseDesc to put error message
@@ -24,6 +24,7 @@
 #include "debug.h"
 #include <fstream>
 #include "ie_util_internal.hpp"
+#include "ie_layers_internal.hpp"
 #include <utility>
 
 
@@ -683,14 +684,157 @@ void CNNNetworkInt8Normalizer::replaceScaleShiftByDWConvolution(CNNNetwork &net)
     }
 }
 
+bool CNNNetworkInt8Normalizer::FoldInputPreprocessing(CNNNetwork& net, CNNLayer::Ptr convolution) {
+    ConvolutionLayer *pConv = dynamic_cast<ConvolutionLayer *>(convolution.get());
+    if (pConv == nullptr || pConv->_group == 0 || convolution->insData.size() != 1 ||
+        convolution->blobs.find("weights") == convolution->blobs.end() ||
+        convolution->blobs["weights"]->precision() != Precision::FP32) {
+        return false;
+    }
+
+    // Input -> [ScaleShift] -> Convolution, where the data before the convolution feeds only the next layer
+    DataPtr convInput = convolution->insData[0].lock();
+    DataPtr netInput = convInput;
+    CNNLayerPtr scaleShift = convInput->creatorLayer.lock();
+    auto networkImpl = dynamic_cast<details::CNNNetworkImpl *>(&static_cast<ICNNNetwork &>(net));
+    if (scaleShift && CaselessEq<std::string>()(scaleShift->type, "scaleshift")) {
+        // the folded ScaleShift is removed from the network
+        if (scaleShift->insData.size() != 1 || convInput->inputTo.size() != 1 || networkImpl == nullptr)
+            return false;
+        netInput = scaleShift->insData[0].lock();
+    } else {
+        scaleShift = nullptr;
+    }
+
+    CNNLayerPtr inputLayer = netInput ? netInput->creatorLayer.lock() : nullptr;
+    if (!inputLayer || !CaselessEq<std::string>()(inputLayer->type, "input") || netInput->inputTo.size() != 1 ||
+        (netInput->getPrecision() != Precision::U8 && netInput->getPrecision() != Precision::I8)) {
+        return false;
+    }
+
+    InputInfo::Ptr inputInfo;
+    for (auto& input : net.getInputsInfo()) {
+        if (input.second->getInputData() == netInput)
+            inputInfo = input.second;
+    }
+    if (!inputInfo)
+        return false;
+
+    // Values the convolution sees are (input - mean) * scale + shift, folded as input * scales + shifts
+    size_t inputChannels = netInput->getTensorDesc().getDims()[1];
+    std::vector<float> scales(inputChannels, 1.0f);
+    std::vector<float> shifts(inputChannels, 0.0f);
+
+    PreProcessInfo& pp = inputInfo->getPreProcess();
+    if (pp.getNumberOfChannels()) {
+        if (pp.getNumberOfChannels() != inputChannels || pp.getMeanVariant() == MEAN_IMAGE)
+            return false;
+        if (pp.getMeanVariant() == MEAN_VALUE) {
+            for (size_t c = 0; c < inputChannels; c++)
+                shifts[c] = -pp[c]->meanValue;
+        }
+    }
+
+    if (scaleShift) {
+        ScaleShiftLayer *pSS = dynamic_cast<ScaleShiftLayer *>(scaleShift.get());
+        if (pSS == nullptr || !pSS->_weights ||
+            (pSS->_weights->size() != 1 && pSS->_weights->size() != inputChannels) ||
+            (pSS->_biases && pSS->_biases->size() != 1 && pSS->_biases->size() != inputChannels)) {
+            return false;
+        }
+        const float *ssWValues = pSS->_weights->buffer().as<const float *>();
+        const float *ssSValues = pSS->_biases ? pSS->_biases->buffer().as<const float *>() : nullptr;
+        for (size_t c = 0; c < inputChannels; c++) {
+            float w = ssWValues[pSS->_weights->size() == 1 ? 0 : c];
+            float b = ssSValues ? ssSValues[pSS->_biases->size() == 1 ? 0 : c] : 0.0f;
+            scales[c] = w;
+            shifts[c] = shifts[c] * w + b;
+        }
+    }
+
+    // mkl-dnn pads the integer input with zeros, so a shift would be missing at the borders
+    bool withShifts = std::any_of(shifts.begin(), shifts.end(), [](float s) { return s != 0.0f; });
+    if (withShifts) {
+        Paddings pads = getPaddings(*pConv);
+        for (size_t i = 0; i < pads.begin.size(); i++) {
+            if (pads.begin[i] != 0 || pads.end[i] != 0)
+                return false;
+        }
+    }
+
+    size_t outputChannels = convolution->outData[0]->getTensorDesc().getDims()[1];
+    Blob::Ptr weights = convolution->blobs["weights"];
+    size_t W_CO = outputChannels / pConv->_group,
+           W_CI = inputChannels / pConv->_group,
+           W_HW = weights->size() / W_CI / W_CO / pConv->_group;
+
+    // New blobs are created as the network shares the FP32 ones with the original network
+    Blob::Ptr foldedWeights = make_blob_with_precision(weights->getTensorDesc());
+    foldedWeights->allocate();
+    const float *weight = weights->buffer().as<const float *>();
+    float *foldedWeight = foldedWeights->buffer().as<float *>();
+
+    std::vector<float> foldedBias(outputChannels, 0.0f);
+    if (pConv->_biases) {
+        const float *bias = pConv->_biases->buffer().as<const float *>();
+        std::copy(bias, bias + outputChannels, foldedBias.begin());
+    }
+
+    for (size_t g = 0; g < pConv->_group; g++) {
+        for (size_t co = 0; co < W_CO; co++) {
+            for (size_t ci = 0; ci < W_CI; ci++) {
+                size_t kernelBase = g * W_CO * W_CI * W_HW + co * W_CI * W_HW + ci * W_HW;
+                for (size_t hw = 0; hw < W_HW; hw++) {
+                    foldedWeight[kernelBase + hw] = weight[kernelBase + hw] * scales[g * W_CI + ci];
+                    foldedBias[g * W_CO + co] += weight[kernelBase + hw] * shifts[g * W_CI + ci];
+                }
+            }
+        }
+    }
+
+    pConv->_weights = foldedWeights;
+    convolution->blobs["weights"] = foldedWeights;
+    if (pConv->_biases || withShifts) {
+        std::shared_ptr<Data> bData = std::shared_ptr<Data>(new Data("biases", { outputChannels }, Precision::FP32, Layout::C));
+        Blob::Ptr foldedBiases = CreateBlobFromData(bData);
+        foldedBiases->allocate();
+        std::copy(foldedBias.begin(), foldedBias.end(), foldedBiases->buffer().as<float *>());
+        pConv->_biases = foldedBiases;
+        convolution->blobs["biases"] = foldedBiases;
+    }
+
+    if (scaleShift) {
+        netInput->inputTo.erase(scaleShift->name);
+        netInput->inputTo[convolution->name] = convolution;
+        convolution->insData[0] = netInput;
+        convInput->inputTo.erase(convolution->name);
+        networkImpl->removeData(convInput->name);
+        networkImpl->removeLayer(scaleShift->name);
+    }
+    // The mean values are in the biases now and the plugin must not subtract them once again
+    pp.init(0);
+    pp.setVariant(NONE);
+
+    return true;
+}
+
 void CNNNetworkInt8Normalizer::QuantizeConvolution(CNNLayer::Ptr convolution,
-                                                    CNNStatisticHelper& statHelper) {
+                                                    CNNStatisticHelper& statHelper, bool directInput) {
     size_t inputChannels = convolution->insData[0].lock()->getTensorDesc().getDims()[1];
     size_t outputChannels = convolution->outData[0]->getTensorDesc().getDims()[1];
 
-    auto iScale = statHelper.getInputScale(convolution);
-
-    convolution->blobs["i-scale"] = iScale;
+    Blob::Ptr iScale;
+    if (directInput) {
+        // The input values are the integers themselves, no ScaleShift is placed before the convolution
+        std::shared_ptr<Data> iScaleData = std::shared_ptr<Data>(new Data("scale", { inputChannels }, Precision::FP32, Layout::C));
+        iScale = CreateBlobFromData(iScaleData);
+        iScale->allocate();
+        float *iScaleMemory = static_cast<float *>(iScale->buffer());
+        std::fill(iScaleMemory, iScaleMemory + inputChannels, 1.0f);
+    } else {
+        iScale = statHelper.getInputScale(convolution);
+        convolution->blobs["i-scale"] = iScale;
+    }
 
     Blob::Ptr weights = nullptr;
     Blob::Ptr biases = nullptr;
@@ -1068,9 +1212,12 @@ void CNNNetworkInt8Normalizer::DefinesExecutionPrecision(CNNNetwork &net, CNNSta
     sortedLayers = CNNNetSortTopologically(net);
     for (auto iter : sortedLayers) {
         if (iter->precision == Precision::I8 && CaselessEq<std::string>()(iter->type, "convolution")) {
-            QuantizeConvolution(iter, statHelper);
+            bool directInput = FoldInputPreprocessing(net, iter);
+            QuantizeConvolution(iter, statHelper, directInput);
         }
     }
+    // the ScaleShifts folded into the convolutions are not in the network anymore
+    sortedLayers = CNNNetSortTopologically(net);
 
     // Returning of tails to FP32 mode if optimistic approach marked them as I8
     // no sense to do pooling in i8, we can return just after convolution
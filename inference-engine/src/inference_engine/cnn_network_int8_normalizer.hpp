@@ -181,7 +181,16 @@ protected:
      * data
      * o-scale - multiplication on this scale will convert above denormalized fp32 to i8 for next layer
      */
-    void QuantizeConvolution(CNNLayer::Ptr convolution, CNNStatisticHelper& statHelper);
+    void QuantizeConvolution(CNNLayer::Ptr convolution, CNNStatisticHelper& statHelper, bool directInput = false);
+
+    /**
+     * Lets the convolution read a U8/I8 network input as is. The mean values of the input and the
+     * ScaleShift between the input and the convolution are folded into the FP32 weights and biases,
+     * the ScaleShift is cut out of the topology and the mean values are dropped from the input info.
+     * The shifts are folded only if the convolution has no padding, padded pixels would not be shifted.
+     * @return true if the input is passed to the convolution directly, the i-scale is one then
+     */
+    bool FoldInputPreprocessing(CNNNetwork& net, CNNLayer::Ptr convolution);
 
     /**  Adds ScaleShifts everywhere */
     void AddScaleShifts(CNNNetwork& net, CNNStatisticHelper& statHelper);
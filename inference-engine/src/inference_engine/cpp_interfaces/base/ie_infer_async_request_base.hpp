@@ -41,6 +41,11 @@ public:
         TO_STATUS(_impl->SetBlob(name, data));
     }
 
+    StatusCode SetBlobROIs(const char *name, const Blob::Ptr &data, const std::vector<ROI> &rois,
+                           ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetBlobROIs(name, data, rois));
+    }
+
     StatusCode GetBlob(const char *name, Blob::Ptr &data, ResponseDesc *resp) noexcept override {
         TO_STATUS(_impl->GetBlob(name, data));
     }
@@ -231,6 +231,10 @@ public:
         _syncRequest->SetBlob(name, data);
     }
 
+    void SetBlobROIs_ThreadUnsafe(const char *name, const Blob::Ptr &data, const std::vector<ROI> &rois) override {
+        _syncRequest->SetBlobROIs(name, data, rois);
+    }
+
     void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) override {
         _syncRequest->GetBlob(name, data);
     }
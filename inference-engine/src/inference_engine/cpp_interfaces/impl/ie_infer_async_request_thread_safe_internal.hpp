@@ -86,6 +86,11 @@ public:
         SetBlob_ThreadUnsafe(name, data);
     }
 
+    void SetBlobROIs(const char *name, const Blob::Ptr &data, const std::vector<ROI> &rois) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetBlobROIs_ThreadUnsafe(name, data, rois);
+    }
+
     void GetBlob(const char *name, Blob::Ptr &data) override {
         if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
         GetBlob_ThreadUnsafe(name, data);
@@ -115,6 +120,8 @@ public:
 
     virtual void SetBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) = 0;
 
+    virtual void SetBlobROIs_ThreadUnsafe(const char *name, const Blob::Ptr &data, const std::vector<ROI> &rois) = 0;
+
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
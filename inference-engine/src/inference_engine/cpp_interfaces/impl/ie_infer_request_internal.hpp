@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 #include <blob_factory.hpp>
 #include <ie_input_info.hpp>
 #include <ie_icnn_network.hpp>
@@ -125,6 +126,56 @@ public:
         }
     }
 
+    /**
+     * @brief Given optional implementation of setting a frame with regions filling the batch of an input
+     * @param name - a name of the input.
+     * @param data - a reference to the frame blob. The type of Blob must correspond to the network input precision.
+     * @param rois - regions of the frame, the i-th one is resized to the i-th batch slot of the input.
+     */
+    void SetBlobROIs(const char *name, const Blob::Ptr &data, const std::vector<ROI> &rois) override {
+        if (!data)
+            THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << name << "\'";
+        if (data->buffer() == nullptr)
+            THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
+        if (name == nullptr) {
+            THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blob with empty name";
+        }
+        InputInfo::Ptr foundInput;
+        DataPtr foundOutput;
+        if (!findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set regions of interest of output: \'"
+                               << name << "\'";
+        }
+        if (foundInput->getInputPrecision() != data->precision()) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                               << "Failed to set Blob with precision not corresponding to user input precision";
+        }
+        if (foundInput->getPreProcess().getResizeAlgorithm() == ResizeAlgorithm::NO_RESIZE) {
+            THROW_IE_EXCEPTION << "Failed to set regions of interest of input \'" << name
+                               << "\' without resize algorithm set";
+        }
+
+        const auto &inputDims = foundInput->getTensorDesc().getDims();
+        const auto &frameDims = data->getTensorDesc().getDims();
+        if (inputDims.size() != 4 || frameDims.size() != 4 || frameDims[0] != 1 || frameDims[1] != inputDims[1]) {
+            THROW_IE_EXCEPTION << "Regions of interest need a frame of one image with the channels of input \'"
+                               << name << "\'";
+        }
+        if (rois.size() != inputDims[0]) {
+            THROW_IE_EXCEPTION << "Failed to set " << rois.size() << " regions of interest for the batch of "
+                               << inputDims[0] << " of input \'" << name << "\'";
+        }
+        for (const auto &roi : rois) {
+            if (roi.sizeX == 0 || roi.sizeY == 0 ||
+                roi.posX + roi.sizeX > frameDims[3] || roi.posY + roi.sizeY > frameDims[2]) {
+                THROW_IE_EXCEPTION << "Region of interest " << roi.id << " is out of the frame";
+            }
+        }
+
+        // Stores the frame as ROI blob, its regions fill the network input during pre-processing.
+        _preProcData[name].setRoiBlob(data, rois);
+    }
+
     /**
      * @brief Given optional implementation of getting blob to avoid need for it to be implemented by plugin
      * @param name - a name of input or output blob.
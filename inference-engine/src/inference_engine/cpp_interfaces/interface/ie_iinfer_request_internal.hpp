@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <ie_common.h>
 #include <ie_blob.h>
 
@@ -42,6 +43,15 @@ public:
      */
     virtual void SetBlob(const char *name, const Blob::Ptr &data) = 0;
 
+    /**
+     * @brief Sets a source frame whose regions are cropped, resized and placed to the batch slots of the input
+     * during pre-processing
+     * @param name - a name of the input.
+     * @param data - a reference to the source frame blob.
+     * @param rois - regions of the frame, one per batch slot of the input.
+     */
+    virtual void SetBlobROIs(const char *name, const Blob::Ptr &data, const std::vector<ROI> &rois) = 0;
+
     /**
      * @brief Get input/output data to infer
      * @note: Memory allocation doesn't happen
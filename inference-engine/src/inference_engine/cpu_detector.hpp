@@ -13,4 +13,14 @@ namespace InferenceEngine {
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_sse42();
 
+/**
+ * @brief Check if CPU is x86 with AVX2 and FMA
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx2();
+
+/**
+ * @brief Check if CPU is x86 with AVX-512 F, BW, DQ and VL
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
+
 }  // namespace InferenceEngine
@@ -0,0 +1,105 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_transform_avx2.hpp"
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+
+namespace InferenceEngine {
+namespace avx2 {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy primitives manually vectored for AVX2 (w/o OpenMP threads),
+// a row of an NHWC blob is split or merged by the row kernels of G-API
+//
+//------------------------------------------------------------------------
+
+void blob_copy_4d_split_u8c3(const uint8_t *src_ptr,
+                                   uint8_t *dst_ptr,
+                                    size_t  N_src_stride,
+                                    size_t  H_src_stride,
+                                    size_t  N_dst_stride,
+                                    size_t  H_dst_stride,
+                                    size_t  C_dst_stride,
+                                       int  N,
+                                       int  H,
+                                       int  W) {
+    for (int n = 0; n < N; n++)
+    for (int h = 0; h < H; h++) {
+        const uint8_t *src = src_ptr + n*N_src_stride + h*H_src_stride;
+        uint8_t *dst0 = dst_ptr + n*N_dst_stride + 0*C_dst_stride + h*H_dst_stride;
+        uint8_t *dst1 = dst_ptr + n*N_dst_stride + 1*C_dst_stride + h*H_dst_stride;
+        uint8_t *dst2 = dst_ptr + n*N_dst_stride + 2*C_dst_stride + h*H_dst_stride;
+
+        gapi::kernels::avx2::splitRow_8UC3(src, dst0, dst1, dst2, W);
+    }
+}
+
+void blob_copy_4d_split_f32c3(const float *src_ptr,
+                                    float *dst_ptr,
+                                   size_t  N_src_stride,
+                                   size_t  H_src_stride,
+                                   size_t  N_dst_stride,
+                                   size_t  H_dst_stride,
+                                   size_t  C_dst_stride,
+                                      int  N,
+                                      int  H,
+                                      int  W) {
+    for (int n = 0; n < N; n++)
+    for (int h = 0; h < H; h++) {
+        const float *src = src_ptr + n*N_src_stride + h*H_src_stride;
+        float *dst0 = dst_ptr + n*N_dst_stride + 0*C_dst_stride + h*H_dst_stride;
+        float *dst1 = dst_ptr + n*N_dst_stride + 1*C_dst_stride + h*H_dst_stride;
+        float *dst2 = dst_ptr + n*N_dst_stride + 2*C_dst_stride + h*H_dst_stride;
+
+        gapi::kernels::avx2::splitRow_32FC3(src, dst0, dst1, dst2, W);
+    }
+}
+
+void blob_copy_4d_merge_u8c3(const uint8_t *src_ptr,
+                                   uint8_t *dst_ptr,
+                                    size_t  N_src_stride,
+                                    size_t  H_src_stride,
+                                    size_t  C_src_stride,
+                                    size_t  N_dst_stride,
+                                    size_t  H_dst_stride,
+                                       int  N,
+                                       int  H,
+                                       int  W) {
+    for (int n = 0; n < N; n++)
+    for (int h = 0; h < H; h++) {
+        const uint8_t *src0 = src_ptr + n*N_src_stride + 0*C_src_stride + h*H_src_stride;
+        const uint8_t *src1 = src_ptr + n*N_src_stride + 1*C_src_stride + h*H_src_stride;
+        const uint8_t *src2 = src_ptr + n*N_src_stride + 2*C_src_stride + h*H_src_stride;
+
+        uint8_t *dst = dst_ptr + n*N_dst_stride + h*H_dst_stride;
+
+        gapi::kernels::avx2::mergeRow_8UC3(src0, src1, src2, dst, W);
+    }
+}
+
+void blob_copy_4d_merge_f32c3(const float *src_ptr,
+                                    float *dst_ptr,
+                                   size_t  N_src_stride,
+                                   size_t  H_src_stride,
+                                   size_t  C_src_stride,
+                                   size_t  N_dst_stride,
+                                   size_t  H_dst_stride,
+                                      int  N,
+                                      int  H,
+                                      int  W) {
+    for (int n = 0; n < N; n++)
+    for (int h = 0; h < H; h++) {
+        const float *src0 = src_ptr + n*N_src_stride + 0*C_src_stride + h*H_src_stride;
+        const float *src1 = src_ptr + n*N_src_stride + 1*C_src_stride + h*H_src_stride;
+        const float *src2 = src_ptr + n*N_src_stride + 2*C_src_stride + h*H_src_stride;
+
+        float *dst = dst_ptr + n*N_dst_stride + h*H_dst_stride;
+
+        gapi::kernels::avx2::mergeRow_32FC3(src0, src1, src2, dst, W);
+    }
+}
+
+}  // namespace avx2
+}  // namespace InferenceEngine
@@ -0,0 +1,82 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_data_avx2.hpp"
+
+#include <immintrin.h>  // AVX2, FMA
+
+namespace InferenceEngine {
+namespace Resize {
+namespace avx2 {
+
+void lerpRows_32F(float dst[], const float src0[], const float src1[], float beta, int width) {
+    const __m256 b = _mm256_set1_ps(beta);
+    int x = 0;
+    for (; x <= width - 8; x += 8) {
+        __m256 s0 = _mm256_loadu_ps(&src0[x]);
+        __m256 s1 = _mm256_loadu_ps(&src1[x]);
+        _mm256_storeu_ps(&dst[x], _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), b, s0));
+    }
+
+    for (; x < width; x++) {
+        dst[x] = src0[x] + beta * (src1[x] - src0[x]);
+    }
+}
+
+void lerpCols_32F(float dst[], const float src[], const int xofs[], const float alpha[], int width) {
+    int x = 0;
+    for (; x <= width - 8; x += 8) {
+        __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&xofs[x]));
+        __m256 s0 = _mm256_i32gather_ps(src,     sx, 4);
+        __m256 s1 = _mm256_i32gather_ps(src + 1, sx, 4);
+        _mm256_storeu_ps(&dst[x], _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), _mm256_loadu_ps(&alpha[x]), s0));
+    }
+
+    for (; x < width; x++) {
+        float s0 = src[xofs[x]];
+        float s1 = src[xofs[x] + 1];
+        dst[x] = s0 + alpha[x] * (s1 - s0);
+    }
+}
+
+void blendRows_32F(float dst[], const float src0[], float beta0, const float src1[], float beta1, int width) {
+    const __m256 b0 = _mm256_set1_ps(beta0);
+    const __m256 b1 = _mm256_set1_ps(beta1);
+    int x = 0;
+    for (; x <= width - 8; x += 8) {
+        __m256 s0 = _mm256_loadu_ps(&src0[x]);
+        __m256 s1 = _mm256_loadu_ps(&src1[x]);
+        _mm256_storeu_ps(&dst[x], _mm256_fmadd_ps(s1, b1, _mm256_mul_ps(s0, b0)));
+    }
+
+    for (; x < width; x++) {
+        dst[x] = src0[x] * beta0 + src1[x] * beta1;
+    }
+}
+
+void blendCols_32F(float dst[], const float src[], const int xofs[], const float alpha[], int width) {
+    int x = 0;
+    for (; x <= width - 8; x += 8) {
+        // the weights of a pixel are interleaved, the shuffle leaves 64-bit pairs of pixels out of order
+        __m256 a01 = _mm256_loadu_ps(&alpha[2*x]);
+        __m256 a23 = _mm256_loadu_ps(&alpha[2*x + 8]);
+        __m256 a0 = _mm256_shuffle_ps(a01, a23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 a1 = _mm256_shuffle_ps(a01, a23, _MM_SHUFFLE(3, 1, 3, 1));
+        a0 = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(a0), _MM_SHUFFLE(3, 1, 2, 0)));
+        a1 = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(a1), _MM_SHUFFLE(3, 1, 2, 0)));
+
+        __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&xofs[x]));
+        __m256 s0 = _mm256_i32gather_ps(src,     sx, 4);
+        __m256 s1 = _mm256_i32gather_ps(src + 1, sx, 4);
+        _mm256_storeu_ps(&dst[x], _mm256_fmadd_ps(s1, a1, _mm256_mul_ps(s0, a0)));
+    }
+
+    for (; x < width; x++) {
+        dst[x] = src[xofs[x]] * alpha[2*x] + src[xofs[x] + 1] * alpha[2*x + 1];
+    }
+}
+
+}  // namespace avx2
+}  // namespace Resize
+}  // namespace InferenceEngine
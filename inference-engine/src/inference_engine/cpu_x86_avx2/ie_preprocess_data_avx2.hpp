@@ -0,0 +1,27 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace InferenceEngine {
+namespace Resize {
+namespace avx2 {
+
+// Row kernels of the FP32 bilinear and area (upscale) resize
+
+// dst[x] = src0[x] + beta * (src1[x] - src0[x])
+void lerpRows_32F(float dst[], const float src0[], const float src1[], float beta, int width);
+
+// dst[x] = src[xofs[x]] + alpha[x] * (src[xofs[x] + 1] - src[xofs[x]])
+void lerpCols_32F(float dst[], const float src[], const int xofs[], const float alpha[], int width);
+
+// dst[x] = src0[x] * beta0 + src1[x] * beta1
+void blendRows_32F(float dst[], const float src0[], float beta0, const float src1[], float beta1, int width);
+
+// dst[x] = src[xofs[x]] * alpha[2*x] + src[xofs[x] + 1] * alpha[2*x + 1]
+void blendCols_32F(float dst[], const float src[], const int xofs[], const float alpha[], int width);
+
+}  // namespace avx2
+}  // namespace Resize
+}  // namespace InferenceEngine
@@ -0,0 +1,632 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+
+#include <immintrin.h>  // AVX2, FMA
+
+#include <cstring>
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx2 {
+
+//------------------------------------------------------------------------------
+//
+// AVX2 shuffles work within 128-bit lanes, so a row is processed as two blocks
+// of the SSE4.2 code: the lanes of a register hold the same part of two blocks
+// `block` elements apart, the interleaving then runs on both of them at once.
+//
+//------------------------------------------------------------------------------
+
+static inline __m256i load_lanes(const uint8_t* ptr, int block) {
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + block));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static inline void store_lanes(uint8_t* ptr, int block, __m256i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm256_castsi256_si128(v));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + block), _mm256_extracti128_si256(v, 1));
+}
+
+static inline __m256 load_lanes(const float* ptr, int block) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr)), _mm_loadu_ps(ptr + block), 1);
+}
+
+static inline void store_lanes(float* ptr, int block, __m256 v) {
+    _mm_storeu_ps(ptr, _mm256_castps256_ps128(v));
+    _mm_storeu_ps(ptr + block, _mm256_extractf128_ps(v, 1));
+}
+
+static inline __m256i load(const uint8_t* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+}
+
+static inline void store(uint8_t* ptr, __m256i v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), v);
+}
+
+static inline __m256i lanes_epi8(char b0, char b1, char b2, char b3, char b4, char b5, char b6, char b7,
+                                 char b8, char b9, char b10, char b11, char b12, char b13, char b14, char b15) {
+    return _mm256_setr_epi8(b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15,
+                            b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15);
+}
+
+// 8U: 16 pixels of a lane
+
+static inline void load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b) {
+    const __m256i sh = lanes_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    __m256i s0 = _mm256_shuffle_epi8(load_lanes(ptr,      32), sh);
+    __m256i s1 = _mm256_shuffle_epi8(load_lanes(ptr + 16, 32), sh);
+    a = _mm256_unpacklo_epi64(s0, s1);
+    b = _mm256_unpackhi_epi64(s0, s1);
+}
+
+static inline void load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b, __m256i& c) {
+    const __m256i m0 = lanes_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = lanes_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    __m256i s0 = load_lanes(ptr,      48);
+    __m256i s1 = load_lanes(ptr + 16, 48);
+    __m256i s2 = load_lanes(ptr + 32, 48);
+    __m256i a0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s0, s1, m0), s2, m1);
+    __m256i b0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s1, s2, m0), s0, m1);
+    __m256i c0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s2, s0, m0), s1, m1);
+    const __m256i sh_b = lanes_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13);
+    const __m256i sh_g = lanes_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14);
+    const __m256i sh_r = lanes_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15);
+    a = _mm256_shuffle_epi8(a0, sh_b);
+    b = _mm256_shuffle_epi8(b0, sh_g);
+    c = _mm256_shuffle_epi8(c0, sh_r);
+}
+
+static inline void load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b, __m256i& c, __m256i& d) {
+    const __m256i sh = lanes_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    __m256i s0 = _mm256_shuffle_epi8(load_lanes(ptr,      64), sh);
+    __m256i s1 = _mm256_shuffle_epi8(load_lanes(ptr + 16, 64), sh);
+    __m256i s2 = _mm256_shuffle_epi8(load_lanes(ptr + 32, 64), sh);
+    __m256i s3 = _mm256_shuffle_epi8(load_lanes(ptr + 48, 64), sh);
+    __m256i t0 = _mm256_unpacklo_epi32(s0, s1);
+    __m256i t1 = _mm256_unpacklo_epi32(s2, s3);
+    __m256i t2 = _mm256_unpackhi_epi32(s0, s1);
+    __m256i t3 = _mm256_unpackhi_epi32(s2, s3);
+    a = _mm256_unpacklo_epi64(t0, t1);
+    b = _mm256_unpackhi_epi64(t0, t1);
+    c = _mm256_unpacklo_epi64(t2, t3);
+    d = _mm256_unpackhi_epi64(t2, t3);
+}
+
+static inline void store_interleave(uint8_t* ptr, __m256i a, __m256i b) {
+    store_lanes(ptr,      32, _mm256_unpacklo_epi8(a, b));
+    store_lanes(ptr + 16, 32, _mm256_unpackhi_epi8(a, b));
+}
+
+static inline void store_interleave(uint8_t* ptr, __m256i a, __m256i b, __m256i c) {
+    const __m256i sh_a = lanes_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5);
+    const __m256i sh_b = lanes_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10);
+    const __m256i sh_c = lanes_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15);
+    __m256i a0 = _mm256_shuffle_epi8(a, sh_a);
+    __m256i b0 = _mm256_shuffle_epi8(b, sh_b);
+    __m256i c0 = _mm256_shuffle_epi8(c, sh_c);
+
+    const __m256i m0 = lanes_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = lanes_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    store_lanes(ptr,      48, _mm256_blendv_epi8(_mm256_blendv_epi8(a0, b0, m1), c0, m0));
+    store_lanes(ptr + 16, 48, _mm256_blendv_epi8(_mm256_blendv_epi8(b0, c0, m1), a0, m0));
+    store_lanes(ptr + 32, 48, _mm256_blendv_epi8(_mm256_blendv_epi8(c0, a0, m1), b0, m0));
+}
+
+static inline void store_interleave(uint8_t* ptr, __m256i a, __m256i b, __m256i c, __m256i d) {
+    __m256i u0 = _mm256_unpacklo_epi8(a, b);
+    __m256i u1 = _mm256_unpackhi_epi8(a, b);
+    __m256i u2 = _mm256_unpacklo_epi8(c, d);
+    __m256i u3 = _mm256_unpackhi_epi8(c, d);
+    store_lanes(ptr,      64, _mm256_unpacklo_epi16(u0, u2));
+    store_lanes(ptr + 16, 64, _mm256_unpackhi_epi16(u0, u2));
+    store_lanes(ptr + 32, 64, _mm256_unpacklo_epi16(u1, u3));
+    store_lanes(ptr + 48, 64, _mm256_unpackhi_epi16(u1, u3));
+}
+
+// 32F: 4 pixels of a lane
+
+static inline void load_deinterleave(const float* ptr, __m256& a, __m256& b) {
+    __m256 s0 = load_lanes(ptr,     8);
+    __m256 s1 = load_lanes(ptr + 4, 8);
+    a = _mm256_shuffle_ps(s0, s1, _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm256_shuffle_ps(s0, s1, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static inline void load_deinterleave(const float* ptr, __m256& a, __m256& b, __m256& c) {
+    __m256 t0 = load_lanes(ptr,     12);
+    __m256 t1 = load_lanes(ptr + 4, 12);
+    __m256 t2 = load_lanes(ptr + 8, 12);
+
+    __m256 at12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 1, 0, 2));
+    a = _mm256_shuffle_ps(t0, at12, _MM_SHUFFLE(2, 0, 3, 0));
+
+    __m256 bt01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 0, 1));
+    __m256 bt12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 2, 0, 3));
+    b = _mm256_shuffle_ps(bt01, bt12, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m256 ct01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 1, 0, 2));
+    c = _mm256_shuffle_ps(ct01, t2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// 4x4 transpose in every lane, it both interleaves and deinterleaves 4 channels
+static inline void transpose4(__m256& a, __m256& b, __m256& c, __m256& d) {
+    __m256 t0 = _mm256_unpacklo_ps(a, b);
+    __m256 t1 = _mm256_unpacklo_ps(c, d);
+    __m256 t2 = _mm256_unpackhi_ps(a, b);
+    __m256 t3 = _mm256_unpackhi_ps(c, d);
+    a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+    b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+    c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+static inline void load_deinterleave(const float* ptr, __m256& a, __m256& b, __m256& c, __m256& d) {
+    a = load_lanes(ptr,      16);
+    b = load_lanes(ptr + 4,  16);
+    c = load_lanes(ptr + 8,  16);
+    d = load_lanes(ptr + 12, 16);
+    transpose4(a, b, c, d);
+}
+
+static inline void store_interleave(float* ptr, __m256 a, __m256 b) {
+    store_lanes(ptr,     8, _mm256_unpacklo_ps(a, b));
+    store_lanes(ptr + 4, 8, _mm256_unpackhi_ps(a, b));
+}
+
+static inline void store_interleave(float* ptr, __m256 a, __m256 b, __m256 c) {
+    __m256 u0 = _mm256_shuffle_ps(a , b , _MM_SHUFFLE(0, 0, 0, 0));
+    __m256 u1 = _mm256_shuffle_ps(c , a , _MM_SHUFFLE(1, 1, 0, 0));
+    __m256 v0 = _mm256_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u2 = _mm256_shuffle_ps(b , c , _MM_SHUFFLE(1, 1, 1, 1));
+    __m256 u3 = _mm256_shuffle_ps(a , b , _MM_SHUFFLE(2, 2, 2, 2));
+    __m256 v1 = _mm256_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u4 = _mm256_shuffle_ps(c , a , _MM_SHUFFLE(3, 3, 2, 2));
+    __m256 u5 = _mm256_shuffle_ps(b , c , _MM_SHUFFLE(3, 3, 3, 3));
+    __m256 v2 = _mm256_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0));
+
+    store_lanes(ptr,     12, v0);
+    store_lanes(ptr + 4, 12, v1);
+    store_lanes(ptr + 8, 12, v2);
+}
+
+static inline void store_interleave(float* ptr, __m256 a, __m256 b, __m256 c, __m256 d) {
+    transpose4(a, b, c, d);
+    store_lanes(ptr,      16, a);
+    store_lanes(ptr + 4,  16, b);
+    store_lanes(ptr + 8,  16, c);
+    store_lanes(ptr + 12, 16, d);
+}
+
+//------------------------------------------------------------------------------
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                 const float *src0[],
+                 const float *src1[],
+                 const float  alpha[],
+                 const int    mapsx[],
+                 const float  beta[],
+                       float  tmp[],
+                 const Size & inSz,
+                 const Size & outSz,
+                       int    lpi) {
+    UNUSED(tmp);
+
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+            for (; x <= outSz.width - 8; x += 8) {
+                __m256  alpha0 = _mm256_loadu_ps(&alpha[x]);
+                __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mapsx[x]));
+
+                __m256 s00 = _mm256_i32gather_ps(src0[l],     sx, 4);
+                __m256 s01 = _mm256_i32gather_ps(src0[l] + 1, sx, 4);
+                __m256 res0 = _mm256_fmadd_ps(_mm256_sub_ps(s00, s01), alpha0, s01);
+
+                __m256 s10 = _mm256_i32gather_ps(src1[l],     sx, 4);
+                __m256 s11 = _mm256_i32gather_ps(src1[l] + 1, sx, 4);
+                __m256 res1 = _mm256_fmadd_ps(_mm256_sub_ps(s10, s11), alpha0, s11);
+
+                __m256 d = _mm256_fmadd_ps(_mm256_sub_ps(res0, res1), _mm256_set1_ps(beta0), res1);
+                _mm256_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                dst[l][x] = beta0*res0 + beta1*res1;
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        for (int l = 0; l < lpi; l++) {
+            int x = 0;
+
+            for (; x <= outSz.width - 8; x += 8) {
+                __m256  alpha0 = _mm256_loadu_ps(&alpha[x]);
+                __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mapsx[x]));
+
+                __m256 s00 = _mm256_i32gather_ps(src0[l],     sx, 4);
+                __m256 s01 = _mm256_i32gather_ps(src0[l] + 1, sx, 4);
+                _mm256_storeu_ps(&dst[l][x], _mm256_fmadd_ps(_mm256_sub_ps(s00, s01), alpha0, s01));
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                dst[l][x] = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+            for (; x <= length - 8; x += 8) {
+                __m256 s0 = _mm256_loadu_ps(&src0[l][x]);
+                __m256 s1 = _mm256_loadu_ps(&src1[l][x]);
+                _mm256_storeu_ps(&dst[l][x], _mm256_fmadd_ps(_mm256_sub_ps(s0, s1), _mm256_set1_ps(beta0), s1));
+            }
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length * sizeof(float));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC2(const uint8_t in0[],
+                   const uint8_t in1[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        store_interleave(&out[2*l], load(&in0[l]), load(&in1[l]));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        store_interleave(&out[3*l], load(&in0[l]), load(&in1[l]), load(&in2[l]));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_8UC4(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                   const uint8_t in3[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        store_interleave(&out[4*l], load(&in0[l]), load(&in1[l]), load(&in2[l]), load(&in3[l]));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void mergeRow_32FC2(const float in0[],
+                    const float in1[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        store_interleave(&out[2*l], _mm256_loadu_ps(&in0[l]), _mm256_loadu_ps(&in1[l]));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        store_interleave(&out[3*l], _mm256_loadu_ps(&in0[l]), _mm256_loadu_ps(&in1[l]), _mm256_loadu_ps(&in2[l]));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC4(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        store_interleave(&out[4*l], _mm256_loadu_ps(&in0[l]), _mm256_loadu_ps(&in1[l]),
+                                    _mm256_loadu_ps(&in2[l]), _mm256_loadu_ps(&in3[l]));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void splitRow_8UC2(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i r0, r1;
+        load_deinterleave(&in[2*l], r0, r1);
+        store(&out0[l], r0);
+        store(&out1[l], r1);
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i r0, r1, r2;
+        load_deinterleave(&in[3*l], r0, r1, r2);
+        store(&out0[l], r0);
+        store(&out1[l], r1);
+        store(&out2[l], r2);
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_8UC4(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                         uint8_t out3[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i r0, r1, r2, r3;
+        load_deinterleave(&in[4*l], r0, r1, r2, r3);
+        store(&out0[l], r0);
+        store(&out1[l], r1);
+        store(&out2[l], r2);
+        store(&out3[l], r3);
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+void splitRow_32FC2(const float in[],
+                          float out0[],
+                          float out1[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 r0, r1;
+        load_deinterleave(&in[2*l], r0, r1);
+        _mm256_storeu_ps(&out0[l], r0);
+        _mm256_storeu_ps(&out1[l], r1);
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 r0, r1, r2;
+        load_deinterleave(&in[3*l], r0, r1, r2);
+        _mm256_storeu_ps(&out0[l], r0);
+        _mm256_storeu_ps(&out1[l], r1);
+        _mm256_storeu_ps(&out2[l], r2);
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC4(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                          float out3[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 r0, r1, r2, r3;
+        load_deinterleave(&in[4*l], r0, r1, r2, r3);
+        _mm256_storeu_ps(&out0[l], r0);
+        _mm256_storeu_ps(&out1[l], r1);
+        _mm256_storeu_ps(&out2[l], r2);
+        _mm256_storeu_ps(&out3[l], r3);
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+}  // namespace avx2
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
@@ -0,0 +1,82 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_data_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512 F
+
+namespace InferenceEngine {
+namespace Resize {
+namespace avx512 {
+
+void lerpRows_32F(float dst[], const float src0[], const float src1[], float beta, int width) {
+    const __m512 b = _mm512_set1_ps(beta);
+    int x = 0;
+    for (; x <= width - 16; x += 16) {
+        __m512 s0 = _mm512_loadu_ps(&src0[x]);
+        __m512 s1 = _mm512_loadu_ps(&src1[x]);
+        _mm512_storeu_ps(&dst[x], _mm512_fmadd_ps(_mm512_sub_ps(s1, s0), b, s0));
+    }
+
+    for (; x < width; x++) {
+        dst[x] = src0[x] + beta * (src1[x] - src0[x]);
+    }
+}
+
+void lerpCols_32F(float dst[], const float src[], const int xofs[], const float alpha[], int width) {
+    int x = 0;
+    for (; x <= width - 16; x += 16) {
+        __m512i sx = _mm512_loadu_si512(&xofs[x]);
+        __m512 s0 = _mm512_i32gather_ps(sx, src,     4);
+        __m512 s1 = _mm512_i32gather_ps(sx, src + 1, 4);
+        _mm512_storeu_ps(&dst[x], _mm512_fmadd_ps(_mm512_sub_ps(s1, s0), _mm512_loadu_ps(&alpha[x]), s0));
+    }
+
+    for (; x < width; x++) {
+        float s0 = src[xofs[x]];
+        float s1 = src[xofs[x] + 1];
+        dst[x] = s0 + alpha[x] * (s1 - s0);
+    }
+}
+
+void blendRows_32F(float dst[], const float src0[], float beta0, const float src1[], float beta1, int width) {
+    const __m512 b0 = _mm512_set1_ps(beta0);
+    const __m512 b1 = _mm512_set1_ps(beta1);
+    int x = 0;
+    for (; x <= width - 16; x += 16) {
+        __m512 s0 = _mm512_loadu_ps(&src0[x]);
+        __m512 s1 = _mm512_loadu_ps(&src1[x]);
+        _mm512_storeu_ps(&dst[x], _mm512_fmadd_ps(s1, b1, _mm512_mul_ps(s0, b0)));
+    }
+
+    for (; x < width; x++) {
+        dst[x] = src0[x] * beta0 + src1[x] * beta1;
+    }
+}
+
+void blendCols_32F(float dst[], const float src[], const int xofs[], const float alpha[], int width) {
+    const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    int x = 0;
+    for (; x <= width - 16; x += 16) {
+        // the weights of a pixel are interleaved
+        __m512 a01 = _mm512_loadu_ps(&alpha[2*x]);
+        __m512 a23 = _mm512_loadu_ps(&alpha[2*x + 16]);
+        __m512 a0 = _mm512_permutex2var_ps(a01, even, a23);
+        __m512 a1 = _mm512_permutex2var_ps(a01, odd, a23);
+
+        __m512i sx = _mm512_loadu_si512(&xofs[x]);
+        __m512 s0 = _mm512_i32gather_ps(sx, src,     4);
+        __m512 s1 = _mm512_i32gather_ps(sx, src + 1, 4);
+        _mm512_storeu_ps(&dst[x], _mm512_fmadd_ps(s1, a1, _mm512_mul_ps(s0, a0)));
+    }
+
+    for (; x < width; x++) {
+        dst[x] = src[xofs[x]] * alpha[2*x] + src[xofs[x] + 1] * alpha[2*x + 1];
+    }
+}
+
+}  // namespace avx512
+}  // namespace Resize
+}  // namespace InferenceEngine
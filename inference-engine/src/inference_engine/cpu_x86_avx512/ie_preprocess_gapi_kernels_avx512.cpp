@@ -0,0 +1,644 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512 F, BW
+
+#include <cstring>
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx512 {
+
+//------------------------------------------------------------------------------
+//
+// AVX-512 shuffles work within 128-bit lanes, so a row is processed as four
+// blocks of the SSE4.2 code: the lanes of a register hold the same part of four
+// blocks `block` elements apart, the interleaving then runs on all of them.
+//
+//------------------------------------------------------------------------------
+
+static inline __m512i load_lanes(const uint8_t* ptr, int block) {
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + block)), 1);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 2*block)), 2);
+    return _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 3*block)), 3);
+}
+
+static inline void store_lanes(uint8_t* ptr, int block, __m512i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm512_castsi512_si128(v));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + block), _mm512_extracti32x4_epi32(v, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 2*block), _mm512_extracti32x4_epi32(v, 2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 3*block), _mm512_extracti32x4_epi32(v, 3));
+}
+
+static inline __m512 load_lanes(const float* ptr, int block) {
+    __m512 v = _mm512_castps128_ps512(_mm_loadu_ps(ptr));
+    v = _mm512_insertf32x4(v, _mm_loadu_ps(ptr + block), 1);
+    v = _mm512_insertf32x4(v, _mm_loadu_ps(ptr + 2*block), 2);
+    return _mm512_insertf32x4(v, _mm_loadu_ps(ptr + 3*block), 3);
+}
+
+static inline void store_lanes(float* ptr, int block, __m512 v) {
+    _mm_storeu_ps(ptr, _mm512_castps512_ps128(v));
+    _mm_storeu_ps(ptr + block, _mm512_extractf32x4_ps(v, 1));
+    _mm_storeu_ps(ptr + 2*block, _mm512_extractf32x4_ps(v, 2));
+    _mm_storeu_ps(ptr + 3*block, _mm512_extractf32x4_ps(v, 3));
+}
+
+static inline __m512i load(const uint8_t* ptr) {
+    return _mm512_loadu_si512(ptr);
+}
+
+static inline void store(uint8_t* ptr, __m512i v) {
+    _mm512_storeu_si512(ptr, v);
+}
+
+static inline __m512i lanes_epi8(char b0, char b1, char b2, char b3, char b4, char b5, char b6, char b7,
+                                 char b8, char b9, char b10, char b11, char b12, char b13, char b14, char b15) {
+    return _mm512_broadcast_i32x4(_mm_setr_epi8(b0, b1, b2, b3, b4, b5, b6, b7,
+                                                b8, b9, b10, b11, b12, b13, b14, b15));
+}
+
+// The bytes of every third pixel in the lanes: 2, 5, 8, 11, 14 and 1, 4, 7, 10, 13
+static const __mmask64 mask_c3_0 = 0x4924492449244924ULL;
+static const __mmask64 mask_c3_1 = 0x2492249224922492ULL;
+
+// 8U: 16 pixels of a lane
+
+static inline void load_deinterleave(const uint8_t* ptr, __m512i& a, __m512i& b) {
+    const __m512i sh = lanes_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    __m512i s0 = _mm512_shuffle_epi8(load_lanes(ptr,      32), sh);
+    __m512i s1 = _mm512_shuffle_epi8(load_lanes(ptr + 16, 32), sh);
+    a = _mm512_unpacklo_epi64(s0, s1);
+    b = _mm512_unpackhi_epi64(s0, s1);
+}
+
+static inline void load_deinterleave(const uint8_t* ptr, __m512i& a, __m512i& b, __m512i& c) {
+    const __mmask64 m0 = mask_c3_0;
+    const __mmask64 m1 = mask_c3_1;
+    __m512i s0 = load_lanes(ptr,      48);
+    __m512i s1 = load_lanes(ptr + 16, 48);
+    __m512i s2 = load_lanes(ptr + 32, 48);
+    __m512i a0 = _mm512_mask_blend_epi8(m1, _mm512_mask_blend_epi8(m0, s0, s1), s2);
+    __m512i b0 = _mm512_mask_blend_epi8(m1, _mm512_mask_blend_epi8(m0, s1, s2), s0);
+    __m512i c0 = _mm512_mask_blend_epi8(m1, _mm512_mask_blend_epi8(m0, s2, s0), s1);
+    const __m512i sh_b = lanes_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13);
+    const __m512i sh_g = lanes_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14);
+    const __m512i sh_r = lanes_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15);
+    a = _mm512_shuffle_epi8(a0, sh_b);
+    b = _mm512_shuffle_epi8(b0, sh_g);
+    c = _mm512_shuffle_epi8(c0, sh_r);
+}
+
+static inline void load_deinterleave(const uint8_t* ptr, __m512i& a, __m512i& b, __m512i& c, __m512i& d) {
+    const __m512i sh = lanes_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    __m512i s0 = _mm512_shuffle_epi8(load_lanes(ptr,      64), sh);
+    __m512i s1 = _mm512_shuffle_epi8(load_lanes(ptr + 16, 64), sh);
+    __m512i s2 = _mm512_shuffle_epi8(load_lanes(ptr + 32, 64), sh);
+    __m512i s3 = _mm512_shuffle_epi8(load_lanes(ptr + 48, 64), sh);
+    __m512i t0 = _mm512_unpacklo_epi32(s0, s1);
+    __m512i t1 = _mm512_unpacklo_epi32(s2, s3);
+    __m512i t2 = _mm512_unpackhi_epi32(s0, s1);
+    __m512i t3 = _mm512_unpackhi_epi32(s2, s3);
+    a = _mm512_unpacklo_epi64(t0, t1);
+    b = _mm512_unpackhi_epi64(t0, t1);
+    c = _mm512_unpacklo_epi64(t2, t3);
+    d = _mm512_unpackhi_epi64(t2, t3);
+}
+
+static inline void store_interleave(uint8_t* ptr, __m512i a, __m512i b) {
+    store_lanes(ptr,      32, _mm512_unpacklo_epi8(a, b));
+    store_lanes(ptr + 16, 32, _mm512_unpackhi_epi8(a, b));
+}
+
+static inline void store_interleave(uint8_t* ptr, __m512i a, __m512i b, __m512i c) {
+    const __m512i sh_a = lanes_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5);
+    const __m512i sh_b = lanes_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10);
+    const __m512i sh_c = lanes_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15);
+    __m512i a0 = _mm512_shuffle_epi8(a, sh_a);
+    __m512i b0 = _mm512_shuffle_epi8(b, sh_b);
+    __m512i c0 = _mm512_shuffle_epi8(c, sh_c);
+
+    const __mmask64 m0 = mask_c3_0;
+    const __mmask64 m1 = mask_c3_1;
+    store_lanes(ptr,      48, _mm512_mask_blend_epi8(m0, _mm512_mask_blend_epi8(m1, a0, b0), c0));
+    store_lanes(ptr + 16, 48, _mm512_mask_blend_epi8(m0, _mm512_mask_blend_epi8(m1, b0, c0), a0));
+    store_lanes(ptr + 32, 48, _mm512_mask_blend_epi8(m0, _mm512_mask_blend_epi8(m1, c0, a0), b0));
+}
+
+static inline void store_interleave(uint8_t* ptr, __m512i a, __m512i b, __m512i c, __m512i d) {
+    __m512i u0 = _mm512_unpacklo_epi8(a, b);
+    __m512i u1 = _mm512_unpackhi_epi8(a, b);
+    __m512i u2 = _mm512_unpacklo_epi8(c, d);
+    __m512i u3 = _mm512_unpackhi_epi8(c, d);
+    store_lanes(ptr,      64, _mm512_unpacklo_epi16(u0, u2));
+    store_lanes(ptr + 16, 64, _mm512_unpackhi_epi16(u0, u2));
+    store_lanes(ptr + 32, 64, _mm512_unpacklo_epi16(u1, u3));
+    store_lanes(ptr + 48, 64, _mm512_unpackhi_epi16(u1, u3));
+}
+
+// 32F: 4 pixels of a lane
+
+static inline void load_deinterleave(const float* ptr, __m512& a, __m512& b) {
+    __m512 s0 = load_lanes(ptr,     8);
+    __m512 s1 = load_lanes(ptr + 4, 8);
+    a = _mm512_shuffle_ps(s0, s1, _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm512_shuffle_ps(s0, s1, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static inline void load_deinterleave(const float* ptr, __m512& a, __m512& b, __m512& c) {
+    __m512 t0 = load_lanes(ptr,     12);
+    __m512 t1 = load_lanes(ptr + 4, 12);
+    __m512 t2 = load_lanes(ptr + 8, 12);
+
+    __m512 at12 = _mm512_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 1, 0, 2));
+    a = _mm512_shuffle_ps(t0, at12, _MM_SHUFFLE(2, 0, 3, 0));
+
+    __m512 bt01 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 0, 1));
+    __m512 bt12 = _mm512_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 2, 0, 3));
+    b = _mm512_shuffle_ps(bt01, bt12, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m512 ct01 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 1, 0, 2));
+    c = _mm512_shuffle_ps(ct01, t2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// 4x4 transpose in every lane, it both interleaves and deinterleaves 4 channels
+static inline void transpose4(__m512& a, __m512& b, __m512& c, __m512& d) {
+    __m512 t0 = _mm512_unpacklo_ps(a, b);
+    __m512 t1 = _mm512_unpacklo_ps(c, d);
+    __m512 t2 = _mm512_unpackhi_ps(a, b);
+    __m512 t3 = _mm512_unpackhi_ps(c, d);
+    a = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+    b = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+    c = _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    d = _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+static inline void load_deinterleave(const float* ptr, __m512& a, __m512& b, __m512& c, __m512& d) {
+    a = load_lanes(ptr,      16);
+    b = load_lanes(ptr + 4,  16);
+    c = load_lanes(ptr + 8,  16);
+    d = load_lanes(ptr + 12, 16);
+    transpose4(a, b, c, d);
+}
+
+static inline void store_interleave(float* ptr, __m512 a, __m512 b) {
+    store_lanes(ptr,     8, _mm512_unpacklo_ps(a, b));
+    store_lanes(ptr + 4, 8, _mm512_unpackhi_ps(a, b));
+}
+
+static inline void store_interleave(float* ptr, __m512 a, __m512 b, __m512 c) {
+    __m512 u0 = _mm512_shuffle_ps(a , b , _MM_SHUFFLE(0, 0, 0, 0));
+    __m512 u1 = _mm512_shuffle_ps(c , a , _MM_SHUFFLE(1, 1, 0, 0));
+    __m512 v0 = _mm512_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m512 u2 = _mm512_shuffle_ps(b , c , _MM_SHUFFLE(1, 1, 1, 1));
+    __m512 u3 = _mm512_shuffle_ps(a , b , _MM_SHUFFLE(2, 2, 2, 2));
+    __m512 v1 = _mm512_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    __m512 u4 = _mm512_shuffle_ps(c , a , _MM_SHUFFLE(3, 3, 2, 2));
+    __m512 u5 = _mm512_shuffle_ps(b , c , _MM_SHUFFLE(3, 3, 3, 3));
+    __m512 v2 = _mm512_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0));
+
+    store_lanes(ptr,     12, v0);
+    store_lanes(ptr + 4, 12, v1);
+    store_lanes(ptr + 8, 12, v2);
+}
+
+static inline void store_interleave(float* ptr, __m512 a, __m512 b, __m512 c, __m512 d) {
+    transpose4(a, b, c, d);
+    store_lanes(ptr,      16, a);
+    store_lanes(ptr + 4,  16, b);
+    store_lanes(ptr + 8,  16, c);
+    store_lanes(ptr + 12, 16, d);
+}
+
+//------------------------------------------------------------------------------
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                 const float *src0[],
+                 const float *src1[],
+                 const float  alpha[],
+                 const int    mapsx[],
+                 const float  beta[],
+                       float  tmp[],
+                 const Size & inSz,
+                 const Size & outSz,
+                       int    lpi) {
+    UNUSED(tmp);
+
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+            for (; x <= outSz.width - 16; x += 16) {
+                __m512  alpha0 = _mm512_loadu_ps(&alpha[x]);
+                __m512i sx = _mm512_loadu_si512(&mapsx[x]);
+
+                __m512 s00 = _mm512_i32gather_ps(sx, src0[l],     4);
+                __m512 s01 = _mm512_i32gather_ps(sx, src0[l] + 1, 4);
+                __m512 res0 = _mm512_fmadd_ps(_mm512_sub_ps(s00, s01), alpha0, s01);
+
+                __m512 s10 = _mm512_i32gather_ps(sx, src1[l],     4);
+                __m512 s11 = _mm512_i32gather_ps(sx, src1[l] + 1, 4);
+                __m512 res1 = _mm512_fmadd_ps(_mm512_sub_ps(s10, s11), alpha0, s11);
+
+                __m512 d = _mm512_fmadd_ps(_mm512_sub_ps(res0, res1), _mm512_set1_ps(beta0), res1);
+                _mm512_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                dst[l][x] = beta0*res0 + beta1*res1;
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        for (int l = 0; l < lpi; l++) {
+            int x = 0;
+
+            for (; x <= outSz.width - 16; x += 16) {
+                __m512  alpha0 = _mm512_loadu_ps(&alpha[x]);
+                __m512i sx = _mm512_loadu_si512(&mapsx[x]);
+
+                __m512 s00 = _mm512_i32gather_ps(sx, src0[l],     4);
+                __m512 s01 = _mm512_i32gather_ps(sx, src0[l] + 1, 4);
+                _mm512_storeu_ps(&dst[l][x], _mm512_fmadd_ps(_mm512_sub_ps(s00, s01), alpha0, s01));
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                dst[l][x] = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+            for (; x <= length - 16; x += 16) {
+                __m512 s0 = _mm512_loadu_ps(&src0[l][x]);
+                __m512 s1 = _mm512_loadu_ps(&src1[l][x]);
+                _mm512_storeu_ps(&dst[l][x], _mm512_fmadd_ps(_mm512_sub_ps(s0, s1), _mm512_set1_ps(beta0), s1));
+            }
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length * sizeof(float));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC2(const uint8_t in0[],
+                   const uint8_t in1[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 64; l += 64) {
+        store_interleave(&out[2*l], load(&in0[l]), load(&in1[l]));
+    }
+
+    if (l < length && length >= 64) {
+        l = length - 64;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 64; l += 64) {
+        store_interleave(&out[3*l], load(&in0[l]), load(&in1[l]), load(&in2[l]));
+    }
+
+    if (l < length && length >= 64) {
+        l = length - 64;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_8UC4(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                   const uint8_t in3[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 64; l += 64) {
+        store_interleave(&out[4*l], load(&in0[l]), load(&in1[l]), load(&in2[l]), load(&in3[l]));
+    }
+
+    if (l < length && length >= 64) {
+        l = length - 64;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void mergeRow_32FC2(const float in0[],
+                    const float in1[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        store_interleave(&out[2*l], _mm512_loadu_ps(&in0[l]), _mm512_loadu_ps(&in1[l]));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        store_interleave(&out[3*l], _mm512_loadu_ps(&in0[l]), _mm512_loadu_ps(&in1[l]), _mm512_loadu_ps(&in2[l]));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC4(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        store_interleave(&out[4*l], _mm512_loadu_ps(&in0[l]), _mm512_loadu_ps(&in1[l]),
+                                    _mm512_loadu_ps(&in2[l]), _mm512_loadu_ps(&in3[l]));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void splitRow_8UC2(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 64; l += 64) {
+        __m512i r0, r1;
+        load_deinterleave(&in[2*l], r0, r1);
+        store(&out0[l], r0);
+        store(&out1[l], r1);
+    }
+
+    if (l < length && length >= 64) {
+        l = length - 64;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 64; l += 64) {
+        __m512i r0, r1, r2;
+        load_deinterleave(&in[3*l], r0, r1, r2);
+        store(&out0[l], r0);
+        store(&out1[l], r1);
+        store(&out2[l], r2);
+    }
+
+    if (l < length && length >= 64) {
+        l = length - 64;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_8UC4(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                         uint8_t out3[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 64; l += 64) {
+        __m512i r0, r1, r2, r3;
+        load_deinterleave(&in[4*l], r0, r1, r2, r3);
+        store(&out0[l], r0);
+        store(&out1[l], r1);
+        store(&out2[l], r2);
+        store(&out3[l], r3);
+    }
+
+    if (l < length && length >= 64) {
+        l = length - 64;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+void splitRow_32FC2(const float in[],
+                          float out0[],
+                          float out1[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 r0, r1;
+        load_deinterleave(&in[2*l], r0, r1);
+        _mm512_storeu_ps(&out0[l], r0);
+        _mm512_storeu_ps(&out1[l], r1);
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 r0, r1, r2;
+        load_deinterleave(&in[3*l], r0, r1, r2);
+        _mm512_storeu_ps(&out0[l], r0);
+        _mm512_storeu_ps(&out1[l], r1);
+        _mm512_storeu_ps(&out2[l], r2);
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC4(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                          float out3[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 r0, r1, r2, r3;
+        load_deinterleave(&in[4*l], r0, r1, r2, r3);
+        _mm512_storeu_ps(&out0[l], r0);
+        _mm512_storeu_ps(&out1[l], r1);
+        _mm512_storeu_ps(&out2[l], r2);
+        _mm512_storeu_ps(&out3[l], r3);
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
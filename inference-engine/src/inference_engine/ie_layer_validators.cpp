@@ -970,6 +970,13 @@ void GatherValidator::checkShapes(const CNNLayer* layer, const vector<SizeVector
     }
 
     size_t numInputs = inShapes.size();
+    if (casted->params.find("embedding_size") != casted->params.end()) {
+        // The dictionary is a blob of the layer, indexes are the only input
+        if (numInputs != 1)
+            THROW_IE_EXCEPTION << "Gather with the dictionary blob can take only 1 input, but actually it has: "
+                               << numInputs;
+        return;
+    }
     if (numInputs != 2)
         THROW_IE_EXCEPTION << "Gather can take only 2 inputs, but actually it has: " << numInputs;
 
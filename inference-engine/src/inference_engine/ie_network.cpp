@@ -6,6 +6,7 @@
 #include <details/ie_inetwork_iterator.hpp>
 #include <details/caseless.hpp>
 #include <iterator>
+#include <unordered_set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -18,9 +19,10 @@ details::Network &details::Network::operator=(const details::Network &network) {
     name = network.getName();
     for (const auto& layer : network) {
         layers.push_back(Layer::Ptr(new details::Layer(*layer)));
+        layerIndex.emplace(layer->getId(), layers.back());
     }
     for (const auto& connection : network.connections) {
-        connections.push_back(connection);
+        addConnection(connection);
     }
     return *this;
 }
@@ -29,18 +31,13 @@ details::Network &details::Network::operator=(const INetwork &network) {
     if (this == &network)
         return *this;
     name = network.getName();
+    std::unordered_set<Connection, ConnectionHash> addedConnections(connections.begin(), connections.end());
     for (const auto& layer : network) {
         layers.push_back(std::make_shared<details::Layer>(*layer));
+        layerIndex.emplace(layer->getId(), layers.back());
         for (const auto& newConnection : network.getLayerConnections(layer->getId())) {
-            bool connectionFound = false;
-            for (const auto& connection : connections) {
-                if (connection == newConnection) {
-                    connectionFound = true;
-                    break;
-                }
-            }
-            if (!connectionFound)
-                connections.push_back(newConnection);
+            if (addedConnections.insert(newConnection).second)
+                addConnection(newConnection);
         }
     }
     return *this;
@@ -73,11 +70,10 @@ const Context& details::Network::getContext() const noexcept {
 }
 
 const ILayer::Ptr details::Network::getLayer(size_t id) const noexcept {
-    for (const auto& layer : layers) {
-        if (layer->getId() == id)
-            return std::static_pointer_cast<ILayer>(layer);
-    }
-    return nullptr;
+    auto it = layerIndex.find(id);
+    if (it == layerIndex.end())
+        return nullptr;
+    return std::static_pointer_cast<ILayer>(it->second);
 }
 
 const std::vector<ILayer::Ptr> details::Network::getInputs() const noexcept {
@@ -119,29 +115,33 @@ const std::vector<Connection>& details::Network::getConnections() const noexcept
 }
 
 details::Layer::Ptr details::Network::getLayer(size_t id) noexcept {
-    for (const auto& layer : layers) {
-        if (layer->getId() == id)
-            return layer;
-    }
-    return nullptr;
+    auto it = layerIndex.find(id);
+    return it == layerIndex.end() ? nullptr : it->second;
 }
 
 const std::vector<Connection> details::Network::getLayerConnections(idx_t layerId) const noexcept {
     std::vector<Connection> layerConnections;
-    for (auto& connection : connections) {
-        if (connection.from().layerId() == layerId || connection.to().layerId() == layerId)
-            layerConnections.push_back(connection);
-    }
+    auto it = connectionIndex.find(layerId);
+    if (it == connectionIndex.end())
+        return layerConnections;
+    for (size_t connectionIdx : it->second)
+        layerConnections.push_back(connections[connectionIdx]);
     return layerConnections;
 }
 
 void details::Network::addLayer(const ILayer::Ptr &layer) noexcept {
-    if (layer)
-        layers.push_back(std::make_shared<Layer>(*layer));
+    if (!layer)
+        return;
+    layers.push_back(std::make_shared<Layer>(*layer));
+    // The first layer with the id is the one the lookup used to find
+    layerIndex.emplace(layer->getId(), layers.back());
 }
 
 void details::Network::addConnection(const Connection &connection) noexcept {
     connections.push_back(connection);
+    connectionIndex[connection.from().layerId()].push_back(connections.size() - 1);
+    if (connection.to().layerId() != connection.from().layerId())
+        connectionIndex[connection.to().layerId()].push_back(connections.size() - 1);
 }
 
 INetwork::const_iterator details::Network::begin() const noexcept {
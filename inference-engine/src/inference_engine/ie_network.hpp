@@ -6,6 +6,7 @@
 
 #include <ie_inetwork.hpp>
 #include <ie_blob.h>
+#include <unordered_map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -154,6 +155,19 @@ private:
     std::string name;
     std::vector<Layer::Ptr> layers;
     std::vector<Connection> connections;
+    // Layers by id and the positions of the connections of every layer
+    std::unordered_map<idx_t, Layer::Ptr> layerIndex;
+    std::unordered_map<idx_t, std::vector<size_t>> connectionIndex;
+};
+
+struct ConnectionHash {
+    size_t operator()(const Connection& connection) const noexcept {
+        size_t seed = 0;
+        for (idx_t value : {connection.from().layerId(), connection.from().portId(),
+                            connection.to().layerId(), connection.to().portId()})
+            seed ^= std::hash<idx_t>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
 };
 
 }  // namespace details
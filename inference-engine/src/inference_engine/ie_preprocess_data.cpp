@@ -4,13 +4,21 @@
 
 #include "cpu_detector.hpp"
 #include "blob_transform.hpp"
+#include "blob_factory.hpp"
 #include "ie_preprocess_data.hpp"
 #ifdef HAVE_SSE
 #include "ie_preprocess_data_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "ie_preprocess_data_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "ie_preprocess_data_avx512.hpp"
+#endif
 #include "ie_preprocess_gapi.hpp"
 
 #include <algorithm>
+#include <type_traits>
 
 namespace InferenceEngine {
 
@@ -27,6 +35,35 @@ template<> inline uint8_t saturate_cast(float res) {
     return static_cast<uint8_t>((std::max)(0, (std::min)(255, ires)));
 }
 
+// Row kernels of the FP32 resize for the widest ISA the CPU supports, nullptr if there are none
+struct RowKernels32F {
+    void (*lerpRows)(float dst[], const float src0[], const float src1[], float beta, int width);
+    void (*lerpCols)(float dst[], const float src[], const int xofs[], const float alpha[], int width);
+    void (*blendRows)(float dst[], const float src0[], float beta0, const float src1[], float beta1, int width);
+    void (*blendCols)(float dst[], const float src[], const int xofs[], const float alpha[], int width);
+};
+
+template<typename data_t> static const RowKernels32F* rowKernels32F() {
+    if (!std::is_same<data_t, float>::value)
+        return nullptr;
+
+#ifdef HAVE_AVX512
+    static const RowKernels32F avx512Kernels = {avx512::lerpRows_32F, avx512::lerpCols_32F,
+                                                avx512::blendRows_32F, avx512::blendCols_32F};
+    if (with_cpu_x86_avx512_core())
+        return &avx512Kernels;
+#endif
+
+#ifdef HAVE_AVX2
+    static const RowKernels32F avx2Kernels = {avx2::lerpRows_32F, avx2::lerpCols_32F,
+                                              avx2::blendRows_32F, avx2::blendCols_32F};
+    if (with_cpu_x86_avx2())
+        return &avx2Kernels;
+#endif
+
+    return nullptr;
+}
+
 template<typename data_t = float>
 void resize_bilinear(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
     Border border = {BORDER_REPLICATE, 0};
@@ -108,11 +145,21 @@ void resize_bilinear(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer)
         beta[dy - dst_go_y] = fy;
     }
 
+    // both taps of a row and of a column are inside the source, the border is never read
+    const RowKernels32F* kernels = src_full_width >= 2 && src_full_height >= 2 ? rowKernels32F<data_t>() : nullptr;
+
     auto full_pass = [&](int c, int y) {
         auto sptr_ = sptr + c * origSrcW * origSrcH;
         auto dptr_ = dptr + c * origDstW * origDstH;
         auto tptr_ = tptr;
 
+        if (kernels) {
+            auto srow = reinterpret_cast<const float*>(sptr_) + yofs[y] * sstep;
+            kernels->lerpRows(tptr_, srow, srow + sstep, beta[y], swidth);
+            kernels->lerpCols(reinterpret_cast<float*>(dptr_) + y * dstep, tptr_, xofs, alpha, dwidth);
+            return;
+        }
+
         for (int x = 0; x < swidth; x++) {
             bool use_constant0 = yofs[y] + 0 < 0 || yofs[y] + 0 >= src_full_height;
             bool use_constant1 = yofs[y] + 1 < 0 || yofs[y] + 1 >= src_full_height;
@@ -529,6 +576,8 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
             beta[dy*ksize + k] = cbuf[k];
     }
 
+    const RowKernels32F* kernels = rowKernels32F<data_t>();
+
     auto full_pass = [&](const data_t* sptr_, data_t* dptr_, int dy) {
         int bufstep = dwidth;
         const data_t* srows[MAX_ESIZE]={0};
@@ -559,6 +608,19 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
             prev_sy[k] = sy;
         }
 
+        if (kernels) {
+            for (int k = k0; k < ksize; k++) {
+                auto S = reinterpret_cast<const float*>(srows[k]);
+                kernels->blendCols(rows[k], S, xofs, alpha, xmax);
+                for (int dx = xmax; dx < dwidth; dx++)
+                    rows[k][dx] = S[xofs[dx]];
+            }
+
+            kernels->blendRows(reinterpret_cast<float*>(dptr_ + dstep*dy), rows[0], beta[dy*ksize],
+                               rows[1], beta[dy*ksize + 1], dwidth);
+            return;
+        }
+
         if (k0 < ksize)
             HResizeLinear<data_t>(srows + k0, reinterpret_cast<float**>(rows + k0), ksize - k0, xofs,
                                   reinterpret_cast<const float*>(alpha), swidth, dwidth, 1, xmin, xmax);
@@ -743,14 +805,43 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
 
 using namespace Resize;
 
+namespace {
+// A view of the n-th image of a batched blob
+Blob::Ptr make_batch_slot(const Blob::Ptr &blob, size_t n) {
+    const auto &desc = blob->getTensorDesc();
+    const auto &blk = desc.getBlockingDesc();
+
+    SizeVector dims = desc.getDims();
+    SizeVector blkDims = blk.getBlockDims();
+    dims[0] = blkDims[0] = 1;
+
+    BlockingDesc slotBlk(blkDims, blk.getOrder(), blk.getOffsetPadding() + n * blk.getStrides()[0],
+                         blk.getOffsetPaddingToData(), blk.getStrides());
+    TensorDesc slotDesc(desc.getPrecision(), dims, slotBlk);
+    slotDesc.setLayout(desc.getLayout());
+
+    return make_blob_with_precision(slotDesc, blob->buffer());
+}
+}  // namespace
+
 void PreProcessData::setRoiBlob(const Blob::Ptr &blob) {
     _roiBlob = blob;
+    _rois.clear();
+}
+
+void PreProcessData::setRoiBlob(const Blob::Ptr &blob, const std::vector<ROI> &rois) {
+    _roiBlob = blob;
+    _rois = rois;
 }
 
 Blob::Ptr PreProcessData::getRoiBlob() const {
     return _roiBlob;
 }
 
+const std::vector<ROI> &PreProcessData::getRois() const {
+    return _rois;
+}
+
 void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm, bool serial) {
     IE_PROFILING_AUTO_SCOPE_TASK(perf_preprocessing)
 
@@ -765,28 +856,50 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorith
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
+
+    if (!_rois.empty()) {
+        if (_rois.size() != outBlob->getTensorDesc().getDims()[0]) {
+            THROW_IE_EXCEPTION << "Input pre-processing is called with " << _rois.size()
+                               << " regions of interest for the batch of " << outBlob->getTensorDesc().getDims()[0];
+        }
+
+        // Every region goes through the same path as the ROI of a separate request, so a batch never costs
+        // more graph compilations than the requests it replaces
+        for (size_t i = 0; i < _rois.size(); i++) {
+            Blob::Ptr roiBlob = make_shared_blob(_roiBlob, _rois[i]);
+            Blob::Ptr slotBlob = make_batch_slot(outBlob, i);
+            if (!_preproc->preprocessWithGAPI(roiBlob, slotBlob, algorithm, serial)) {
+                resize(roiBlob, slotBlob, algorithm);
+            }
+        }
+        return;
+    }
+
     if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, serial)) {
         return;
     }
+    resize(_roiBlob, outBlob, algorithm);
+}
 
+void PreProcessData::resize(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm) {
     Blob::Ptr res_in, res_out;
-    if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
-            if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                _tmp1 = make_shared_blob<float>(Precision::FP32, NCHW, _roiBlob->dims());
+    if (inBlob->getTensorDesc().getLayout() == NHWC) {
+        if (!_tmp1 || _tmp1->getTensorDesc().getDims() != inBlob->getTensorDesc().getDims()) {
+            if (inBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp1 = make_shared_blob<float>(Precision::FP32, NCHW, inBlob->dims());
             } else {
-                _tmp1 = make_shared_blob<uint8_t>(Precision::U8, NCHW, _roiBlob->dims());
+                _tmp1 = make_shared_blob<uint8_t>(Precision::U8, NCHW, inBlob->dims());
             }
             _tmp1->allocate();
         }
 
         {
             IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_before)
-            blob_copy(_roiBlob, _tmp1);
+            blob_copy(inBlob, _tmp1);
         }
         res_in = _tmp1;
     } else {
-        res_in = _roiBlob;
+        res_in = inBlob;
     }
 
     if (outBlob->getTensorDesc().getLayout() == NHWC) {
@@ -805,7 +918,7 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorith
 
     {
         IE_PROFILING_AUTO_SCOPE_TASK(perf_resize)
-        resize(res_in, res_out, algorithm);
+        Resize::resize(res_in, res_out, algorithm);
     }
 
     if (res_out == _tmp2) {
@@ -7,6 +7,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "ie_blob.h"
 #include "ie_input_info.hpp"
@@ -24,6 +25,10 @@ class INFERENCE_ENGINE_API_CLASS(PreProcessData) {
      * @brief ROI blob.
      */
     Blob::Ptr _roiBlob = nullptr;
+    /**
+     * @brief Regions of the ROI blob filling the batch slots of the input, empty if the whole blob is resized.
+     */
+    std::vector<ROI> _rois;
     Blob::Ptr _tmp1 = nullptr;
     Blob::Ptr _tmp2 = nullptr;
 
@@ -38,6 +43,8 @@ class INFERENCE_ENGINE_API_CLASS(PreProcessData) {
     InferenceEngine::ProfilingTask perf_reorder_after {"Reorder after"};
     InferenceEngine::ProfilingTask perf_preprocessing {"Preprocessing"};
 
+    void resize(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm);
+
 public:
     /**
      * @brief Sets ROI blob to be resized and placed to the default input blob during pre-processing.
@@ -45,12 +52,26 @@ public:
      */
     void setRoiBlob(const Blob::Ptr &blob);
 
+    /**
+     * @brief Sets a frame whose regions are resized and placed to the consecutive batch slots of the default input
+     * blob during pre-processing.
+     * @param blob Frame blob.
+     * @param rois Regions of the frame.
+     */
+    void setRoiBlob(const Blob::Ptr &blob, const std::vector<ROI> &rois);
+
     /**
      * @brief Gets pointer to the ROI blob used for a given input.
      * @return Blob pointer.
      */
     Blob::Ptr getRoiBlob() const;
 
+    /**
+     * @brief Gets the regions of the ROI blob filling the batch slots of the input.
+     * @return Regions, empty if the whole ROI blob is resized.
+     */
+    const std::vector<ROI> &getRois() const;
+
     /**
      * @brief Executes input pre-processing with a given resize algorithm.
      * @param outBlob pre-processed output blob to be used for inference.
@@ -71,6 +92,8 @@ static inline uint8_t saturateU32toU8(uint32_t v) {
     return static_cast<uint8_t>(v > UINT8_MAX ? UINT8_MAX : v);
 }
 
+void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorithm);
+
 void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer);
 
 void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer);
@@ -7,11 +7,20 @@
 
 // AFTER "ie_preprocess_gapi_kernels_impl.hpp"
 // (MANUAL_SIMD is defined there)
+#include "cpu_detector.hpp"
+
 #if MANUAL_SIMD
-  #include "cpu_detector.hpp"
   #include "ie_preprocess_gapi_kernels_sse42.hpp"
 #endif
 
+#ifdef HAVE_AVX2
+  #include "ie_preprocess_gapi_kernels_avx2.hpp"
+#endif
+
+#ifdef HAVE_AVX512
+  #include "ie_preprocess_gapi_kernels_avx512.hpp"
+#endif
+
 #include <opencv2/gapi/opencv_includes.hpp>
 #include <opencv2/gapi/fluid/gfluidkernel.hpp>
 #include <opencv2/gapi/gcompoundkernel.hpp>
@@ -26,48 +35,64 @@ namespace gapi {
 
 namespace kernels {
 
+// the same dispatch for every ISA namespace, the widest ISA the CPU supports goes first
+#define MERGE_ROW_SIMD(ISA) \
+    if (std::is_same<T, uint8_t>::value && chs == 2) {                   \
+        ISA::mergeRow_8UC2(ins[0], ins[1], out, length);                 \
+        return;                                                          \
+    }                                                                    \
+                                                                         \
+    if (std::is_same<T, uint8_t>::value && chs == 3) {                   \
+        ISA::mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);         \
+        return;                                                          \
+    }                                                                    \
+                                                                         \
+    if (std::is_same<T, uint8_t>::value && chs == 4) {                   \
+        ISA::mergeRow_8UC4(ins[0], ins[1], ins[2], ins[3], out, length); \
+        return;                                                          \
+    }                                                                    \
+                                                                         \
+    if (std::is_same<T, float>::value && chs == 2) {                     \
+        ISA::mergeRow_32FC2(reinterpret_cast<const float*>(ins[0]),      \
+                            reinterpret_cast<const float*>(ins[1]),      \
+                            reinterpret_cast<float*>(out), length);      \
+        return;                                                          \
+    }                                                                    \
+                                                                         \
+    if (std::is_same<T, float>::value && chs == 3) {                     \
+        ISA::mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),      \
+                            reinterpret_cast<const float*>(ins[1]),      \
+                            reinterpret_cast<const float*>(ins[2]),      \
+                            reinterpret_cast<float*>(out), length);      \
+        return;                                                          \
+    }                                                                    \
+                                                                         \
+    if (std::is_same<T, float>::value && chs == 4) {                     \
+        ISA::mergeRow_32FC4(reinterpret_cast<const float*>(ins[0]),      \
+                            reinterpret_cast<const float*>(ins[1]),      \
+                            reinterpret_cast<const float*>(ins[2]),      \
+                            reinterpret_cast<const float*>(ins[3]),      \
+                            reinterpret_cast<float*>(out), length);      \
+        return;                                                          \
+    }
+
 template<typename T, int chs> static
 void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int length) {
-#if MANUAL_SIMD
-    if (with_cpu_x86_sse42()) {
-        if (std::is_same<T, uint8_t>::value && chs == 2) {
-            mergeRow_8UC2(ins[0], ins[1], out, length);
-            return;
-        }
-
-        if (std::is_same<T, uint8_t>::value && chs == 3) {
-            mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);
-            return;
-        }
-
-        if (std::is_same<T, uint8_t>::value && chs == 4) {
-            mergeRow_8UC4(ins[0], ins[1], ins[2], ins[3], out, length);
-            return;
-        }
-
-        if (std::is_same<T, float>::value && chs == 2) {
-            mergeRow_32FC2(reinterpret_cast<const float*>(ins[0]),
-                           reinterpret_cast<const float*>(ins[1]),
-                           reinterpret_cast<float*>(out), length);
-            return;
-        }
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        MERGE_ROW_SIMD(avx512)
+    }
+#endif
 
-        if (std::is_same<T, float>::value && chs == 3) {
-            mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),
-                           reinterpret_cast<const float*>(ins[1]),
-                           reinterpret_cast<const float*>(ins[2]),
-                           reinterpret_cast<float*>(out), length);
-            return;
-        }
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        MERGE_ROW_SIMD(avx2)
+    }
+#endif
 
-        if (std::is_same<T, float>::value && chs == 4) {
-            mergeRow_32FC4(reinterpret_cast<const float*>(ins[0]),
-                           reinterpret_cast<const float*>(ins[1]),
-                           reinterpret_cast<const float*>(ins[2]),
-                           reinterpret_cast<const float*>(ins[3]),
-                           reinterpret_cast<float*>(out), length);
-            return;
-        }
+#if MANUAL_SIMD
+    if (with_cpu_x86_sse42()) {
+        MERGE_ROW_SIMD(kernels)
     }
 #endif
 
@@ -84,51 +109,68 @@ void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int leng
     }
 }
 
+#undef MERGE_ROW_SIMD
+
+#define SPLIT_ROW_SIMD(ISA) \
+    if (std::is_same<T, uint8_t>::value && chs == 2) {                      \
+        ISA::splitRow_8UC2(in, outs[0], outs[1], length);                   \
+        return;                                                             \
+    }                                                                       \
+                                                                            \
+    if (std::is_same<T, uint8_t>::value && chs == 3) {                      \
+        ISA::splitRow_8UC3(in, outs[0], outs[1], outs[2], length);          \
+        return;                                                             \
+    }                                                                       \
+                                                                            \
+    if (std::is_same<T, uint8_t>::value && chs == 4) {                      \
+        ISA::splitRow_8UC4(in, outs[0], outs[1], outs[2], outs[3], length); \
+        return;                                                             \
+    }                                                                       \
+                                                                            \
+    if (std::is_same<T, float>::value && chs == 2) {                        \
+        ISA::splitRow_32FC2(reinterpret_cast<const float*>(in),             \
+                            reinterpret_cast<float*>(outs[0]),              \
+                            reinterpret_cast<float*>(outs[1]),              \
+                            length);                                        \
+        return;                                                             \
+    }                                                                       \
+                                                                            \
+    if (std::is_same<T, float>::value && chs == 3) {                        \
+        ISA::splitRow_32FC3(reinterpret_cast<const float*>(in),             \
+                            reinterpret_cast<float*>(outs[0]),              \
+                            reinterpret_cast<float*>(outs[1]),              \
+                            reinterpret_cast<float*>(outs[2]),              \
+                            length);                                        \
+        return;                                                             \
+    }                                                                       \
+                                                                            \
+    if (std::is_same<T, float>::value && chs == 4) {                        \
+        ISA::splitRow_32FC4(reinterpret_cast<const float*>(in),             \
+                            reinterpret_cast<float*>(outs[0]),              \
+                            reinterpret_cast<float*>(outs[1]),              \
+                            reinterpret_cast<float*>(outs[2]),              \
+                            reinterpret_cast<float*>(outs[3]),              \
+                            length);                                        \
+        return;                                                             \
+    }
+
 template<typename T, int chs> static
 void splitRow(const uint8_t* in, std::array<uint8_t*, chs>& outs, int length) {
-#if MANUAL_SIMD
-    if (with_cpu_x86_sse42()) {
-        if (std::is_same<T, uint8_t>::value && chs == 2) {
-            splitRow_8UC2(in, outs[0], outs[1], length);
-            return;
-        }
-
-        if (std::is_same<T, uint8_t>::value && chs == 3) {
-            splitRow_8UC3(in, outs[0], outs[1], outs[2], length);
-            return;
-        }
-
-        if (std::is_same<T, uint8_t>::value && chs == 4) {
-            splitRow_8UC4(in, outs[0], outs[1], outs[2], outs[3], length);
-            return;
-        }
-
-        if (std::is_same<T, float>::value && chs == 2) {
-            splitRow_32FC2(reinterpret_cast<const float*>(in),
-                           reinterpret_cast<float*>(outs[0]),
-                           reinterpret_cast<float*>(outs[1]),
-                           length);
-            return;
-        }
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        SPLIT_ROW_SIMD(avx512)
+    }
+#endif
 
-        if (std::is_same<T, float>::value && chs == 3) {
-            splitRow_32FC3(reinterpret_cast<const float*>(in),
-                           reinterpret_cast<float*>(outs[0]),
-                           reinterpret_cast<float*>(outs[1]),
-                           reinterpret_cast<float*>(outs[2]),
-                           length);
-            return;
-        }
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        SPLIT_ROW_SIMD(avx2)
+    }
+#endif
 
-        if (std::is_same<T, float>::value && chs == 4) {
-            splitRow_32FC4(reinterpret_cast<const float*>(in),
-                           reinterpret_cast<float*>(outs[0]),
-                           reinterpret_cast<float*>(outs[1]),
-                           reinterpret_cast<float*>(outs[2]),
-                           reinterpret_cast<float*>(outs[3]),
-                           length);
-            return;
-        }
+#if MANUAL_SIMD
+    if (with_cpu_x86_sse42()) {
+        SPLIT_ROW_SIMD(kernels)
     }
 #endif
 
@@ -146,6 +188,8 @@ void splitRow(const uint8_t* in, std::array<uint8_t*, chs>& outs, int length) {
     }
 }
 
+#undef SPLIT_ROW_SIMD
+
 GAPI_FLUID_KERNEL(FMerge2, Merge2, false) {
     static const int LPI = 4;
     static const int Window = 1;
@@ -561,6 +605,34 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
         dst[l] = out.OutLine<T>(l);
     }
 
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core() && std::is_same<T, float>::value) {
+        avx512::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                  reinterpret_cast<const float**>(src0),
+                                  reinterpret_cast<const float**>(src1),
+                                  reinterpret_cast<const float*>(alpha),
+                                  reinterpret_cast<const int*>(mapsx),
+                                  reinterpret_cast<const float*>(beta),
+                                  reinterpret_cast<float*>(tmp),
+                                  inSz, outSz, lpi);
+        return;
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2() && std::is_same<T, float>::value) {
+        avx2::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                reinterpret_cast<const float**>(src0),
+                                reinterpret_cast<const float**>(src1),
+                                reinterpret_cast<const float*>(alpha),
+                                reinterpret_cast<const int*>(mapsx),
+                                reinterpret_cast<const float*>(beta),
+                                reinterpret_cast<float*>(tmp),
+                                inSz, outSz, lpi);
+        return;
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value) {
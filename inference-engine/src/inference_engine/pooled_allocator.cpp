@@ -0,0 +1,295 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooled_allocator.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+namespace InferenceEngine {
+
+/**
+ * Stored right before the user pointer. Its size equals to the alignment,
+ * so the user pointer keeps the alignment of the system block.
+ */
+struct alignas(MemoryPool::alignment) MemoryPool::BlockHeader {
+    size_t blockSize;   // bytes obtained from the system, including the header
+    size_t userSize;    // bytes requested by the caller
+    uint32_t sizeClass;
+    uint16_t arena;
+    uint8_t mapped;     // block was obtained with mmap
+};
+
+struct MemoryPool::Arena {
+    std::mutex guard;
+    std::vector<std::vector<BlockHeader*>> freeLists;
+    size_t cachedBytes = 0;
+};
+
+namespace {
+
+constexpr size_t minClassSize = MemoryPool::alignment;
+constexpr unsigned minClassLog2 = 6;
+constexpr unsigned stepsPerPow2 = 4;
+
+inline unsigned log2floor(size_t v) {
+    unsigned r = 0;
+    while (v >>= 1) r++;
+    return r;
+}
+
+/**
+ * Maps requested size to a size class:
+ *  class 0 holds blocks up to 64 bytes, then each (2^k, 2^(k+1)] range
+ *  is split into 4 classes of 2^k + j * 2^(k-2), j = 1..4
+ */
+inline uint32_t sizeClassOf(size_t size, size_t &classSize) {
+    if (size <= minClassSize) {
+        classSize = minClassSize;
+        return 0;
+    }
+    unsigned k = log2floor(size - 1);
+    size_t base = size_t(1) << k;
+    size_t step = base / stepsPerPow2;
+    size_t j = (size - base + step - 1) / step;
+    classSize = base + j * step;
+    return static_cast<uint32_t>(1 + (k - minClassLog2) * stepsPerPow2 + (j - 1));
+}
+
+size_t numaNodesCount() {
+#ifdef __linux__
+    // format is a list of ranges, e.g. "0-1" or "0,2-3"
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string ranges;
+    if (online && std::getline(online, ranges) && !ranges.empty()) {
+        size_t maxNode = 0;
+        size_t pos = 0;
+        while (pos < ranges.size()) {
+            size_t end = ranges.find_first_of(",", pos);
+            if (end == std::string::npos) end = ranges.size();
+            std::string range = ranges.substr(pos, end - pos);
+            size_t dash = range.find('-');
+            try {
+                maxNode = std::max(maxNode, static_cast<size_t>(std::stoul(
+                        dash == std::string::npos ? range : range.substr(dash + 1))));
+            } catch (...) {
+                return 1;
+            }
+            pos = end + 1;
+        }
+        return maxNode + 1;
+    }
+#endif
+    return 1;
+}
+
+MemoryPool::Config configFromEnv() {
+    auto env = [](const char *name) -> std::string {
+        const char *str = std::getenv(name);
+        return str ? str : "";
+    };
+    auto isOff = [](const std::string &var) {
+        return var == "N" || var == "NO" || var == "OFF" || var == "0";
+    };
+
+    MemoryPool::Config config;
+    config.pooling = !isOff(env("IE_ALLOCATOR_POOL"));
+
+    std::string hugePages = env("IE_ALLOCATOR_HUGEPAGES");
+    if (isOff(hugePages)) {
+        config.hugePages = MemoryPool::HugePages::OFF;
+    } else if (hugePages == "HUGETLB") {
+        config.hugePages = MemoryPool::HugePages::HUGETLB;
+    }
+
+    std::string cacheLimit = env("IE_ALLOCATOR_CACHE_LIMIT_MB");
+    if (!cacheLimit.empty()) {
+        try {
+            config.cacheLimit = static_cast<size_t>(std::stoull(cacheLimit)) * 1024 * 1024;
+        } catch (...) {}
+    }
+    return config;
+}
+
+}  // namespace
+
+MemoryPool& MemoryPool::instance() {
+    // Never destroyed on purpose: blobs owned by static objects of other
+    // libraries may be released after this library's static destructors.
+    static MemoryPool *pool = new MemoryPool(configFromEnv());
+    return *pool;
+}
+
+MemoryPool::MemoryPool(const Config &config)
+        : _config(config), _bytesLive(0), _bytesPeak(0), _bytesCached(0), _allocations(0), _poolHits(0) {
+    size_t arenas = _config.arenas ? _config.arenas : numaNodesCount();
+    for (size_t i = 0; i < arenas; i++) {
+        _arenas.emplace_back(new Arena());
+    }
+}
+
+MemoryPool::~MemoryPool() {
+    trim();
+}
+
+size_t MemoryPool::currentArena() const noexcept {
+    if (_arenas.size() == 1) return 0;
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return node % _arenas.size();
+    }
+#endif
+    return 0;
+}
+
+void* MemoryPool::systemAlloc(size_t &bytes, bool &mapped) noexcept {
+    mapped = false;
+#ifndef _WIN32
+    if (_config.hugePages != HugePages::OFF && bytes >= _config.hugePageThreshold) {
+        void *ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        if (_config.hugePages == HugePages::HUGETLB) {
+            // explicit hugepages can be unmapped only by whole pages
+            const size_t hugePageSize = 2 * 1024 * 1024;
+            size_t rounded = (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+            ptr = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr != MAP_FAILED) bytes = rounded;
+        }
+#endif
+        if (ptr == MAP_FAILED) {
+            ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+            if (ptr != MAP_FAILED) madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+        }
+        if (ptr != MAP_FAILED) {
+            mapped = true;
+            return ptr;
+        }
+    }
+    void *ptr = nullptr;
+    return posix_memalign(&ptr, alignment, bytes) == 0 ? ptr : nullptr;
+#else
+    return _aligned_malloc(bytes, alignment);
+#endif
+}
+
+void MemoryPool::systemFree(BlockHeader *block) noexcept {
+#ifndef _WIN32
+    if (block->mapped) {
+        munmap(block, block->blockSize);
+        return;
+    }
+    ::free(block);
+#else
+    _aligned_free(block);
+#endif
+}
+
+void* MemoryPool::allocate(size_t size) noexcept {
+    static_assert(sizeof(BlockHeader) == alignment, "BlockHeader must not break alignment of user pointer");
+    if (size > SIZE_MAX - 2 * sizeof(BlockHeader)) return nullptr;
+
+    size_t classSize = 0;
+    uint32_t sizeClass = sizeClassOf(size + sizeof(BlockHeader), classSize);
+    size_t arenaIdx = currentArena();
+
+    BlockHeader *block = nullptr;
+    if (_config.pooling) {
+        Arena &arena = *_arenas[arenaIdx];
+        std::lock_guard<std::mutex> lock(arena.guard);
+        if (sizeClass < arena.freeLists.size() && !arena.freeLists[sizeClass].empty()) {
+            block = arena.freeLists[sizeClass].back();
+            arena.freeLists[sizeClass].pop_back();
+            arena.cachedBytes -= block->blockSize;
+            _bytesCached -= block->blockSize;
+            _poolHits++;
+        }
+    }
+
+    if (!block) {
+        bool mapped = false;
+        size_t blockSize = classSize;
+        void *ptr = systemAlloc(blockSize, mapped);
+        if (!ptr) return nullptr;
+        block = reinterpret_cast<BlockHeader*>(ptr);
+        block->blockSize = blockSize;
+        block->sizeClass = sizeClass;
+        block->arena = static_cast<uint16_t>(arenaIdx);
+        block->mapped = mapped;
+    }
+    block->userSize = size;
+
+    _allocations++;
+    size_t live = (_bytesLive += size);
+    size_t peak = _bytesPeak.load();
+    while (live > peak && !_bytesPeak.compare_exchange_weak(peak, live)) {}
+
+    return block + 1;
+}
+
+void MemoryPool::deallocate(void *ptr) noexcept {
+    if (!ptr) return;
+    BlockHeader *block = reinterpret_cast<BlockHeader*>(ptr) - 1;
+    _bytesLive -= block->userSize;
+
+    if (_config.pooling) {
+        Arena &arena = *_arenas[block->arena];
+        std::lock_guard<std::mutex> lock(arena.guard);
+        if (arena.cachedBytes + block->blockSize <= _config.cacheLimit) {
+            try {
+                if (block->sizeClass >= arena.freeLists.size()) arena.freeLists.resize(block->sizeClass + 1);
+                arena.freeLists[block->sizeClass].push_back(block);
+                arena.cachedBytes += block->blockSize;
+                _bytesCached += block->blockSize;
+                return;
+            } catch (...) {
+                // no memory for the free list itself, release the block
+            }
+        }
+    }
+    systemFree(block);
+}
+
+void MemoryPool::trim() noexcept {
+    for (auto &arena : _arenas) {
+        std::lock_guard<std::mutex> lock(arena->guard);
+        for (auto &freeList : arena->freeLists) {
+            for (auto block : freeList) {
+                _bytesCached -= block->blockSize;
+                systemFree(block);
+            }
+            freeList.clear();
+        }
+        arena->cachedBytes = 0;
+    }
+}
+
+AllocatorStatistics MemoryPool::statistics() const noexcept {
+    AllocatorStatistics stats;
+    stats.bytesLive = _bytesLive.load();
+    stats.bytesPeak = _bytesPeak.load();
+    stats.bytesCached = _bytesCached.load();
+    stats.allocations = _allocations.load();
+    stats.poolHits = _poolHits.load();
+    return stats;
+}
+
+}  // namespace InferenceEngine
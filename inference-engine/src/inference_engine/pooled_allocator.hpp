@@ -0,0 +1,123 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides a declaration of the size-class memory pool used by the default allocator
+ * @file
+ */
+#pragma once
+
+#include "ie_allocator.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Process-wide pool of aligned memory blocks grouped by size classes.
+ *
+ * Every size class covers a quarter of a power-of-two range, so internal
+ * fragmentation never exceeds 25%. Released blocks are kept in the free list
+ * of the arena they were allocated from. There is one arena per NUMA node,
+ * an allocation takes a block from the arena of the node the calling thread
+ * runs on, so a reused block keeps its first-touch placement.
+ *
+ * Blocks above hugePageThreshold are mapped directly from the OS and backed by
+ * transparent hugepages (or by explicit MAP_HUGETLB pages when requested).
+ */
+class MemoryPool {
+public:
+    /** Alignment of every pointer returned by allocate() */
+    static constexpr size_t alignment = 64;
+
+    enum class HugePages {
+        OFF,      /**< never request hugepages */
+        MADVISE,  /**< map large blocks and advise transparent hugepages */
+        HUGETLB   /**< try MAP_HUGETLB first, fall back to MADVISE */
+    };
+
+    struct Config {
+        /** Keep released blocks for reuse. If false every free goes back to the system */
+        bool pooling = true;
+        HugePages hugePages = HugePages::MADVISE;
+        /** Blocks of this size and bigger are mapped directly */
+        size_t hugePageThreshold = 2 * 1024 * 1024;
+        /** Max amount of bytes each arena keeps in its free lists, bigger blocks go back to the system */
+        size_t cacheLimit = 64 * 1024 * 1024;
+        /** Number of arenas, 0 means one arena per NUMA node */
+        size_t arenas = 0;
+    };
+
+    /**
+     * @brief Default pool shared by all allocators created with CreateDefaultAllocator().
+     * Configured from IE_ALLOCATOR_POOL, IE_ALLOCATOR_HUGEPAGES and IE_ALLOCATOR_CACHE_LIMIT_MB
+     * environment variables.
+     */
+    static MemoryPool& instance();
+
+    explicit MemoryPool(const Config &config);
+    ~MemoryPool();
+
+    MemoryPool(const MemoryPool &) = delete;
+    MemoryPool& operator=(const MemoryPool &) = delete;
+
+    /** @return pointer aligned to MemoryPool::alignment or nullptr if the system is out of memory */
+    void* allocate(size_t size) noexcept;
+
+    /** Returns block obtained from allocate() to the pool. Accepts nullptr. */
+    void deallocate(void *ptr) noexcept;
+
+    /** Releases all cached blocks to the system */
+    void trim() noexcept;
+
+    AllocatorStatistics statistics() const noexcept;
+
+private:
+    struct BlockHeader;
+    struct Arena;
+
+    void* systemAlloc(size_t &bytes, bool &mapped) noexcept;
+    void systemFree(BlockHeader *block) noexcept;
+    size_t currentArena() const noexcept;
+
+    Config _config;
+    std::vector<std::unique_ptr<Arena>> _arenas;
+
+    std::atomic<size_t> _bytesLive;
+    std::atomic<size_t> _bytesPeak;
+    std::atomic<size_t> _bytesCached;
+    std::atomic<size_t> _allocations;
+    std::atomic<size_t> _poolHits;
+};
+
+/**
+ * @brief IAllocator facade over MemoryPool::instance(). Cheap to create, so every blob
+ * may own its instance while sharing the same pool.
+ */
+class PooledMemoryAllocator : public IAllocator {
+public:
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    void * alloc(size_t size) noexcept override {
+        return MemoryPool::instance().allocate(size);
+    }
+
+    bool free(void* handle) noexcept override {
+        MemoryPool::instance().deallocate(handle);
+        return true;
+    }
+};
+
+}  // namespace InferenceEngine
@@ -28,22 +28,41 @@ public:
         GatherLayer gatherLayer(lp);
         gatherLayer.params = params;
         gatherLayer.type = _type;
+        gatherLayer.blobs = blobs;
         validate(&gatherLayer, inShapes, params, blobs);
 
+        SizeVector dictionaryShape;
+        SizeVector indexesShape;
+        auto dictionary = blobs.find("dictionary");
+        if (dictionary != blobs.end()) {
+            size_t embeddingSize = gatherLayer.GetParamAsUInt("embedding_size");
+            if (embeddingSize == 0)
+                THROW_IE_EXCEPTION << "Incorrect embedding size of the dictionary blob";
+            dictionaryShape = {dictionary->second->size() / embeddingSize, embeddingSize};
+            indexesShape = inShapes[0];
+        } else {
+            dictionaryShape = inShapes[0];
+            indexesShape = inShapes[1];
+        }
+
+        // Lookups of the last indexes dimension are reduced into one row
+        if (gatherLayer.GetParamAsString("reduce", "none") != "none" && !indexesShape.empty())
+            indexesShape.pop_back();
+
         int axis = gatherLayer.axis;
         if (axis < 0)
-            axis += inShapes[0].size();
+            axis += dictionaryShape.size();
 
         outShapes.resize(1);
-        outShapes[0].resize(inShapes[0].size() + inShapes[1].size() - 1);
+        outShapes[0].resize(dictionaryShape.size() + indexesShape.size() - 1);
         for (size_t i = 0; i < axis; i++)
-            outShapes[0][i] = inShapes[0][i];
+            outShapes[0][i] = dictionaryShape[i];
 
-        for (size_t i = 0; i < inShapes[1].size(); i++)
-            outShapes[0][i + axis] = inShapes[1][i];
+        for (size_t i = 0; i < indexesShape.size(); i++)
+            outShapes[0][i + axis] = indexesShape[i];
 
-        for (size_t i = axis + 1; i < inShapes[0].size(); i++)
-            outShapes[0][i + inShapes[1].size() - 1] = inShapes[0][i];
+        for (size_t i = axis + 1; i < dictionaryShape.size(); i++)
+            outShapes[0][i + indexesShape.size() - 1] = dictionaryShape[i];
     }
 };
 
@@ -3,11 +3,22 @@
 //
 
 #include "system_alllocator.hpp"
+#include "pooled_allocator.hpp"
 
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept {
     try {
-        return new SystemMemoryAllocator();
+        return new InferenceEngine::PooledMemoryAllocator();
     }catch (...) {
         return nullptr;
     }
+}
+
+INFERENCE_ENGINE_API(void) GetDefaultAllocatorStatistics(InferenceEngine::AllocatorStatistics *stats) noexcept {
+    if (stats) {
+        *stats = InferenceEngine::MemoryPool::instance().statistics();
+    }
+}
+
+INFERENCE_ENGINE_API(void) ReleaseDefaultAllocatorCache() noexcept {
+    InferenceEngine::MemoryPool::instance().trim();
 }
\ No newline at end of file
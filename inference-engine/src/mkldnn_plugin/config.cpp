@@ -34,6 +34,48 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_THREAD
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MICRO_BATCH) {
+            if (val == PluginConfigParams::YES) {
+                microBatch = -1;
+            } else if (val == PluginConfigParams::NO) {
+                microBatch = 0;
+            } else {
+                int val_i;
+                try {
+                    val_i = std::stoi(val);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MICRO_BATCH
+                                       << ". Expected only YES/NO or positive numbers (micro-batch size)";
+                }
+                if (val_i <= 0)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MICRO_BATCH
+                                       << ". Expected only YES/NO or positive numbers (micro-batch size)";
+                microBatch = val_i;
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS) {
+            if (val == PluginConfigParams::YES) {
+                sparseWeightsThreshold = -1.f;
+            } else if (val == PluginConfigParams::NO) {
+                sparseWeightsThreshold = 0.f;
+            } else {
+                float val_f;
+                try {
+                    val_f = std::stof(val);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS
+                                       << ". Expected only YES/NO or a density threshold in (0, 1]";
+                }
+                if (val_f <= 0.f || val_f > 1.f)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS
+                                       << ". Expected only YES/NO or a density threshold in (0, 1]";
+                sparseWeightsThreshold = val_f;
+            }
         } else if (key == PluginConfigParams::KEY_DYN_BATCH_LIMIT) {
             int val_i = std::stoi(val);
             // zero and any negative value will be treated
@@ -52,7 +94,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
-            if (val == PluginConfigParams::CPU_THROUGHPUT_NUMA) {
+            tuneStreams = false;
+            if (val == PluginConfigParams::CPU_THROUGHPUT_TUNE) {
+                // the actual #streams is known only after the network is benchmarked
+                tuneStreams = true;
+                throughputStreams = 1;
+            } else if (val == PluginConfigParams::CPU_THROUGHPUT_NUMA) {
                 throughputStreams = MKLDNNPlugin::cpu::getNumberOfCPUSockets();
             } else if (val == PluginConfigParams::CPU_THROUGHPUT_AUTO) {
                 // bare minimum of streams (that evenly divides available number of core)
@@ -72,7 +119,7 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 } catch (const std::exception&) {
                     THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
                                        << ". Expected only positive numbers (#streams) or "
-                                       << "PluginConfigParams::CPU_THROUGHPUT_NUMA/CPU_THROUGHPUT_AUTO";
+                                       << "PluginConfigParams::CPU_THROUGHPUT_NUMA/CPU_THROUGHPUT_AUTO/CPU_THROUGHPUT_TUNE";
                 }
                 if (val_i > 0)
                     throughputStreams = val_i;
@@ -87,6 +134,18 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             }
             if (val_i > 0)
                 threadsNum = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_LATENCY_CAP) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_LATENCY_CAP
+                                   << ". Expected only non-negative numbers (milliseconds)";
+            }
+            tuneLatencyCap = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_TUNE_CACHE) {
+            // empty string means that the decisions are cached only in the process
+            tuneCacheFile = val;
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -102,8 +161,10 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
     }
-    if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
+    if (exclusiveAsyncRequests) {  // Exclusive request feature disables the streams
         throughputStreams = 1;
+        tuneStreams = false;
+    }
 }
 
 }  // namespace MKLDNNPlugin
@@ -14,10 +14,19 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool parallelBranches = false;
+    // 0 - the batch is executed as a whole, -1 - micro-batch size is chosen by the cache size, >0 - given size
+    int microBatch = 0;
+    // the density of the weight blocks below which a layer runs the sparse kernel: 0 - never, -1 - estimated per layer
+    float sparseWeightsThreshold = 0.f;
     std::string dumpToDot = "";
     int batchLimit = 0;
     int throughputStreams = 1;
     int threadsNum = 0;
+    // streams/threads are picked by benchmarking the network on load (see StreamsTuner)
+    bool tuneStreams = false;
+    int tuneLatencyCap = 0;
+    std::string tuneCacheFile = "";
 
     void readProperties(const std::map<std::string, std::string> &config);
 };
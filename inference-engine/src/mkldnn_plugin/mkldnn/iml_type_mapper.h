@@ -29,6 +29,8 @@ enum impl_desc_type {
     reorder = 1<<18,
     // winograd
     winograd = 1<<19,
+    // compressed weights
+    sparse = 1<<20,
     // real types
     ref_any             = ref  | any,
 
@@ -40,6 +42,7 @@ enum impl_desc_type {
     gemm_sse42          = gemm | sse42,
 
     jit_avx512_winograd = jit  | avx512 | winograd,
+    jit_avx2_winograd   = jit  | avx2   | winograd,
     jit_avx512          = jit  | avx512,
     jit_avx2            = jit  | avx2,
     jit_avx             = jit  | avx,
@@ -57,6 +60,9 @@ enum impl_desc_type {
     jit_avx_dw          = jit  | avx    | _dw,
     jit_sse42_dw        = jit  | sse42  | _dw,
     jit_uni_dw          = jit  | any    | _dw,
+
+    jit_avx512_sparse   = jit  | avx512 | sparse,
+    jit_avx2_sparse     = jit  | avx2   | sparse,
 };
 
 impl_desc_type parse_impl_name(std::string impl_desc_name);
@@ -11,6 +11,7 @@
 #include <fstream>
 #include <unordered_map>
 #include <memory>
+#include <typeinfo>
 #include "details/caseless.hpp"
 
 #include "mkldnn_graph.h"
@@ -20,6 +21,7 @@
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_depthwise_node.h>
 #include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
 
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
@@ -43,6 +45,7 @@
 #define XBYAK_NO_OP_NAMES
 #define XBYAK_UNDEF_JNL
 #include "../../thirdparty/mkl-dnn/src/cpu/xbyak/xbyak_util.h"
+#include "../../thirdparty/mkl-dnn/src/common/memory_pd.hpp"
 
 #include "cnn_network_stats_impl.hpp"
 
@@ -255,6 +258,11 @@ void MKLDNNGraph::CreateGraph(const ICNNNetwork &network, const MKLDNNExtensionM
 
     SortTopologically();
 
+    if (config.parallelBranches)
+        SplitIntoLevels();
+    // the actual size is chosen on the first inference
+    microBatchSize = config.microBatch ? -1 : 0;
+
     Allocate();
 
     CreatePrimitives();
@@ -552,8 +560,15 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // a convolution of a depth-first chain writes its output while the head of the chain runs
+            MKLDNNNode *parent = edge->getParent().get();
+            auto *convNode = dynamic_cast<MKLDNNConvolutionNode *>(parent);
+            if (convNode && convNode->getDepthFirstHead())
+                parent = convNode->getDepthFirstHead();
+
+            // with concurrent branches nodes of the same level run simultaneously, so they share the timestamp
+            int e_start = executionLevels.empty() ? parent->execIndex : parent->execLevel;
+            int e_finish = executionLevels.empty() ? edge->getChild()->execIndex : edge->getChild()->execLevel;
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -583,6 +598,13 @@ void MKLDNNGraph::AllocateWithReuse() {
         if (isInput  | isConst) box.start = 0;
         if (isOutput | isConst) box.finish = -1;
 
+        // With micro-batches the graph runs once per micro-batch, the intermediate data of a micro-batch
+        // is consumed within its run, but the inputs and outputs of the whole batch live through all the runs
+        if (microBatchSize && (isInput | isOutput)) {
+            box.start = 0;
+            box.finish = -1;
+        }
+
         box.size = div_up(box.size, alignment);
     }
 
@@ -626,6 +648,10 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     for (auto& node : graphNodes) {
+        if (auto *convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get()))
+            convNode->setSparseWeightsThreshold(config.sparseWeightsThreshold);
+        if (auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get()))
+            fcNode->setSparseWeightsThreshold(config.sparseWeightsThreshold);
         node->createPrimitive();
     }
 }
@@ -715,8 +741,23 @@ void MKLDNNGraph::Infer(int batch) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
+#if IE_THREAD != IE_THREAD_TBB
+    // TBB arena is resized by the callers (outside of the arena)
+    FollowCores();
+#endif
 
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    if (microBatchSize)
+        InferMicroBatches(batch, stream);
+    else
+        ExecuteNodes(batch, stream);
+}
+
+void MKLDNNGraph::ExecuteNodes(int batch, mkldnn::stream &stream) {
+    if (!executionLevels.empty()) {
+        InferLevels(batch, stream);
+        return;
+    }
     for (int i = 0; i < graphNodes.size(); i++) {
         PERF(graphNodes[i]);
 
@@ -734,6 +775,188 @@ void MKLDNNGraph::Infer(int batch) {
     }
 }
 
+namespace {
+// memory of the edge holds a sample per batch item, so it can be viewed at a micro-batch
+bool isBatchedEdge(const MKLDNNEdgePtr &edge, int maxBatch) {
+    return !edge->getParent()->isConstant() && edge->getDims().ndims() > 0 && edge->getDims()[0] == maxBatch &&
+           edge->getMemory().GetDescriptor().data.format != mkldnn_wino_fmt;
+}
+}  // namespace
+
+int MKLDNNGraph::ChooseMicroBatch(int maxBatch) {
+    if (config.microBatch > 0)
+        return config.microBatch;
+
+    // the largest inputs+outputs of a node per batch item
+    size_t footprint = 0;
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        size_t bytes = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            if (isBatchedEdge(node->getParentEdgeAt(i), maxBatch))
+                bytes += node->getParentEdgeAt(i)->getMemory().GetSize() / maxBatch;
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            if (isBatchedEdge(node->getChildEdgeAt(i), maxBatch))
+                bytes += node->getChildEdgeAt(i)->getMemory().GetSize() / maxBatch;
+        }
+        footprint = std::max(footprint, bytes);
+    }
+    if (!footprint)
+        return maxBatch;
+
+    return static_cast<int>(std::max<size_t>(1, std::min<size_t>(maxBatch, MicroBatchCacheSize() / footprint)));
+}
+
+size_t MKLDNNGraph::MicroBatchCacheSize() const {
+    // the threads of the stream share the micro-batch, half of their L2 is left for the weights
+    return static_cast<size_t>(mkldnn_get_cache_size(2, true)) * parallel_get_max_threads() / 2;
+}
+
+void MKLDNNGraph::InferMicroBatches(int batch, mkldnn::stream &stream) {
+    const int maxBatch = inputNodes.begin()->second->getChildEdgeAt(0)->getDims()[0];
+    const int total = batch > 0 ? std::min(batch, maxBatch) : maxBatch;
+    // chosen inside the stream, where the #threads is known
+    if (microBatchSize < 0)
+        microBatchSize = ChooseMicroBatch(maxBatch);
+    if (microBatchSize >= total) {
+        ExecuteNodes(batch, stream);
+        return;
+    }
+
+    // the primitives follow the data handles of their memories, so the whole graph is run
+    // for a micro-batch by shifting every batched memory to the first sample of the micro-batch
+    // mkldnn zeroes the padding of the samples of its descriptor on every data handle change, the descriptor
+    // is cut to the micro-batch, so a shifted handle zeroes the padding of the micro-batch only
+    struct BatchedMemory {
+        std::shared_ptr<mkldnn::memory> memory;
+        mkldnn_memory_desc_t *desc;
+        char *base;
+        size_t stride;
+    };
+    std::vector<BatchedMemory> batched;
+    for (auto &edge : graphEdges) {
+        if (!isBatchedEdge(edge, maxBatch))
+            continue;
+        const auto &memory = edge->getMemoryPtr()->GetPrimitivePtr();
+        // views and in-place edges may share the memory object
+        if (std::find_if(batched.begin(), batched.end(),
+                         [&](const BatchedMemory &m) { return m.memory == memory; }) != batched.end())
+            continue;
+        auto *desc = const_cast<mkldnn_memory_desc_t *>(
+                static_cast<const mkldnn::impl::memory_pd_t *>(memory->mkldnn::primitive::get_primitive_desc())->desc());
+        const size_t stride = desc->layout_desc.blocking.strides[0][0] *
+                              MKLDNNExtensionUtils::sizeOfDataType(edge->getMemory().GetDataType());
+        batched.push_back({memory, desc, static_cast<char *>(memory->get_data_handle()), stride});
+    }
+
+    auto setSamples = [](BatchedMemory &m, int samples) {
+        m.desc->dims[0] = samples;
+        m.desc->layout_desc.blocking.padding_dims[0] = samples;
+    };
+    auto restore = [&] {
+        for (auto &m : batched) {
+            setSamples(m, maxBatch);
+            m.memory->set_data_handle(m.base);
+        }
+        // the outputs are pulled for the whole batch
+        for (auto &node : graphNodes)
+            node->setDynamicBatchLim(batch > 0 ? batch : 0);
+    };
+    try {
+        for (int start = 0; start < total; start += microBatchSize) {
+            const int samples = std::min(microBatchSize, total - start);
+            for (auto &m : batched) {
+                setSamples(m, samples);
+                m.memory->set_data_handle(m.base + start * m.stride);
+            }
+            ExecuteNodes(samples, stream);
+        }
+    } catch (...) {
+        restore();
+        throw;
+    }
+    restore();
+}
+
+void MKLDNNGraph::InferLevels(int batch, mkldnn::stream &stream) {
+    if (batch > 0) {
+        for (auto &node : graphNodes)
+            node->setDynamicBatchLim(batch);
+    }
+
+    auto executeNode = [this](const MKLDNNNodePtr &node, mkldnn::stream &strm) {
+        PERF(node);
+        ENABLE_DUMP(do_before(DUMP_DIR, node));
+        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+        node->execute(strm);
+        ENABLE_DUMP(do_after(DUMP_DIR, node));
+    };
+
+    for (size_t l = 0; l < executionLevels.size(); l++) {
+        const auto &level = executionLevels[l];
+        const size_t concurrent = concurrentNodes[l];
+        // the nodes using the shared scratchpad are executed one by one by the calling thread
+        for (size_t i = concurrent; i < level.size(); i++)
+            executeNode(level[i], stream);
+        if (concurrent == 1)
+            executeNode(level[0], stream);
+        if (concurrent < 2)
+            continue;
+        // independent nodes share the threads of the stream, the nested parallelism inside nodes is kept
+        std::vector<std::exception_ptr> errors(concurrent);
+        parallel_for(concurrent, [&](size_t i) {
+            try {
+                mkldnn::stream branchStream = mkldnn::stream(stream::kind::eager);
+                executeNode(level[i], branchStream);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (auto &error : errors) {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    }
+}
+
+void MKLDNNGraph::FollowCores() {
+    if (!cpuCores || cpuCores->generation() == pinnedGeneration)
+        return;
+    pinnedGeneration = cpuCores->generation();
+#if IE_THREAD == IE_THREAD_TBB
+    // the observer pins the threads on every arena entry, so the arena is re-created only when the #cores is changed
+    const int threads = std::max(1, std::min(threadsPerStream, cpuCores->streamThreads(streamId)));
+    if (ptrArena && ptrArena->max_concurrency() != threads) {
+        ptrObserver.reset();
+        ptrArena = std::unique_ptr<tbb::task_arena>(new tbb::task_arena(threads));
+        if (pinThreads)
+            ptrObserver = std::unique_ptr<tbb::task_scheduler_observer>(new pinning_observer(*ptrArena, cpuCores, streamId));
+    }
+#elif IE_THREAD == IE_THREAD_OMP
+    if (pinThreads)
+        PinThreads();
+    else
+        omp_set_num_threads(std::max(1, std::min(threadsPerStream, cpuCores->streamThreads(streamId))));
+#else
+    if (pinThreads)
+        PinThreads();
+#endif
+}
+
+void MKLDNNGraph::PinThreads() {
+    pinnedGeneration = cpuCores->generation();
+#if IE_THREAD == IE_THREAD_OMP
+    // threads beyond the cores of the stream would only compete for them
+    omp_set_num_threads(std::max(1, std::min(threadsPerStream, cpuCores->streamThreads(streamId))));
+    #pragma omp parallel
+    pin_current_thread_to_core(cpuCores->threadCore(streamId, omp_get_thread_num()));
+#elif IE_THREAD == IE_THREAD_SEQ
+    pin_current_thread_to_core(cpuCores->threadCore(streamId, 0));
+#endif
+}
+
 MKLDNNNodePtr MKLDNNGraph::FindNodeWithName(const std::string& name) const {
     if (inputNodes.empty()) {
         return std::shared_ptr<MKLDNNNode>();
@@ -795,6 +1018,60 @@ void MKLDNNGraph::SortTopologically() {
     graphNodes.assign(sorted.begin(), sorted.end());
 }
 
+// mkl-dnn is built without MKLDNN_ENABLE_CONCURRENT_EXEC, so the primitives with a scratchpad (gemm and winograd
+// convolutions, int8 gemm inner product, RNN) share the thread-local buffer of the thread that created them. Such
+// nodes are neither executed by the threads of parallel branches nor concurrently with each other.
+static bool usesSharedScratchpad(const MKLDNNNodePtr &node) {
+    if (node->getType() == RNN)
+        return true;
+    auto *selected = node->getSelectedPrimitiveDescriptor();
+    if (!selected)
+        return false;
+    const impl_desc_type type = selected->getImplementationType();
+    return (type & impl_desc_type::gemm) || (type & impl_desc_type::winograd);
+}
+
+void MKLDNNGraph::SplitIntoLevels() {
+    executionLevels.clear();
+    concurrentNodes.clear();
+    // state is carried between MemoryInput and MemoryOutput, so their order must be kept as is
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    // the level is the longest path from the graph inputs, nodes of the same level are independent
+    for (auto &node : graphNodes) {
+        node->execLevel = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            node->execLevel = std::max(node->execLevel, node->getParentEdgeAt(i)->getParent()->execLevel + 1);
+
+        if (node->isConstant())
+            continue;
+        if (executionLevels.size() <= static_cast<size_t>(node->execLevel))
+            executionLevels.resize(node->execLevel + 1);
+        executionLevels[node->execLevel].push_back(node);
+    }
+    executionLevels.erase(std::remove_if(executionLevels.begin(), executionLevels.end(),
+                                         [](const std::vector<MKLDNNNodePtr> &level) { return level.empty(); }),
+                          executionLevels.end());
+
+    // nodes that may run concurrently go first in the level, the ones using the shared scratchpad go last
+    bool hasBranches = false;
+    for (auto &level : executionLevels) {
+        auto exclusive = std::stable_partition(level.begin(), level.end(),
+                                               [](const MKLDNNNodePtr &node) { return !usesSharedScratchpad(node); });
+        concurrentNodes.push_back(static_cast<size_t>(exclusive - level.begin()));
+        hasBranches |= concurrentNodes.back() > 1;
+    }
+
+    // nothing to run concurrently, so the plain sequential order (and memory reuse) is kept
+    if (!hasBranches) {
+        executionLevels.clear();
+        concurrentNodes.clear();
+    }
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
             getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap, const MKLDNNNodePtr& node) {
@@ -1032,6 +1309,23 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
         return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs);
 }
 
+namespace {
+/**
+ * cloneNet() slices layers of types it isn't aware of (e.g. RNN cells) down to CNNLayer,
+ * so the copy is used only if every layer kept its type.
+ */
+details::CNNNetworkImplPtr cloneForBackgroundBuild(const ICNNNetwork &network) {
+    auto copy = cloneNet(network);
+    details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
+    for (; i != details::CNNNetworkIterator(); i++) {
+        CNNLayerPtr layer;
+        if (copy->getLayerByName((*i)->name.c_str(), layer, nullptr) != OK || typeid(*layer) != typeid(**i))
+            return nullptr;
+    }
+    return copy;
+}
+}  // namespace
+
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
@@ -1058,31 +1352,54 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
         }
     }
+    // micro-batches rely on the dynamic batch support of the nodes
+    Config graphCfg = cfg;
+    if (graphCfg.microBatch && !CanProcessDynBatch(clonedNetwork ? *clonedNetwork : network))
+        graphCfg.microBatch = 0;
     // check whether any (affinity-related) envs are set and if user requested thread binding
     const bool bPinningRequested = !check_env_variables() && cfg.useThreadBinding;
     // general #threads logic
     const int env_threads = parallel_get_env_threads();
+    // cores are claimed process-wide, so the networks loaded next to this one get the vacant cores
+    cpuCores = CPUResourceManager::instance().reserve(network.getName(), cfg.throughputStreams, cfg.threadsNum);
     // for streams need all (logical) cores, while single-stream case just physical cores (better for servers), as usual
-    const int hw_cores = cfg.throughputStreams > 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+    const int hw_cores = std::min(static_cast<int>(cpuCores->cores().size()),
+                                  cfg.throughputStreams > 1 ? parallel_get_max_threads() : getNumberOfCPUCores());
     const int threads = cfg.threadsNum ? cfg.threadsNum : (env_threads ? env_threads : hw_cores);
     const int threads_per_stream = std::max(1, threads/cfg.throughputStreams);
 
+    // with streams only the first graph is awaited, the rest are built in background from network copy,
+    // since the original network can be released right after loading
+    details::CNNNetworkImplPtr backgroundNetwork;
+    if (cfg.throughputStreams > 1)
+        backgroundNetwork = clonedNetwork ? clonedNetwork : cloneForBackgroundBuild(network);
+    // background tasks must not reference the caller's network, only the copy they own
+    const ICNNNetwork *syncNetwork = backgroundNetwork ? nullptr : (clonedNetwork ? clonedNetwork.get() : &network);
+    const bool isStreams = cfg.throughputStreams > 1;
+
     // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
     std::vector<Task::Ptr> tasks;
+    auto streamCores = cpuCores;
 
     for (int n = 0; n < cfg.throughputStreams; n++) {
         MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
         graphs.push_back(_graph);
-        auto task = std::make_shared<InferenceEngine::Task>([=, &cfg, &network]() {
+        auto task = std::make_shared<InferenceEngine::Task>([_graph, n, threads_per_stream, bPinningRequested,
+                                                             streamCores, graphCfg, extMgr, isStreams,
+                                                             backgroundNetwork, syncNetwork]() {
             _graph->CreateArena(threads_per_stream);
 
             if (bPinningRequested) {
-                _graph->CreateObserver(n, threads_per_stream);
+                _graph->CreateObserver(streamCores, n);
+            } else {
+                // no pinning, but the #threads still follows the cores currently assigned to the stream
+                _graph->AssignCores(streamCores, n);
             }
 
-            _graph->setConfig(cfg);
-            _graph->CreateGraph(clonedNetwork ? *clonedNetwork : network, extensionManager);
-            if (cfg.throughputStreams > 1)  // for streams, each worker thread has it's own graph
+            _graph->setConfig(graphCfg);
+            // the task owns backgroundNetwork, so it stays alive until the last stream is built
+            _graph->CreateGraph(backgroundNetwork ? *backgroundNetwork : *syncNetwork, extMgr);
+            if (isStreams)  // for streams, each worker thread has it's own graph
                 MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
         });
         tasks.push_back(task);
@@ -1090,7 +1407,19 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
     if (cfg.throughputStreams > 1) {
         // special executor with as many threads as requested #streams, each with it's own initialization task
-        _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(tasks);
+        auto executor = std::make_shared<MultiWorkerTaskExecutor>(tasks);
+        _taskExecutor = executor;
+        if (backgroundNetwork) {
+            // requests are accepted as soon as any stream is ready
+            if (executor->waitFirstReady() == 0) {
+                for (auto t : tasks)
+                    t->checkException();
+            }
+        } else {
+            executor->waitAllInitialized();
+            for (auto t : tasks)
+                t->checkException();
+        }
     } else {
         if (cfg.exclusiveAsyncRequests) {
             // special case when all InferRequests are muxed into a single queue
@@ -1099,12 +1428,19 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
         _taskExecutor->startTask(tasks[0]);
         Task::Status sts = tasks[0]->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+        tasks[0]->checkException();
     }
-    for (auto t : tasks)
-        t->checkException();
+}
+
+void MKLDNNExecNetwork::waitAllGraphs() {
+    auto streamsExecutor = std::dynamic_pointer_cast<MultiWorkerTaskExecutor>(_taskExecutor);
+    if (streamsExecutor)
+        streamsExecutor->waitAllInitialized();
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
+    // graphs of streams which are still being built read their config
+    waitAllGraphs();
     for (auto g : graphs)
         g->setProperty(properties);
 }
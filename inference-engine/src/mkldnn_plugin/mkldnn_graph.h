@@ -83,6 +83,7 @@ public:
     void DropNode(const MKLDNNNodePtr& node);
 
     void CreateArena(int threads_per_stream) {
+        threadsPerStream = threads_per_stream;
         #if IE_THREAD == IE_THREAD_OMP
         omp_set_num_threads(threads_per_stream);
         #elif IE_THREAD == IE_THREAD_TBB
@@ -90,27 +91,30 @@ public:
         #endif
     }
 
-    void CreateObserver(int _stream_id, int _threads_per_stream, int _pinning_step = 1) {
+    void CreateObserver(const CPUResourceManager::Reservation::Ptr& cores, int _stream_id) {
+        cpuCores = cores;
+        streamId = _stream_id;
+        pinThreads = true;
         #if IE_THREAD == IE_THREAD_TBB
         ptrObserver
                 = std::unique_ptr<tbb::task_scheduler_observer>(
-                new pinning_observer(*ptrArena.get(), _stream_id, _threads_per_stream, _pinning_step));
+                new pinning_observer(*ptrArena.get(), cores, _stream_id));
         #else
-        cpu_set_t *process_mask = nullptr;
-        int ncpus = 0;
-        get_process_mask(ncpus, process_mask);
-            #if IE_THREAD == IE_THREAD_OMP
-            #pragma omp parallel for
-                    for (int thread_index = 0; thread_index < _threads_per_stream; thread_index++) {
-                        pin_thread_to_vacant_core(_stream_id * _threads_per_stream + thread_index, 1, ncpus, process_mask);
-                    }
-            #elif IE_THREAD == IE_THREAD_SEQ
-            pin_thread_to_vacant_core(_stream_id * _threads_per_stream, 1, ncpus, process_mask);
-            #endif
-        CPU_FREE(process_mask);
+        PinThreads();
         #endif
     }
 
+    /* Same as CreateObserver, but the threads are not pinned, only their number follows the cores of the stream */
+    void AssignCores(const CPUResourceManager::Reservation::Ptr& cores, int _stream_id) {
+        cpuCores = cores;
+        streamId = _stream_id;
+        FollowCores();
+    }
+
+    /* Resizes the threads pool (and re-pins the threads) if the cores of the stream were reassigned since the last
+     * call, TBB requires this to be called outside of the arena */
+    void FollowCores();
+
 protected:
     MKLDNNNodePtr FindNodeWithName(const std::string& name) const;
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
@@ -124,6 +128,9 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executionLevels.clear();
+        concurrentNodes.clear();
+        microBatchSize = 0;
         _meanImages.clear();
     }
     Status status;
@@ -135,9 +142,22 @@ protected:
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
+    // groups of independent nodes executed concurrently (empty if the nodes are executed one by one)
+    std::vector<std::vector<MKLDNNNodePtr>> executionLevels;
+    // number of the leading nodes of every level that may be executed concurrently
+    std::vector<size_t> concurrentNodes;
+    // batch is executed by parts of this size (0 - as a whole, -1 - not chosen yet)
+    int microBatchSize = 0;
 
     std::map<std::string, MeanImage> _meanImages;
 
+    // cores of the stream, the threads are re-pinned whenever the cores are reassigned
+    CPUResourceManager::Reservation::Ptr cpuCores;
+    int streamId = 0;
+    int threadsPerStream = 0;
+    size_t pinnedGeneration = 0;
+    bool pinThreads = false;
+
     #if IE_THREAD == IE_THREAD_TBB
     std::unique_ptr<tbb::task_arena> ptrArena;
     std::unique_ptr<tbb::task_scheduler_observer> ptrObserver;
@@ -149,6 +169,14 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void PinThreads();
+    void SplitIntoLevels();
+    void ExecuteNodes(int batch, mkldnn::stream &stream);
+    void InferLevels(int batch, mkldnn::stream &stream);
+    int ChooseMicroBatch(int maxBatch);
+    // cache budget (bytes) the micro-batch data of a node is fitted into, tests override it to get a known size
+    virtual size_t MicroBatchCacheSize() const;
+    void InferMicroBatches(int batch, mkldnn::stream &stream);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -188,7 +216,12 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    // blocks until the graphs of all streams are built (the rest of streams may be still building after the load)
+    void waitAllGraphs();
+
 protected:
+    // cores claimed by the streams of the network in the process-wide CPUResourceManager
+    CPUResourceManager::Reservation::Ptr cpuCores;
     std::vector<MKLDNNGraph::Ptr> graphs;
     MKLDNNExtensionManager::Ptr extensionManager;
 
@@ -123,7 +123,9 @@ static std::map<Type, std::string> type_n2l {
     {Flatten, "Flatten"},
     {Permute, "Permute"},
     {MemoryOutput, "MemoryIn"},
-    {MemoryInput, "MemoryOut"}
+    {MemoryInput, "MemoryOut"},
+    {MVN, "MVN"},
+    {Normalize, "Normalize"}
 };
 
 static const std::string ORIGIN_NAMES = "origin";
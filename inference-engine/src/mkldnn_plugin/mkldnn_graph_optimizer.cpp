@@ -11,12 +11,14 @@
 #include "nodes/mkldnn_depthwise_node.h"
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
+#include "nodes/mkldnn_conv_node.h"
 
 #include <string>
 #include <list>
 #include <memory>
 #include <set>
 #include <ie_layers_internal.hpp>
+#include "details/caseless.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -49,6 +51,15 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionSumAndConvolutionSumActivation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseConvolutionsDepthFirst(graph);
+    graph.RemoveDroppedNodes();
+
+    FuseMVNAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
+    FuseSoftMaxAndArgMax(graph);
+    graph.RemoveDroppedNodes();
+
 
     graph.RemoveDroppedEdges();
 }
@@ -320,6 +331,154 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseConvolutionsDepthFirst(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    const size_t maxChainLength = 3;
+
+    auto isSuitableConvolution = [&](MKLDNNNodePtr node) {
+        if (!IsOneOf(node->getType(), {Convolution, Convolution_Activation, Convolution_Depthwise,
+                                       Convolution_Sum, Convolution_Sum_Activation}) ||
+                node->inDims[0].ndims() != 4)
+            return false;
+        // the depthwise convolution is fused as a post-op already
+        for (auto &fused : node->getFusedWith()) {
+            if (fused->getType() == Convolution || fused->getType() == Convolution_Activation)
+                return false;
+        }
+        return true;
+    };
+
+    auto isSum = [&](MKLDNNNodePtr node) {
+        return IsOneOf(node->getType(), {Convolution_Sum, Convolution_Sum_Activation});
+    };
+
+    // Returns the rows of the chain output in a band or 0 if the depth-first execution does not pay off:
+    // the intermediate tensors have to spill out of L2 while a band and the weights of the chain stay
+    // there, and the recomputed halo rows have to cost less than the traffic of the intermediate tensors.
+    auto getBandRows = [&](const std::vector<MKLDNNNodePtr> &chain) {
+        struct Stage {
+            int inRows, kernel, stride, padT;
+            size_t inRowBytes;
+            double rowOps;  // to compute an output row
+        };
+        std::vector<Stage> stages;
+        size_t weightsBytes = 0, interBytes = 0;
+        const int batch = chain[0]->inDims[0][0];
+        for (auto &node : chain) {
+            auto* layer = dynamic_cast<ConvolutionLayer*>(node->getCnnLayer().get());
+            auto allPads = getPaddings(*layer);
+            auto inDims = node->inDims[0];
+            auto outDims = node->outDims[0];
+
+            Stage stage;
+            stage.inRows = inDims[2];
+            stage.kernel = (layer->_kernel[Y_AXIS] - 1) * layer->_dilation[Y_AXIS] + 1;
+            stage.stride = layer->_stride[Y_AXIS];
+            stage.padT = allPads.begin[Y_AXIS];
+            stage.inRowBytes = inDims[1] * inDims[3] * layer->insData[0].lock()->getPrecision().size();
+            stage.rowOps = 2.0 * outDims[1] * outDims[3] * inDims[1] / layer->_group *
+                           layer->_kernel[X_AXIS] * layer->_kernel[Y_AXIS];
+            if (!stages.empty())
+                interBytes += batch * stage.inRows * stage.inRowBytes;
+            weightsBytes += layer->_weights->byteSize() + (layer->_biases ? layer->_biases->byteSize() : 0);
+            stages.push_back(stage);
+        }
+        const auto &tailDims = chain.back()->outDims[0];
+        const int outRows = tailDims[2];
+        const size_t outRowBytes = tailDims[1] * tailDims[3] *
+                                   chain.back()->getCnnLayer()->outData[0]->getPrecision().size();
+        const bool isInt8 = chain[0]->getCnnLayer()->precision == Precision::I8;
+
+        // the threads share a band, half of their L2 is left for the weights and the other data
+        const size_t cacheSize = static_cast<size_t>(mkldnn_get_cache_size(2, true)) * parallel_get_max_threads();
+        if (interBytes <= 2 * cacheSize || weightsBytes > cacheSize / 4)
+            return 0;
+
+        // walks the bands and returns the largest band in bytes, counts the recomputed operations
+        auto walkBands = [&](int bandRows, double &ops, bool &overlaps) {
+            size_t maxBytes = 0;
+            std::vector<int> inBegins;
+            std::vector<int> outEnds;
+            ops = 0;
+            for (int outBegin = 0; outBegin < outRows; outBegin += bandRows) {
+                int begin = outBegin, end = std::min(outRows, outBegin + bandRows);
+                size_t bytes = (end - begin) * outRowBytes;
+                outEnds.push_back(end);
+                for (int i = static_cast<int>(stages.size()) - 1; i >= 0; i--) {
+                    begin = std::max(0, begin * stages[i].stride - stages[i].padT);
+                    end = std::min(stages[i].inRows, (end - 1) * stages[i].stride - stages[i].padT + stages[i].kernel);
+                    bytes += (end - begin) * stages[i].inRowBytes;
+                    if (i > 0)
+                        ops += (end - begin) * stages[i - 1].rowOps;
+                }
+                inBegins.push_back(begin);
+                maxBytes = std::max(maxBytes, bytes);
+            }
+            // the output of a band with the sum is written after the next band is read
+            overlaps = false;
+            for (size_t b = 0; b + 2 < inBegins.size(); b++)
+                overlaps |= outEnds[b] > inBegins[b + 2];
+            return maxBytes;
+        };
+
+        int bandRows = 0;
+        double ops = 0;
+        bool overlaps = false;
+        for (int rows = 1; rows <= outRows; rows++) {
+            double rowsOps;
+            bool rowsOverlap;
+            if (walkBands(rows, rowsOps, rowsOverlap) + weightsBytes > cacheSize / 2)
+                break;
+            bandRows = rows;
+            ops = rowsOps;
+            overlaps = rowsOverlap;
+        }
+        if (!bandRows || (overlaps && isSum(chain.back())))
+            return 0;
+
+        double haloOps = ops * batch;
+        for (size_t i = 1; i < stages.size(); i++)
+            haloOps -= static_cast<double>(batch) * stages[i].inRows * stages[i - 1].rowOps;
+        // operations which are as expensive as a byte spilled to L3, the intermediate tensors are written and read
+        const double opsPerByte = isInt8 ? 16.0 : 4.0;
+        return haloOps <= opsPerByte * 2 * interBytes ? bandRows : 0;
+    };
+
+    std::set<MKLDNNNodePtr> chained;
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto head = graphNodes[i];
+        if (chained.count(head) || !isSuitableConvolution(head) || isSum(head))
+            continue;
+
+        std::vector<MKLDNNNodePtr> chain = {head};
+        while (chain.size() < maxChainLength && !isSum(chain.back()) && chain.back()->getChildEdges().size() == 1) {
+            auto parent = chain.back();
+            auto child = parent->getChildEdgeAt(0)->getChild();
+            if (chained.count(child) || !isSuitableConvolution(child) ||
+                    child->getCnnLayer()->precision != head->getCnnLayer()->precision ||
+                    child->getParentEdgeAt(0)->getParent() != parent)
+                break;
+            // the sum has to be the input of the chain, it is read before the output of the chain is written
+            if (isSum(child) ? child->getParentEdgeAt(1)->getParent() != head->getParentEdgeAt(0)->getParent()
+                             : child->getParentEdges().size() != 1)
+                break;
+            chain.push_back(child);
+        }
+
+        // try the shorter chains if the longest one does not pay off
+        for (; chain.size() > 1; chain.pop_back()) {
+            int bandRows = getBandRows(chain);
+            if (bandRows) {
+                auto *convNode = dynamic_cast<MKLDNNConvolutionNode *>(head.get());
+                convNode->setDepthFirstChain(chain, bandRows);
+                chained.insert(chain.begin(), chain.end());
+                break;
+            }
+        }
+    }
+}
+
 /**
  *  Check if there is a data dependency between parent and child
  *  BFS starting from parent and comparing with child
@@ -494,6 +653,116 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
 }
 
 
+void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        return node->getType() == MVN && node->getCnnLayer()->precision == Precision::FP32 &&
+               node->getChildEdges().size() == 1;
+    };
+
+    auto isSutableScaleShift = [](MKLDNNNodePtr node) {
+        if (node->getType() != Depthwise || !node->getCnnLayer() || node->getParentEdges().size() != 1)
+            return false;
+
+        // Scale shifts converting precisions are left for RemoveIOScaleShifts
+        auto layer = node->getCnnLayer();
+        auto input = layer->insData[0].lock();
+        if (!input || input->getPrecision() != Precision::FP32 || layer->outData[0]->getPrecision() != Precision::FP32)
+            return false;
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        return depthwiseNode && depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift;
+    };
+
+    // MVN keeps zero padded channels of blocked layouts zero, so only activations of zero to zero are fused
+    auto isSutableActivation = [](MKLDNNNodePtr node) {
+        if (node->getType() != Activation || !node->getCnnLayer())
+            return false;
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (!activationNode)
+            return false;
+        switch (activationNode->getAlgorithm()) {
+            case eltwise_relu:
+            case eltwise_bounded_relu:
+                return true;
+            case eltwise_clamp:
+                return activationNode->getAlpha() <= 0.0f && activationNode->getBeta() >= 0.0f;
+            default:
+                return false;
+        }
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto mvn = graphNodes[i];
+        if (!isSutableParentNode(mvn)) continue;
+
+        while (mvn->getChildEdges().size() == 1) {
+            auto child = mvn->getChildEdgeAt(0)->getChild();
+            if (isSutableScaleShift(child)) {
+                mvn->fuseWith(child);
+                graph.DropNode(child);
+            } else {
+                if (isSutableActivation(child)) {
+                    mvn->fuseWith(child);
+                    graph.DropNode(child);
+                }
+                break;
+            }
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseSoftMaxAndArgMax(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        return node->getType() == SoftMax && node->getCnnLayer()->precision == Precision::FP32 &&
+               node->getChildEdges().size() == 1 && node->getParentEdges().size() == 1;
+    };
+
+    // ArgMax over the softmax axis ranks the probabilities in the order of the logits
+    auto isSutableArgMax = [](MKLDNNNodePtr softmax, MKLDNNNodePtr node) {
+        if (node->getType() != Generic || !node->getCnnLayer() ||
+                !details::CaselessEq<std::string>()(node->getCnnLayer()->type, "ArgMax") ||
+                node->getParentEdges().size() != 1 || node->getChildEdges().empty())
+            return false;
+
+        auto* smLayer = dynamic_cast<SoftMaxLayer*>(softmax->getCnnLayer().get());
+        if (smLayer == nullptr)
+            return false;
+
+        auto layer = node->getCnnLayer();
+        const auto& dims = layer->insData[0].lock()->getTensorDesc().getDims();
+        int ndims = static_cast<int>(dims.size());
+        if (layer->params.find("axis") == layer->params.end()) {
+            // Without the axis the maximums are taken over all the dims but the batch
+            size_t inner = 1;
+            for (int i = 2; i < ndims; i++)
+                inner *= dims[i];
+            return smLayer->axis == 1 && inner == 1;
+        }
+        int axis = layer->GetParamAsInt("axis");
+        if (axis < 0)
+            axis += ndims;
+        return axis == smLayer->axis;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto softmax = graphNodes[i];
+        if (!isSutableParentNode(softmax)) continue;
+
+        auto argmax = softmax->getChildEdgeAt(0)->getChild();
+        if (!isSutableArgMax(softmax, argmax)) continue;
+
+        // The fused node produces the maximums and their indices instead of the probabilities
+        softmax->fuseWith(argmax);
+        softmax->outDims = argmax->outDims;
+        graph.DropNode(argmax);
+    }
+}
+
 void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
     for (MKLDNNNodePtr& node : graph.GetNodes()) {
         bool toDrop = false;
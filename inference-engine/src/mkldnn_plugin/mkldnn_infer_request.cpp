@@ -121,6 +121,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         graph->PullOutputData(_outputs);
     };
 #if IE_THREAD == IE_THREAD_TBB
+    graph->FollowCores();
     auto_scope_observing observer(graph->ptrObserver);
     // a TBB arena is made "this" for Infer call via executing lambda for the arena
     graph->ptrArena->execute([&] { infer(); });
@@ -36,6 +36,8 @@
 #include <nodes/mkldnn_permute_node.h>
 #include <nodes/mkldnn_memory_node.hpp>
 #include <nodes/mkldnn_rnn.h>
+#include <nodes/mkldnn_mvn_node.h>
+#include <nodes/mkldnn_normalize_node.h>
 #include <mkldnn_types.h>
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_plugin.h"
@@ -48,6 +50,10 @@ using namespace InferenceEngine::details;
 
 std::vector<MKLDNNNode::Registry::CreatorByLayerFunction> MKLDNNNode::Registry::_dataByLayer;
 
+// nodes are tried in the order of registration, so the native nodes registered before the generic one
+// are not shadowed by the implementations of the same layers in the cpu extension library
+MKLDNNNode::Register<MKLDNNMVNNode> MKLDNNMVNNode::reg;
+MKLDNNNode::Register<MKLDNNNormalizeNode> MKLDNNNormalizeNode::reg;
 MKLDNNNode::Register<MKLDNNGenericNode> MKLDNNGenericNode::reg;
 MKLDNNNode::Register<MKLDNNBatchNormalizationNode> MKLDNNBatchNormalizationNode::reg;
 MKLDNNNode::Register<MKLDNNConcatNode> MKLDNNConcatNode::reg;
@@ -314,6 +320,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(winograd);
     SEARCH_TYPE(_dw);
     SEARCH_TYPE(_1x1);
+    SEARCH_TYPE(sparse);
 
     if (type == impl_desc_type::unknown)
         str_type = "unknown";
@@ -532,6 +539,27 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
     return internalBlob;
 }
 
+// Builds a key of the memory layout from its meaningful fields only: the descriptor is a plain
+// struct with a union and padding, so its raw bytes are not stable between equal layouts
+static std::string layoutKey(const mkldnn::memory::desc &desc) {
+    const mkldnn_memory_desc_t &d = desc.data;
+    std::string key = std::to_string(d.format) + ":" + std::to_string(d.data_type);
+    for (int i = 0; i < d.ndims; i++)
+        key += "_" + std::to_string(d.dims[i]);
+    if (d.format == mkldnn_wino_fmt) {
+        const mkldnn_wino_desc_t &w = d.layout_desc.wino_desc;
+        for (int v : {static_cast<int>(w.wino_format), w.r, w.alpha, w.ic, w.oc,
+                      w.ic_block, w.oc_block, w.ic2_block, w.oc2_block})
+            key += ":" + std::to_string(v);
+    } else if (d.format != mkldnn_format_undef && d.format != mkldnn_any) {
+        const mkldnn_blocking_desc_t &b = d.layout_desc.blocking;
+        for (int i = 0; i < d.ndims; i++)
+            key += ":" + std::to_string(b.block_dims[i]) + "." + std::to_string(b.strides[0][i])
+                 + "." + std::to_string(b.strides[1][i]) + "." + std::to_string(b.padding_dims[i]);
+    }
+    return key;
+}
+
 void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd) {
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
@@ -554,9 +582,15 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         const auto &internalBlob = internalBlobs[i];
 
         const uint64_t data_hash =  Engine::GetWeightsSharing().GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize());
+        // the target layout is a part of the key: the same weights can be reordered differently,
+        // e.g. pre-transformed for winograd (wino_fmt) by one network and blocked by another
+        const std::string layout_key = layoutKey(intDescs[i]);
+        const uint64_t desc_hash = Engine::GetWeightsSharing().GetHashFunc().hash(
+                reinterpret_cast<const unsigned char *>(layout_key.data()), layout_key.size());
         const std::string string_hash = name + "_" + std::to_string(i)
                                      + "_" + std::to_string(internalBlob->byteSize())
-                                     + "_" + std::to_string(data_hash);
+                                     + "_" + std::to_string(data_hash)
+                                     + "_" + std::to_string(desc_hash);
         MKLDNNMemoryPtr ptr =
                 Engine::GetWeightsSharing().findOrCreate(string_hash, [&] () {
                     MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
@@ -711,6 +745,10 @@ std::string MKLDNNNode::typeToStr(Type type) {
             return "RNN";
         case LSTMCell:
             return "LSTMCell";
+        case MVN:
+            return "MVN";
+        case Normalize:
+            return "Normalize";
 
         default:
             return "Unknown";
@@ -728,6 +766,7 @@ const std::vector<impl_desc_type>& MKLDNNNode::getPrimitivesPriority() {
             impl_desc_type::jit_avx512,
             impl_desc_type::jit_avx2_dw,
             impl_desc_type::jit_avx2_1x1,
+            impl_desc_type::jit_avx2_winograd,
             impl_desc_type::jit_avx2,
             impl_desc_type::jit_avx_dw,
             impl_desc_type::jit_avx_1x1,
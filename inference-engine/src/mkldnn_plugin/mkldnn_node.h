@@ -61,7 +61,9 @@ enum Type {
     MemoryOutput,
     MemoryInput,
     LSTMCell,
-    RNN
+    RNN,
+    MVN,
+    Normalize
 };
 
 static Type TypeFromName(const std::string type) {
@@ -107,6 +109,9 @@ static Type TypeFromName(const std::string type) {
             { "Copy", Copy },
             { "LSTMCell", LSTMCell },
             { "RNN", RNN },
+            { "MVN", MVN },
+            { "Normalize", Normalize },
+            { "GRN", Normalize },
             { "MemoryInput", MemoryInput},  // for construction from name ctor, arbitrary name is used
             { "Memory", MemoryOutput },  // for construction from layer ctor
     };
@@ -140,6 +145,10 @@ public:
         return implementationType;
     }
 
+    void setImplementationType(impl_desc_type type) {
+        implementationType = type;
+    }
+
 private:
     InferenceEngine::LayerConfig config;
     impl_desc_type implementationType;
@@ -397,6 +406,7 @@ private:
     const std::string typeStr;
     Type type;
     int execIndex = -1;
+    int execLevel = -1;
 
     std::string typeToStr(Type type);
 
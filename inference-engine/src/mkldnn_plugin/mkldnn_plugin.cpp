@@ -4,8 +4,10 @@
 
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_streams_tuner.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include <memory>
+#include <iostream>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -48,6 +50,18 @@ Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map
         conf.batchLimit = network.getBatchSize();
     }
 
+    if (conf.tuneStreams) {
+        StreamsTuner tuner(extensionManager);
+        auto decision = tuner.tune(network, conf);
+        conf.tuneStreams = false;
+        conf.throughputStreams = decision.streams;
+        conf.threadsNum = decision.threads;
+        // the executable network has no config to query, so the picked split is reported on load
+        std::cout << "[ MKLDNNPlugin ] " << PluginConfigParams::CPU_THROUGHPUT_TUNE << ": " << decision.streams
+                  << " streams, " << decision.threads << " threads"
+                  << (decision.cached ? " (cached)" : "") << std::endl;
+    }
+
     return std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager);
 }
 
@@ -0,0 +1,82 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_sparse_weights.h"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+
+namespace {
+// The density of the weight blocks below which the sparse kernel beats the dense primitive. For a few input
+// vectors the dense primitive is bound by reading the weights, so the compressed ones win up to a high density.
+// Wide inputs (pixels of a convolution, large batches) make both compute bound, a kept block costs more than its
+// share of the dense FMAs then.
+float estimateThreshold(int columns) {
+    if (columns <= 32)
+        return 0.8f;
+    if (columns <= 128)
+        return 0.6f;
+    return 0.5f;
+}
+}  // namespace
+
+std::shared_ptr<MKLDNNSparseWeights> MKLDNNSparseWeights::create(int oc, int ic, const float *weights, int ldw,
+                                                                 const float *bias, const Layout& in,
+                                                                 const Layout& out, bool withSum, bool withRelu,
+                                                                 float reluAlpha, int columns, float threshold) {
+    using impl::cpu::jit_uni_sparse_sgemm;
+
+    if (threshold == 0.f || !jit_uni_sparse_sgemm::is_applicable(oc, ic, in, out))
+        return nullptr;
+    if (withRelu && (reluAlpha < 0.f || reluAlpha > 1.f))
+        return nullptr;
+    if (threshold < 0.f)
+        threshold = estimateThreshold(columns);
+
+    float density = jit_uni_sparse_sgemm::block_density(oc, ic, weights, ldw);
+    if (density >= threshold)
+        return nullptr;
+
+    std::shared_ptr<MKLDNNSparseWeights> sparseWeights(new MKLDNNSparseWeights());
+    sparseWeights->sgemm.reset(new jit_uni_sparse_sgemm(oc, ic, weights, ldw, bias, in, out, withSum, withRelu,
+                                                        reluAlpha));
+    sparseWeights->density = density;
+    return sparseWeights;
+}
+
+bool MKLDNNSparseWeights::getLayout(const MKLDNNMemory& mem, Layout& layout) {
+    auto desc = mem.GetDescriptor();
+    const auto &blk = desc.data.layout_desc.blocking;
+    if (desc.data.data_type != memory::f32 || blk.offset_padding != 0)
+        return false;
+
+    switch (mem.GetFormat()) {
+        case memory::nhwc:
+            // the pixels must follow one another
+            if (blk.strides[0][2] != blk.strides[0][3] * desc.data.dims[3])
+                return false;
+            layout = {desc.data.dims[1], 0, static_cast<size_t>(blk.strides[0][3])};
+            return true;
+        case memory::nchw:
+            // accepted for the input only: the kernel stores vectors of output channels, an nchw output is dense
+            if (blk.strides[0][2] != desc.data.dims[3] || blk.strides[0][3] != 1)
+                return false;
+            layout = {1, static_cast<size_t>(blk.strides[0][1]), 1};
+            return true;
+        case memory::nChw8c:
+        case memory::nChw16c:
+            if (blk.strides[0][2] != blk.strides[0][3] * desc.data.dims[3])
+                return false;
+            layout = {blk.block_dims[1], static_cast<size_t>(blk.strides[0][1]),
+                      static_cast<size_t>(blk.strides[0][3])};
+            return true;
+        default:
+            return false;
+    }
+}
+
+impl_desc_type MKLDNNSparseWeights::getImplementationType() {
+    return impl::cpu::jit_uni_sparse_sgemm::block_size() == 16 ? impl_desc_type::jit_avx512_sparse
+                                                               : impl_desc_type::jit_avx2_sparse;
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include "mkldnn_memory.h"
+#include "mkldnn/iml_type_mapper.h"
+#include "../../thirdparty/mkl-dnn/src/cpu/gemm/jit_uni_sparse_sgemm.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Weights of a pruned FullyConnected or 1x1 convolution compressed into blocks of the SIMD width of output
+ * channels, only the blocks with a non-zero value are kept. They are multiplied by a dedicated jit kernel
+ * instead of the dense mkl-dnn primitive.
+ */
+class MKLDNNSparseWeights {
+public:
+    using Layout = mkldnn::impl::cpu::jit_uni_sparse_sgemm::layout_t;
+
+    /**
+     * Compresses the OC x IC weights if the share of their non-zero blocks is below the threshold.
+     * @param columns the number of the input vectors (pixels or batch) of an execution, the threshold estimate
+     * depends on it
+     * @param threshold the density of the blocks the sparse kernel is used below, negative - estimated by the shape
+     * @return nullptr if the weights should stay dense
+     */
+    static std::shared_ptr<MKLDNNSparseWeights> create(int oc, int ic, const float *weights, int ldw, const float *bias,
+                                                       const Layout& in, const Layout& out, bool withSum,
+                                                       bool withRelu, float reluAlpha, int columns, float threshold);
+
+    /**
+     * Describes the pixels of an image of a 4D tensor as the columns of a matrix of its channels.
+     * @return false if the layout is not supported by the sparse kernel
+     */
+    static bool getLayout(const MKLDNNMemory& mem, Layout& layout);
+
+    /** Computes the output vectors of the columns of the input vectors (in the layouts given at creation) */
+    void execute(int columns, const float *src, float *dst) const {
+        sgemm->compute(columns, src, dst);
+    }
+
+    /** The implementation type of the nodes executed by the sparse kernel */
+    static impl_desc_type getImplementationType();
+
+    float getDensity() const {
+        return density;
+    }
+
+private:
+    MKLDNNSparseWeights() = default;
+
+    std::unique_ptr<mkldnn::impl::cpu::jit_uni_sparse_sgemm> sgemm;
+    float density = 1.f;
+};
+
+}  // namespace MKLDNNPlugin
@@ -6,9 +6,13 @@
 #include <map>
 #include <vector>
 #include <limits>
-#include <chrono>
 #include <climits>
 #include <memory>
+#include <sstream>
+#include <thread>
+#include <algorithm>
+#include <fstream>
+#include <utility>
 
 #include "mkldnn_graph.h"
 #include "ie_parallel.hpp"
@@ -58,56 +62,308 @@ bool get_process_mask(int& ncpus, cpu_set_t*& mask) {
 bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask) {
     return 0 == sched_setaffinity(0, ncores, proc_mask);
 }
-/* Pin thread to a spare core in the round-robin scheme, while respecting the given process mask.
- * The function can also handle the hyper-threading (by populating the physical cores first) */
-bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask) {
+/* Pin current thread to the single core (OS numbering) */
+bool pin_current_thread_to_core(int core) {
+    if (core < 0) return false;
+    const int ncores = core + 1;
     const size_t size = CPU_ALLOC_SIZE(ncores);
-    const int num_cpus = CPU_COUNT_S(size, proc_mask);
-    thr_idx %= num_cpus;  // To limit unique number in [; num_cpus-1] range
-
-    // Place threads with specified step
-    int cpu_idx = 0;
-    for (int i = 0, offset = 0; i < thr_idx; ++i) {
-        cpu_idx += hyperthreads;
-        if (cpu_idx >= num_cpus)
-            cpu_idx = ++offset;
-    }
-
-    // Find index of 'cpu_idx'-th bit that equals to 1
-    int mapped_idx = -1;
-    while (cpu_idx >= 0) {
-        if (CPU_ISSET_S(++mapped_idx, size, proc_mask))
-            --cpu_idx;
-    }
-
     cpu_set_t *target_mask = CPU_ALLOC(ncores);
+    if (!target_mask) return false;
     CPU_ZERO_S(size, target_mask);
-    CPU_SET_S(mapped_idx, size, target_mask);
+    CPU_SET_S(core, size, target_mask);
     bool res = pin_current_thread_by_mask(size, target_mask);
     CPU_FREE(target_mask);
     return res;
 }
+/* Cores (OS numbering) from the process affinity mask */
+static std::vector<int> get_process_cpus() {
+    std::vector<int> cpus;
+    cpu_set_t *mask = nullptr;
+    int ncpus = 0;
+    if (get_process_mask(ncpus, mask)) {
+        const size_t size = CPU_ALLOC_SIZE(ncpus);
+        for (int i = 0; i < ncpus; i++) {
+            if (CPU_ISSET_S(i, size, mask))
+                cpus.push_back(i);
+        }
+        CPU_FREE(mask);
+    }
+    return cpus;
+}
+/* Physical core of every cpu (ids are unique across the packages), empty if the topology is unknown */
+static std::vector<int> get_physical_core_ids(const std::vector<int>& cpus) {
+    std::vector<int> ids;
+    std::map<std::pair<int, int>, int> dense;
+    for (auto cpu : cpus) {
+        const std::string topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        int package = -1, core = -1;
+        std::ifstream(topology + "physical_package_id") >> package;
+        std::ifstream(topology + "core_id") >> core;
+        if (package < 0 || core < 0)
+            return {};
+        auto it = dense.insert({{package, core}, static_cast<int>(dense.size())}).first;
+        ids.push_back(it->second);
+    }
+    return ids;
+}
 #else   // no threads pinning/binding on Win/MacOS
 bool get_process_mask(int& ncpus, cpu_set_t*& mask) {
     ncpus = 0;
     mask =  nullptr;
     return false;
 }
-bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask) {
+bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask) {
     return false;
 }
-bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask) {
+bool pin_current_thread_to_core(int core) {
     return false;
 }
+static std::vector<int> get_process_cpus() {
+    return {};
+}
+static std::vector<int> get_physical_core_ids(const std::vector<int>&) {
+    return {};
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 
+CPUResourceManager& CPUResourceManager::instance() {
+    // never destroyed, since reservations of the networks may outlive the static objects at exit
+    static CPUResourceManager* manager = [] {
+        auto cpus = get_process_cpus();
+        if (cpus.empty()) {  // no affinity info (or pinning is not supported), just count the cores
+            for (int i = 0; i < std::max(1u, std::thread::hardware_concurrency()); i++)
+                cpus.push_back(i);
+        }
+        return new CPUResourceManager(cpus, get_physical_core_ids(cpus));
+    }();
+    return *manager;
+}
+
+CPUResourceManager::CPUResourceManager(const std::vector<int>& cpus, const std::vector<int>& coreIds)
+        : _cpus(cpus), _generation(0) {
+    if (_cpus.empty())
+        THROW_IE_EXCEPTION << "CPU resource manager requires at least one core";
+    if (!coreIds.empty() && coreIds.size() != cpus.size())
+        THROW_IE_EXCEPTION << "CPU resource manager expects a physical core id for every core";
+    // hyperthreads are grouped by the physical cores (in the order of the first cpu of the core)
+    std::map<int, size_t> index;
+    for (size_t i = 0; i < _cpus.size(); i++) {
+        const int id = coreIds.empty() ? static_cast<int>(i) : coreIds[i];
+        auto it = index.insert({id, _physical.size()}).first;
+        if (it->second == _physical.size())
+            _physical.emplace_back();
+        _physical[it->second].push_back(_cpus[i]);
+    }
+}
+
+CPUResourceManager::Reservation::Ptr CPUResourceManager::reserve(const std::string& network, int streams, int threads) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t id = _nextId++;
+    Reservation::Ptr reservation(new Reservation(*this, id));
+    _claims.push_back({id, network, std::max(1, streams), std::max(0, threads), reservation.get(), {}, {}});
+    rebalance();
+    return reservation;
+}
+
+void CPUResourceManager::release(size_t id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _claims.remove_if([id](const Claim& claim) { return claim.id == id; });
+    rebalance();
+}
+
+void CPUResourceManager::rebalance() {
+    const size_t nphysical = _physical.size();
+    std::vector<bool> taken(nphysical, false);
+    size_t nextShared = 0;
+    size_t fairClaims = 0;
+    // the explicit requests are served first (in the loading order), with a physical core per thread
+    for (auto& claim : _claims) {
+        claim.physical.clear();
+        if (!claim.threads) {
+            fairClaims++;
+            continue;
+        }
+        const size_t wanted = std::min<size_t>(claim.threads, nphysical);
+        for (size_t p = 0; p < nphysical && claim.physical.size() < wanted; p++) {
+            if (!taken[p]) {
+                taken[p] = true;
+                claim.physical.push_back(p);
+            }
+        }
+        // not enough vacant cores, so the rest are shared with other networks (each core is taken once)
+        std::vector<bool> own(nphysical, false);
+        for (auto p : claim.physical)
+            own[p] = true;
+        for (; claim.physical.size() < wanted; nextShared++) {
+            const size_t p = nextShared % nphysical;
+            if (!own[p]) {
+                own[p] = true;
+                claim.physical.push_back(p);
+            }
+        }
+        std::sort(claim.physical.begin(), claim.physical.end());
+    }
+
+    if (fairClaims) {
+        std::vector<size_t> pool;
+        for (size_t p = 0; p < nphysical; p++) {
+            if (!taken[p])
+                pool.push_back(p);
+        }
+        if (pool.empty()) {
+            for (size_t p = 0; p < nphysical; p++)
+                pool.push_back(p);
+        }
+        size_t idx = 0;
+        for (auto& claim : _claims) {
+            if (claim.threads)
+                continue;
+            if (pool.size() >= fairClaims) {
+                claim.physical.assign(pool.begin() + idx * pool.size() / fairClaims,
+                                      pool.begin() + (idx + 1) * pool.size() / fairClaims);
+            } else {
+                claim.physical.push_back(pool[idx % pool.size()]);
+            }
+            idx++;
+        }
+    }
+
+    // the streams read their cores without locking, so every reservation gets the new immutable snapshot
+    for (auto& claim : _claims) {
+        claim.cores = logicalCores(claim.physical);
+        auto snapshot = std::make_shared<Reservation::Snapshot>();
+        for (int s = 0; s < claim.streams; s++)
+            snapshot->push_back(streamCores(claim, s));
+        std::atomic_store(&claim.owner->_snapshot, std::shared_ptr<const Reservation::Snapshot>(snapshot));
+    }
+    _generation++;
+}
+
+const CPUResourceManager::Claim& CPUResourceManager::find(size_t id) const {
+    for (const auto& claim : _claims) {
+        if (claim.id == id)
+            return claim;
+    }
+    THROW_IE_EXCEPTION << "Unknown CPU cores reservation " << id;
+}
+
+std::vector<int> CPUResourceManager::logicalCores(const std::vector<size_t>& physical) const {
+    // the first hyperthreads of all the cores go first, so #threads less than #cores never share a physical core
+    std::vector<int> cores;
+    for (size_t level = 0; ; level++) {
+        bool any = false;
+        for (auto p : physical) {
+            if (level < _physical[p].size()) {
+                cores.push_back(_physical[p][level]);
+                any = true;
+            }
+        }
+        if (!any)
+            break;
+    }
+    return cores;
+}
+
+std::vector<int> CPUResourceManager::streamCores(const Claim& claim, int stream) const {
+    const size_t nphysical = claim.physical.size();
+    const size_t ncores = claim.cores.size();
+    const size_t nstreams = claim.streams;
+    stream %= claim.streams;
+    if (nphysical >= nstreams) {  // every stream gets the whole physical cores
+        return logicalCores(std::vector<size_t>(claim.physical.begin() + stream * nphysical / nstreams,
+                                                claim.physical.begin() + (stream + 1) * nphysical / nstreams));
+    }
+    if (ncores < nstreams)  // streams share the cores
+        return {claim.cores[stream % ncores]};
+    // streams get the hyperthreads of the same cores
+    return std::vector<int>(claim.cores.begin() + stream * ncores / nstreams,
+                            claim.cores.begin() + (stream + 1) * ncores / nstreams);
+}
+
+std::vector<CPUResourceManager::StreamCores> CPUResourceManager::coreMap() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<StreamCores> map;
+    for (const auto& claim : _claims) {
+        for (int s = 0; s < claim.streams; s++)
+            map.push_back({claim.network, s, streamCores(claim, s)});
+    }
+    return map;
+}
+
+std::string CPUResourceManager::coreMapToString() const {
+    std::stringstream str;
+    for (const auto& entry : coreMap()) {
+        str << entry.network << " stream " << entry.stream << ":";
+        for (auto core : entry.cores)
+            str << " " << core;
+        str << std::endl;
+    }
+    return str.str();
+}
+
+CPUResourceManager::Reservation::~Reservation() {
+    _manager.release(_id);
+}
+
+std::vector<int> CPUResourceManager::Reservation::cores() const {
+    std::lock_guard<std::mutex> lock(_manager._mutex);
+    return _manager.find(_id).cores;
+}
+
+std::shared_ptr<const CPUResourceManager::Reservation::Snapshot> CPUResourceManager::Reservation::snapshot() const {
+    return std::atomic_load(&_snapshot);
+}
+
+const std::vector<int>& CPUResourceManager::Reservation::stream(const Snapshot& snapshot, int stream) const {
+    return snapshot[std::max(0, stream) % snapshot.size()];
+}
+
+int CPUResourceManager::Reservation::streamThreads(int stream) const {
+    auto cores = snapshot();
+    return static_cast<int>(this->stream(*cores, stream).size());
+}
+
+int CPUResourceManager::Reservation::threadCore(int stream, int thread) const {
+    auto cores = snapshot();
+    const auto& streamCores = this->stream(*cores, stream);
+    // the extra threads (until the stream is resized to its cores) are not pinned rather than piled on a core
+    if (thread >= static_cast<int>(streamCores.size()))
+        return -1;
+    return streamCores[std::max(0, thread)];
+}
+
+size_t CPUResourceManager::Reservation::generation() const {
+    return _manager._generation;
+}
+
 MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& init_tasks, std::string name) :
-        _isStopped(false), _name(name), _initCount(0) {
+        _isStopped(false), _name(name), _initTotal(init_tasks.size()), _isInitFailed(false) {
     for (auto t : init_tasks) {
         _threads.push_back(std::thread([&, t] {
             // initialization (no contention, every worker thread is doing it's own task)
-            t->runNoThrowNoBusyCheck();
-            _initCount++;
+            bool isReady = t->runNoThrowNoBusyCheck() == Task::TS_DONE;
+            std::exception_ptr error;
+            if (!isReady) {
+                try {
+                    t->checkException();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(_initMutex);
+                _initDone++;
+                if (isReady)
+                    _readyCount++;
+                if (error && !_initError) {
+                    _initError = error;
+                    _isInitFailed = true;
+                }
+            }
+            _initCondVar.notify_all();
+            // the worker has no execution context, so the rest of workers serve the queue
+            if (!isReady)
+                return;
 
             while (!_isStopped) {
                 bool isQueueEmpty;
@@ -131,9 +387,20 @@ MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& i
             }
         }));
     }
-    while (_initCount != init_tasks.size()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
+}
+
+size_t MultiWorkerTaskExecutor::waitFirstReady() {
+    std::unique_lock<std::mutex> lock(_initMutex);
+    _initCondVar.wait(lock, [this]() { return _readyCount > 0 || _initDone == _initTotal; });
+    return _readyCount;
+}
+
+size_t MultiWorkerTaskExecutor::waitAllInitialized() {
+    std::unique_lock<std::mutex> lock(_initMutex);
+    _initCondVar.wait(lock, [this]() { return _initDone == _initTotal; });
+    if (_initError)
+        std::rethrow_exception(_initError);
+    return _readyCount;
 }
 
 MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
@@ -153,6 +420,10 @@ MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
 }
 
 bool MultiWorkerTaskExecutor::startTask(Task::Ptr task) {
+    if (_isInitFailed) {
+        std::lock_guard<std::mutex> lock(_initMutex);
+        std::rethrow_exception(_initError);
+    }
     if (!task->occupy()) return false;
     std::unique_lock<std::mutex> lock(_queueMutex);
     _taskQueue.push(task);
@@ -263,6 +534,7 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
         }
     };
 #if IE_THREAD == IE_THREAD_TBB
+    MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->FollowCores();
     auto_scope_observing observer(MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->ptrObserver);
     // a TBB arena is made "this" for Infer call via executing lambda for the arena
     MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->ptrArena->execute([&] { infer(); });
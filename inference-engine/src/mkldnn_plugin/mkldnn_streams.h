@@ -7,9 +7,12 @@
 #include <string>
 #include <vector>
 #include <atomic>
+#include <exception>
 #include <map>
 #include <queue>
 #include <memory>
+#include <list>
+#include <mutex>
 #include <climits>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
@@ -56,31 +59,120 @@ bool check_env_variables();
 bool get_process_mask(int& ncpus, cpu_set_t*& mask);
 /* Pin current thread to a set of cores determined by the mask. */
 bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask);
-/* Pin thread to a spare core in the round-robin scheme, while respecting the given process mask.
- * The function can also handle the hyper-threading (by populating the physical cores first) */
-bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask);
+/* Pin current thread to the single core (OS numbering) */
+bool pin_current_thread_to_core(int core);
+
+/* Process-wide bookkeeping of the cores used by the streams of the loaded executable networks.
+ * Cores are handed out as physical cores (with all their hyperthreads), so networks never share a physical core
+ * while there are vacant ones. A network that requested the specific #threads gets a physical core per thread,
+ * vacant ones first. The cores left are split evenly between the rest of networks (they are shared only if
+ * nothing is left). Every time a network is loaded or released the partition is recomputed (and the generation
+ * is bumped), so the streams re-pin their threads and resize their thread pools to the updated cores.
+ * Within a network the physical cores are split evenly between the streams, and the threads of a stream
+ * populate the physical cores first, the hyperthreads go next. */
+class CPUResourceManager {
+public:
+    /* Cores assigned to the specific stream of the network, used for reporting */
+    struct StreamCores {
+        std::string network;
+        int stream;
+        std::vector<int> cores;
+    };
+
+    /* Cores claimed by the network, released when the last owner (network, its graphs) is gone */
+    class Reservation {
+    public:
+        typedef std::shared_ptr<Reservation> Ptr;
+        ~Reservation();
+
+        /* All cores currently assigned to the network */
+        std::vector<int> cores() const;
+        /* Number of cores currently assigned to the stream, that is the max number of its threads */
+        int streamThreads(int stream) const;
+        /* Core to pin the thread of the stream to, -1 if the stream has no core for this thread */
+        int threadCore(int stream, int thread) const;
+        /* Changes every time the cores of (any) network are reassigned */
+        size_t generation() const;
+
+    private:
+        /* Cores of every stream, replaced as a whole on rebalancing, so the threads read it without locking */
+        typedef std::vector<std::vector<int>> Snapshot;
+
+        Reservation(CPUResourceManager& manager, size_t id) : _manager(manager), _id(id) {}
+        std::shared_ptr<const Snapshot> snapshot() const;
+        const std::vector<int>& stream(const Snapshot& snapshot, int stream) const;
+
+        CPUResourceManager& _manager;
+        size_t _id;
+        std::shared_ptr<const Snapshot> _snapshot;
+        friend class CPUResourceManager;
+    };
+
+    /* Manager of the cores from the process affinity mask, it is never destroyed */
+    static CPUResourceManager& instance();
+
+    /* cpus are the logical cores (OS numbering), coreIds are ids of their physical cores (hyperthreads of a core
+     * share the id), empty coreIds means that every logical core is a physical one */
+    explicit CPUResourceManager(const std::vector<int>& cpus, const std::vector<int>& coreIds = {});
+    CPUResourceManager(const CPUResourceManager&) = delete;
+    CPUResourceManager& operator=(const CPUResourceManager&) = delete;
+
+    /* Claims cores for the network with the given #streams, threads == 0 means the fair share of cores */
+    Reservation::Ptr reserve(const std::string& network, int streams, int threads = 0);
+
+    /* Cores available to the process */
+    const std::vector<int>& cpus() const { return _cpus; }
+
+    /* The current core assignment of every stream of every loaded network */
+    std::vector<StreamCores> coreMap() const;
+    std::string coreMapToString() const;
+
+private:
+    struct Claim {
+        size_t id;
+        std::string network;
+        int streams;
+        int threads;
+        Reservation* owner;
+        /* indices of the assigned physical cores */
+        std::vector<size_t> physical;
+        /* logical cores of the assigned physical cores */
+        std::vector<int> cores;
+    };
+
+    void release(size_t id);
+    void rebalance();
+    const Claim& find(size_t id) const;
+    std::vector<int> logicalCores(const std::vector<size_t>& physical) const;
+    std::vector<int> streamCores(const Claim& claim, int stream) const;
+
+    mutable std::mutex _mutex;
+    const std::vector<int> _cpus;
+    /* logical cores grouped by physical cores */
+    std::vector<std::vector<int>> _physical;
+    std::list<Claim> _claims;
+    size_t _nextId = 0;
+    std::atomic<size_t> _generation;
+};
 
 #if IE_THREAD == IE_THREAD_TBB
 /* Simple observer that handles pinning threads to the cores, it serves as a callback for threads entering the arena. */
 class pinning_observer: public tbb::task_scheduler_observer {
     cpu_set_t *mask;
     int ncpus;
-    int stream_id, threads_per_stream;
-    const int pinning_step;
+    CPUResourceManager::Reservation::Ptr cores;
+    int stream_id;
 
 public:
-    pinning_observer(tbb::task_arena& _arena, int _stream_id, int _threads_per_stream, int _pinning_step = 1) :
-            tbb::task_scheduler_observer(_arena),
-            stream_id(_stream_id), threads_per_stream(_threads_per_stream), pinning_step(_pinning_step) {
+    pinning_observer(tbb::task_arena& _arena, const CPUResourceManager::Reservation::Ptr& _cores, int _stream_id) :
+            tbb::task_scheduler_observer(_arena), cores(_cores), stream_id(_stream_id) {
         get_process_mask(ncpus, mask);
     }
 
     void on_scheduler_entry(bool) override {
         if (!mask) return;
-        int thread_idx = tbb::task_arena::current_thread_index();
-        int thr_idx = stream_id * threads_per_stream + thread_idx;
-        // pin thread to the vacant slot
-        pin_thread_to_vacant_core(thr_idx, pinning_step, ncpus, mask);
+        // the cores are looked up on every entry, so the threads follow the rebalancing
+        pin_current_thread_to_core(cores->threadCore(stream_id, tbb::task_arena::current_thread_index()));
     }
 
     void on_scheduler_exit(bool) override {
@@ -111,20 +203,39 @@ protected:
 };
 #endif  // IE_THREAD == IE_THREAD_TBB
 
-/* Class wrapping multiple worker threads that monitors the same queue with Infer Requests. */
+/* Class wrapping multiple worker threads that monitors the same queue with Infer Requests.
+ * Every worker runs its initialization task first and starts taking tasks from the queue as soon as it is done,
+ * so the executor accepts tasks before all workers are initialized. A worker which initialization failed exits. */
 class MultiWorkerTaskExecutor : public ITaskExecutor {
 public:
     typedef std::shared_ptr<MultiWorkerTaskExecutor> Ptr;
 
+    /**
+    * @brief Starts a worker thread per initialization task, doesn't wait for them to complete.
+    */
     explicit MultiWorkerTaskExecutor(const std::vector<Task::Ptr>&, std::string name = "Default");
 
     ~MultiWorkerTaskExecutor();
 
+    /**
+    * @brief Blocks until some worker is ready to execute tasks or initialization of every worker has finished.
+    * @return number of workers ready to execute tasks, 0 means that every initialization task failed
+    */
+    size_t waitFirstReady();
+
+    /**
+    * @brief Blocks until initialization of every worker has finished.
+    * @return number of workers ready to execute tasks
+    * @throws the exception of the first failed initialization task
+    */
+    size_t waitAllInitialized();
+
     /**
     * @brief Adds task for execution and notifies one of the working threads about the new task.
     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
     * @param task - shared pointer to the task
     *  @return true if succeed to add task, otherwise - false
+    * @throws the exception of the first failed initialization task, so a broken stream is not left unnoticed
     */
     bool startTask(Task::Ptr task) override;
 
@@ -137,7 +248,14 @@ private:
     std::queue<Task::Ptr> _taskQueue;
     std::atomic<bool> _isStopped;
     std::string _name;
-    std::atomic<int> _initCount;
+
+    std::mutex _initMutex;
+    std::condition_variable _initCondVar;
+    size_t _initTotal = 0;
+    size_t _initDone = 0;
+    size_t _readyCount = 0;
+    std::exception_ptr _initError;
+    std::atomic<bool> _isInitFailed;
 };
 
 /* Pure Infer Requests - just input and output data. */
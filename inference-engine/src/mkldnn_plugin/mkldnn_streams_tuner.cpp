@@ -0,0 +1,287 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <functional>
+
+#include <details/ie_cnn_network_iterator.hpp>
+#include "mkldnn_streams_tuner.h"
+#include "mkldnn_graph.h"
+#include "mkldnn_plugin.h"
+#include "mkldnn/omp_manager.h"
+
+#define XBYAK_NO_OP_NAMES
+#define XBYAK_UNDEF_JNL
+#include "../../thirdparty/mkl-dnn/src/cpu/xbyak/xbyak_util.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+// every split is benchmarked for this long (after a warm-up inference of every request)
+const std::chrono::milliseconds kMeasureTime(200);
+
+std::mutex cacheMutex;
+std::map<std::string, StreamsTuner::Decision>& processCache() {
+    static std::map<std::string, StreamsTuner::Decision> cache;
+    return cache;
+}
+
+// the same model loaded concurrently is tuned once, the other loads wait for (and reuse) the decision,
+// a mutex lives while some load of the model holds it, so the map keeps only the loads in progress
+std::shared_ptr<std::mutex> tuningMutex(const std::string &key) {
+    static std::map<std::string, std::weak_ptr<std::mutex>> mutexes;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    for (auto it = mutexes.begin(); it != mutexes.end();)
+        it = it->second.expired() ? mutexes.erase(it) : std::next(it);
+    auto mutex = mutexes[key].lock();
+    if (!mutex) {
+        mutex = std::make_shared<std::mutex>();
+        mutexes[key] = mutex;
+    }
+    return mutex;
+}
+
+void fillSynthetic(const Blob::Ptr &blob) {
+    if (blob->precision() == Precision::FP32) {
+        auto data = blob->buffer().as<float *>();
+        for (size_t i = 0; i < blob->size(); i++)
+            data[i] = static_cast<float>(i % 255) / 255.f;
+    } else {
+        auto data = blob->buffer().as<uint8_t *>();
+        for (size_t i = 0; i < blob->byteSize(); i++)
+            data[i] = static_cast<uint8_t>(i % 127);
+    }
+}
+}  // namespace
+
+std::string StreamsTuner::modelHash(const ICNNNetwork &network) {
+    const auto &crc = MKLDNNWeightsSharing::GetHashFunc();
+    std::stringstream topology;
+    details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
+    for (; i != details::CNNNetworkIterator(); i++) {
+        const CNNLayerPtr &layer = *i;
+        topology << layer->name << ":" << layer->type << ":" << layer->precision.name() << "{";
+        for (const auto &param : layer->params)
+            topology << param.first << "=" << param.second << ";";
+        for (const auto &data : layer->outData) {
+            topology << data->getPrecision().name();
+            for (auto dim : data->getTensorDesc().getDims())
+                topology << "," << dim;
+            topology << ";";
+        }
+        for (const auto &blob : layer->blobs) {
+            // the whole blob is hashed: models differing only in weights values may differ in the best split
+            // (e.g. the sparsity), and the cached decision must not leak between them
+            topology << blob.first << "=" << blob.second->byteSize();
+            auto data = blob.second->cbuffer().as<const unsigned char *>();
+            if (data)
+                topology << ":" << std::hex << crc.hash(data, blob.second->byteSize()) << std::dec;
+            topology << ";";
+        }
+        topology << "}";
+    }
+
+    const std::string str = topology.str();
+    std::stringstream hash;
+    hash << std::hex << crc.hash(reinterpret_cast<const unsigned char *>(str.data()), str.size());
+    return hash.str();
+}
+
+std::string StreamsTuner::cpuSignature() {
+    // the same core counts on another CPU model or ISA (e.g. a cache file moved to another machine) need new tuning
+    static Xbyak::util::Cpu cpu;
+    const char *isa = cpu.has(Xbyak::util::Cpu::tAVX512F) ? "avx512" :
+                      cpu.has(Xbyak::util::Cpu::tAVX2) ? "avx2" :
+                      cpu.has(Xbyak::util::Cpu::tSSE42) ? "sse42" : "x86";
+    std::stringstream signature;
+    signature << "family" << cpu.displayFamily << "_model" << cpu.displayModel << "_" << isa
+              << "_cpus" << std::thread::hardware_concurrency()
+              << "_cores" << cpu::getNumberOfCPUCores()
+              << "_sockets" << cpu::getNumberOfCPUSockets()
+              << "_threads" << parallel_get_max_threads();
+    return signature.str();
+}
+
+std::vector<std::pair<int, int>> StreamsTuner::candidates(int threads) {
+    threads = std::max(1, threads);
+    std::vector<std::pair<int, int>> splits;
+    for (int streams = 1; streams < threads; streams *= 2)
+        splits.push_back({streams, threads});
+    // a single-threaded stream per core
+    splits.push_back({threads, threads});
+    return splits;
+}
+
+StreamsTuner::Decision StreamsTuner::select(const std::vector<Decision> &measured, double latencyCap) {
+    if (measured.empty())
+        THROW_IE_EXCEPTION << "No stream/thread splits were measured";
+    const Decision *best = nullptr;
+    for (const auto &d : measured) {
+        if (latencyCap > 0 && d.latency > latencyCap)
+            continue;
+        if (!best || d.fps > best->fps)
+            best = &d;
+    }
+    if (!best) {  // nothing fits the cap, so the lowest latency is the best we can do
+        best = &*std::min_element(measured.begin(), measured.end(),
+                                  [](const Decision &l, const Decision &r) { return l.latency < r.latency; });
+    }
+    return *best;
+}
+
+bool StreamsTuner::loadCached(const std::string &file, const std::string &key, Decision &decision) {
+    std::ifstream in(file);
+    std::string line;
+    bool found = false;
+    // the latest record wins
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::stringstream record(line);
+        std::string recordKey;
+        Decision d;
+        if (record >> recordKey >> d.streams >> d.threads >> d.fps >> d.latency && recordKey == key) {
+            decision = d;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void StreamsTuner::saveCached(const std::string &file, const std::string &key, const Decision &decision,
+                              const std::vector<Decision> &measured) {
+    std::ofstream out(file, std::ios::app);
+    if (!out)
+        return;  // the cache is an optimization, so the tuning result is still used
+    for (const auto &d : measured) {
+        out << "# " << key << " streams=" << d.streams << " threads=" << d.threads
+            << " fps=" << d.fps << " latency=" << d.latency << "ms" << std::endl;
+    }
+    out << key << " " << decision.streams << " " << decision.threads << " "
+        << decision.fps << " " << decision.latency << std::endl;
+}
+
+StreamsTuner::Decision StreamsTuner::measure(ICNNNetwork &network, const Config &cfg, int streams, int threads) {
+    Config candidateCfg = cfg;
+    candidateCfg.tuneStreams = false;
+    candidateCfg.throughputStreams = streams;
+    candidateCfg.threadsNum = threads;
+    // the network is loaded (and its cores are claimed) only for the time of the measurement
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(network, candidateCfg, extensionManager);
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+    execNetwork->setNetworkInputs(inputs);
+    execNetwork->setNetworkOutputs(outputs);
+
+    std::vector<IInferRequest::Ptr> requests(streams);
+    for (auto &request : requests) {
+        execNetwork->CreateInferRequest(request);
+        for (const auto &input : inputs) {
+            Blob::Ptr blob;
+            ResponseDesc resp;
+            if (request->GetBlob(input.first.c_str(), blob, &resp) != OK)
+                THROW_IE_EXCEPTION << resp.msg;
+            fillSynthetic(blob);
+        }
+    }
+
+    // the graphs of all streams are in place (and warmed up) before the measurement
+    execNetwork->waitAllGraphs();
+    std::vector<std::string> errors(streams);
+    auto runWorkers = [&](std::function<void(int, ResponseDesc &)> work) {
+        std::vector<std::thread> workers;
+        for (int r = 0; r < streams; r++) {
+            workers.emplace_back([&, r] {
+                ResponseDesc resp;
+                try {
+                    work(r, resp);
+                } catch (const std::exception &e) {
+                    errors[r] = e.what();
+                }
+            });
+        }
+        for (auto &worker : workers)
+            worker.join();
+        for (const auto &error : errors) {
+            if (!error.empty())
+                THROW_IE_EXCEPTION << error;
+        }
+    };
+    auto infer = [&](int r, ResponseDesc &resp) {
+        if (requests[r]->Infer(&resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+    };
+
+    runWorkers(infer);
+
+    std::atomic<size_t> count(0);
+    std::atomic<int64_t> totalLatency(0);
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + kMeasureTime;
+    runWorkers([&](int r, ResponseDesc &resp) {
+        while (std::chrono::steady_clock::now() < deadline) {
+            const auto t0 = std::chrono::steady_clock::now();
+            infer(r, resp);
+            totalLatency += std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - t0).count();
+            count++;
+        }
+    });
+
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    Decision decision;
+    decision.streams = streams;
+    decision.threads = threads;
+    decision.fps = count * network.getBatchSize() / elapsed;
+    decision.latency = count ? totalLatency / 1000.0 / count : std::numeric_limits<double>::max();
+    return decision;
+}
+
+StreamsTuner::Decision StreamsTuner::tune(ICNNNetwork &network, const Config &cfg) {
+    // the decision is valid for the same thread budget only, the splits are made of it
+    const int threads = cfg.threadsNum ? cfg.threadsNum : parallel_get_max_threads();
+    const std::string key = modelHash(network) + "@" + cpuSignature() +
+                            "_budget" + std::to_string(threads) + "_cap" + std::to_string(cfg.tuneLatencyCap);
+    auto keyMutex = tuningMutex(key);
+    std::lock_guard<std::mutex> tuningLock(*keyMutex);
+    Decision decision;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto found = processCache().find(key);
+        if (found != processCache().end()) {
+            decision = found->second;
+            decision.cached = true;
+            return decision;
+        }
+    }
+    if (!cfg.tuneCacheFile.empty() && loadCached(cfg.tuneCacheFile, key, decision)) {
+        decision.cached = true;
+    } else {
+        std::vector<Decision> measured;
+        for (const auto &split : candidates(threads))
+            measured.push_back(measure(network, cfg, split.first, split.second));
+        decision = select(measured, cfg.tuneLatencyCap);
+        if (!cfg.tuneCacheFile.empty())
+            saveCached(cfg.tuneCacheFile, key, decision, measured);
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    processCache()[key] = decision;
+    return decision;
+}
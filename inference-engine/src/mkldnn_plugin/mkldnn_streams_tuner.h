@@ -0,0 +1,54 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <ie_icnn_network.hpp>
+#include "config.h"
+#include "mkldnn_extension_mngr.h"
+
+namespace MKLDNNPlugin {
+
+/* Picks #streams and #threads for the network (KEY_CPU_THROUGHPUT_STREAMS = CPU_THROUGHPUT_TUNE).
+ * A few stream/thread splits are loaded one by one and benchmarked on synthetic inputs for a short time,
+ * the split with the best throughput that fits the (optional) latency cap wins.
+ * Decisions are cached per model hash, CPU and thread budget in the process and, if requested, in the file,
+ * which also keeps the measurements of every split as a report. Loads of the same model are tuned once. */
+class StreamsTuner {
+public:
+    struct Decision {
+        int streams = 1;
+        int threads = 0;
+        double fps = 0.0;
+        double latency = 0.0;  // mean latency of a request, ms
+        bool cached = false;
+    };
+
+    explicit StreamsTuner(const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {}
+
+    Decision tune(InferenceEngine::ICNNNetwork &network, const Config &cfg);
+
+    /* Hash of the topology, layer parameters and weights (sizes and contents) */
+    static std::string modelHash(const InferenceEngine::ICNNNetwork &network);
+    static std::string cpuSignature();
+
+    /* Splits {streams, threads} to try for the given total #threads */
+    static std::vector<std::pair<int, int>> candidates(int threads);
+    /* Best throughput under the latency cap (0 means no cap), the lowest latency if no split fits the cap */
+    static Decision select(const std::vector<Decision> &measured, double latencyCap);
+
+    static bool loadCached(const std::string &file, const std::string &key, Decision &decision);
+    static void saveCached(const std::string &file, const std::string &key, const Decision &decision,
+                           const std::vector<Decision> &measured);
+
+private:
+    Decision measure(InferenceEngine::ICNNNetwork &network, const Config &cfg, int streams, int threads);
+
+    MKLDNNExtensionManager::Ptr extensionManager;
+};
+
+}  // namespace MKLDNNPlugin
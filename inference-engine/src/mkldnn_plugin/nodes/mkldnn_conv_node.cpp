@@ -12,9 +12,12 @@
 #include <ie_layers.h>
 #include <string>
 #include <vector>
+#include <map>
+#include <cstring>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_layers_internal.hpp>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -421,13 +424,19 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
 
 
 void MKLDNNConvolutionNode::createPrimitive() {
-    if (prim)
+    if (prim || sparseWeights)
         return;
 
-    mkldnn::primitive_attr attr;
     setPostOps(attr, true);
     addScaleToPrimitiveAttr(attr);
 
+    // the sparse kernel replaces the whole node, so neither the dense primitive nor its reordered weights are created
+    if (depthFirstChain.empty() && !depthFirstHead) {
+        createSparseWeights();
+        if (sparseWeights)
+            return;
+    }
+
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
@@ -443,6 +452,344 @@ void MKLDNNConvolutionNode::createPrimitive() {
                                            internalBlobMemory[0]->GetPrimitive(),
                                            getChildEdgeAt(0)->getMemory().GetPrimitive()));
     }
+
+    if (!depthFirstChain.empty() && !initDepthFirstBands()) {
+        // the convolutions of the chain are executed one by one
+        for (auto *node : depthFirstChain)
+            node->depthFirstHead = nullptr;
+        depthFirstChain.clear();
+    }
+}
+
+void MKLDNNConvolutionNode::execute(mkldnn::stream strm) {
+    // executed by the head of the depth-first chain
+    if (depthFirstHead)
+        return;
+
+    if (!depthFirstChain.empty()) {
+        executeDepthFirst(strm);
+        return;
+    }
+    if (sparseWeights) {
+        executeSparse();
+        return;
+    }
+    MKLDNNNode::execute(strm);
+}
+
+void MKLDNNConvolutionNode::createSparseWeights() {
+    if (sparseWeightsThreshold == 0.f || isGrouped || isMerged || internalBlobs.empty() ||
+        internalBlobs[0]->precision() != Precision::FP32)
+        return;
+
+    // a 1x1 convolution is a product of the weights and the channels of every pixel
+    for (size_t i = 2; i < weightDims.size(); i++) {
+        if (weightDims[i] != 1 || stride[i - 2] != 1 || paddingL[i - 2] != 0 || paddingR[i - 2] != 0)
+            return;
+    }
+
+    // the sum of the output and the ReLU after it are done by the kernel
+    const auto ops = attr.get_post_ops();
+    bool withSumOp = false, withRelu = false;
+    float reluAlpha = 0.f;
+    for (int i = 0; i < ops.len(); i++) {
+        if (ops.kind(i) == primitive::kind::sum && i == 0) {
+            float scale;
+            ops.get_params_sum(i, scale);
+            if (scale != 1.f)
+                return;
+            withSumOp = true;
+        } else if (ops.kind(i) == primitive::kind::eltwise && i == ops.len() - 1) {
+            float scale, beta;
+            algorithm alg;
+            ops.get_params_eltwise(i, scale, alg, reluAlpha, beta);
+            if (alg != eltwise_relu || scale != 1.f)
+                return;
+            withRelu = true;
+        } else {
+            return;
+        }
+    }
+
+    MKLDNNSparseWeights::Layout in, out;
+    const auto &src = getParentEdgeAt(0)->getMemory();
+    const auto &dst = getChildEdgeAt(0)->getMemory();
+    if (src.GetDims().size() != 4 || !MKLDNNSparseWeights::getLayout(src, in) ||
+        !MKLDNNSparseWeights::getLayout(dst, out))
+        return;
+
+    int oc = static_cast<int>(weightDims[0]);
+    int ic = static_cast<int>(weightDims[1]);
+    int columns = src.GetDims()[2] * src.GetDims()[3];
+    const float *bias = withBiases ? internalBlobs[1]->buffer().as<const float *>() : nullptr;
+    sparseWeights = MKLDNNSparseWeights::create(oc, ic, internalBlobs[0]->buffer().as<const float *>(), ic, bias,
+                                                in, out, withSumOp, withRelu, reluAlpha, columns,
+                                                sparseWeightsThreshold);
+    if (sparseWeights)
+        getSelectedPrimitiveDescriptor()->setImplementationType(MKLDNNSparseWeights::getImplementationType());
+}
+
+void MKLDNNConvolutionNode::executeSparse() {
+    const auto &src = getParentEdgeAt(0)->getMemory();
+    const auto &dst = getChildEdgeAt(0)->getMemory();
+    auto srcDesc = src.GetDescriptor();
+    auto dstDesc = dst.GetDescriptor();
+    const size_t srcStride = srcDesc.data.layout_desc.blocking.strides[0][0];
+    const size_t dstStride = dstDesc.data.layout_desc.blocking.strides[0][0];
+    const int columns = srcDesc.data.dims[2] * srcDesc.data.dims[3];
+
+    const auto *srcData = static_cast<const float *>(src.GetData());
+    auto *dstData = static_cast<float *>(dst.GetData());
+    for (int n = 0; n < batchToProcess(); n++)
+        sparseWeights->execute(columns, srcData + n * srcStride, dstData + n * dstStride);
+}
+
+void MKLDNNConvolutionNode::setDepthFirstChain(const std::vector<MKLDNNNodePtr>& chain, int bandRows) {
+    depthFirstChain.clear();
+    for (auto &node : chain) {
+        auto *convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+        if (convNode == nullptr)
+            THROW_IE_EXCEPTION << "Depth-first chain of " << getName() << " contains not a convolution " << node->getName();
+        if (convNode != this)
+            convNode->depthFirstHead = this;
+        depthFirstChain.push_back(convNode);
+    }
+    depthFirstBandRows = bandRows;
+}
+
+namespace {
+// the rows of a sample are contiguous, the channel blocks either follow each other (nchw, nChw8c, nChw16c)
+// or the channels are inside of the rows (nhwc)
+bool isBandLayout(const MKLDNNMemory &mem) {
+    const auto format = mem.GetFormat();
+    if (format != memory::nchw && format != memory::nhwc && format != memory::nChw8c && format != memory::nChw16c)
+        return false;
+
+    const auto desc = mem.GetDescriptor().data;
+    const auto &blk = desc.layout_desc.blocking;
+    const ptrdiff_t *strides = blk.strides[0];
+    if (strides[2] != desc.dims[3] * strides[3])
+        return false;
+    return strides[1] == desc.dims[2] * strides[2] || (strides[1] == 1 && strides[3] == blk.padding_dims[1]);
+}
+
+bool isChannelsInRows(const MKLDNNMemory &mem) {
+    const auto desc = mem.GetDescriptor().data;
+    return desc.layout_desc.blocking.strides[0][1] < desc.layout_desc.blocking.strides[0][2];
+}
+
+memory::desc bandDesc(const MKLDNNMemory &mem, int rows) {
+    auto dims = mem.GetDims();
+    dims[0] = 1;
+    dims[2] = rows;
+    return memory::desc(dims, mem.GetDataType(), mem.GetFormat());
+}
+
+char *rowsPtr(const MKLDNNMemory &mem, int n, int row) {
+    const auto desc = mem.GetDescriptor().data;
+    const auto &blk = desc.layout_desc.blocking;
+    return static_cast<char *>(mem.GetData()) + (blk.offset_padding + n * blk.strides[0][0] + row * blk.strides[0][2]) *
+                                                MKLDNNExtensionUtils::sizeOfDataType(mem.GetDataType());
+}
+
+// copies the rows [begin, end) of the sample n between a tensor and a dense band of the same layout
+void copyRows(const MKLDNNMemory &mem, int n, int begin, int end, void *band, bool toBand) {
+    const auto desc = mem.GetDescriptor().data;
+    const auto &blk = desc.layout_desc.blocking;
+    const size_t elemSize = MKLDNNExtensionUtils::sizeOfDataType(mem.GetDataType());
+    const int blocks = isChannelsInRows(mem) ? 1 : blk.padding_dims[1] / blk.block_dims[1];
+    const size_t size = (end - begin) * blk.strides[0][2] * elemSize;
+    char *rows = rowsPtr(mem, n, begin);
+    parallel_for(blocks, [&](int b) {
+        char *tensorRows = rows + b * blk.strides[0][1] * elemSize;
+        char *bandRows = static_cast<char *>(band) + b * size;
+        if (toBand)
+            memcpy(bandRows, tensorRows, size);
+        else
+            memcpy(tensorRows, bandRows, size);
+    });
+}
+}  // namespace
+
+bool MKLDNNConvolutionNode::initDepthFirstBands() {
+    auto *tail = depthFirstChain.back();
+    for (size_t i = 1; i < depthFirstChain.size(); i++) {
+        // reorders between the convolutions
+        if (depthFirstChain[i]->getParentEdgeAt(0)->getParent().get() != depthFirstChain[i - 1])
+            return false;
+        depthFirstChain[i]->createPrimitive();
+    }
+    // the sum is read band by band, so it has to be ready before the chain
+    if (tail->withSum && tail->getParentEdgeAt(1)->getParent() != getParentEdgeAt(0)->getParent())
+        return false;
+
+    std::vector<const MKLDNNMemory *> mems;
+    for (auto *node : depthFirstChain)
+        mems.push_back(&node->getParentEdgeAt(0)->getMemory());
+    mems.push_back(&tail->getChildEdgeAt(0)->getMemory());
+    for (auto *mem : mems) {
+        if (!isBandLayout(*mem))
+            return false;
+    }
+
+    // split the output into bands and go up the chain to find the input rows of every convolution
+    const size_t stages = depthFirstChain.size();
+    const int outRows = mems.back()->GetDims()[2];
+    std::map<std::vector<int>, size_t> variants;
+    depthFirstBands.clear();
+    depthFirstVariants.clear();
+    for (int outBegin = 0; outBegin < outRows; outBegin += depthFirstBandRows) {
+        std::vector<int> begin(stages + 1), end(stages + 1), padT(stages), padB(stages);
+        begin[stages] = outBegin;
+        end[stages] = std::min(outRows, outBegin + depthFirstBandRows);
+        for (int i = static_cast<int>(stages) - 1; i >= 0; i--) {
+            auto *node = depthFirstChain[i];
+            const int inRows = mems[i]->GetDims()[2];
+            const int kernel = (node->weightDims[node->weightDims.size() - 2] - 1) * (node->dilation[0] + 1) + 1;
+            const int first = begin[i + 1] * node->stride[0] - node->paddingL[0];
+            const int last = (end[i + 1] - 1) * node->stride[0] - node->paddingL[0] + kernel;
+            padT[i] = std::max(0, -first);
+            padB[i] = std::max(0, last - inRows);
+            begin[i] = std::max(0, first);
+            end[i] = std::min(inRows, last);
+        }
+
+        std::vector<int> key;
+        for (size_t i = 0; i < stages; i++) {
+            key.push_back(end[i] - begin[i]);
+            key.push_back(padT[i]);
+            key.push_back(padB[i]);
+        }
+        key.push_back(end[stages] - begin[stages]);
+
+        auto variant = variants.find(key);
+        if (variant == variants.end()) {
+            DepthFirstVariant bands;
+            for (size_t i = 0; i <= stages; i++)
+                bands.memories.emplace_back(new memory({bandDesc(*mems[i], end[i] - begin[i]), getEngine()}));
+            for (size_t i = 0; i < stages; i++) {
+                auto *node = depthFirstChain[i];
+                auto pd = node->createBandPrimitiveDescriptor(bands.memories[i]->get_primitive_desc().desc(),
+                                                              bands.memories[i + 1]->get_primitive_desc().desc(),
+                                                              padT[i], padB[i]);
+                if (!pd)
+                    return false;
+                if (node->internalBlobMemory.size() > 1) {
+                    bands.stages.push_back(convolution_forward(*pd, *bands.memories[i],
+                                                               node->internalBlobMemory[0]->GetPrimitive(),
+                                                               node->internalBlobMemory[1]->GetPrimitive(),
+                                                               *bands.memories[i + 1]));
+                } else {
+                    bands.stages.push_back(convolution_forward(*pd, *bands.memories[i],
+                                                               node->internalBlobMemory[0]->GetPrimitive(),
+                                                               *bands.memories[i + 1]));
+                }
+            }
+            variant = variants.insert({key, depthFirstVariants.size()}).first;
+            depthFirstVariants.push_back(bands);
+        }
+        depthFirstBands.push_back({begin[0], end[0], begin[stages], end[stages], variant->second});
+    }
+
+    depthFirstOutput.clear();
+    depthFirstInView = !tail->withSum && isChannelsInRows(*mems.front());
+    depthFirstOutView = !tail->withSum && isChannelsInRows(*mems.back());
+    if (tail->withSum) {
+        // the output of a band is written after the input of the next band is read, it may be the same
+        // memory then, so it must not overlap the input of the band after next
+        for (size_t b = 0; b + 2 < depthFirstBands.size(); b++) {
+            if (depthFirstBands[b].outEnd > depthFirstBands[b + 2].inBegin)
+                return false;
+        }
+        for (int i = 0; i < 2; i++) {
+            MKLDNNMemoryPtr output(new MKLDNNMemory(getEngine()));
+            output->Create(bandDesc(*mems.back(), depthFirstBandRows));
+            depthFirstOutput.push_back(output);
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<convolution_forward::primitive_desc> MKLDNNConvolutionNode::createBandPrimitiveDescriptor(
+        const memory::desc& in, const memory::desc& out, int padT, int padB) {
+    std::vector<int> padL = paddingL, padR = paddingR;
+    padL[0] = padT;
+    padR[0] = padB;
+    const impl_desc_type implType = getSelectedPrimitiveDescriptor()->getImplementationType();
+
+    for (auto alg : {algorithm::convolution_direct, algorithm::convolution_winograd}) {
+        try {
+            std::shared_ptr<convolution_forward::desc> convDesc;
+            if (internalBlobMemory.size() > 1) {
+                convDesc.reset(new convolution_forward::desc(prop_kind::forward_scoring, alg, in,
+                                                             internalBlobMemory[0]->GetDescriptor(),
+                                                             internalBlobMemory[1]->GetDescriptor(), out,
+                                                             stride, dilation, padL, padR, padding_kind::zero));
+            } else {
+                convDesc.reset(new convolution_forward::desc(prop_kind::forward_scoring, alg, in,
+                                                             internalBlobMemory[0]->GetDescriptor(), out,
+                                                             stride, dilation, padL, padR, padding_kind::zero));
+            }
+
+            // the band has to run the same kernel with the same weights
+            primitive_desc_iterator itpd(*convDesc, attr, getEngine());
+            do {
+                if (parse_impl_name(itpd.get_impl_info_str()) == implType) {
+                    std::shared_ptr<convolution_forward::primitive_desc> pd(
+                            new convolution_forward::primitive_desc(*convDesc, attr, getEngine()));
+                    itpd.getPrimitiveDescriptor(*pd);
+                    return pd;
+                }
+            } while (itpd.next());
+        } catch (std::exception& e) {
+            // no implementation for the band
+            continue;
+        }
+    }
+    return nullptr;
+}
+
+void MKLDNNConvolutionNode::executeDepthFirst(mkldnn::stream strm) {
+    const auto &src = getParentEdgeAt(0)->getMemory();
+    const auto &dst = depthFirstChain.back()->getChildEdgeAt(0)->getMemory();
+    const bool withOutputSum = !depthFirstOutput.empty();
+
+    for (int n = 0; n < batchToProcess(); n++) {
+        const DepthFirstBand *pending = nullptr;
+        void *pendingData = nullptr;
+        for (size_t b = 0; b < depthFirstBands.size(); b++) {
+            const auto &band = depthFirstBands[b];
+            auto &variant = depthFirstVariants[band.variant];
+            auto &in = *variant.memories.front();
+            auto &out = *variant.memories.back();
+
+            if (depthFirstInView)
+                in.set_data_handle(rowsPtr(src, n, band.inBegin));
+            else
+                copyRows(src, n, band.inBegin, band.inEnd, in.get_data_handle(), true);
+
+            if (pending)
+                copyRows(dst, n, pending->outBegin, pending->outEnd, pendingData, false);
+
+            if (withOutputSum) {
+                out.set_data_handle(depthFirstOutput[b % 2]->GetData());
+                copyRows(dst, n, band.outBegin, band.outEnd, out.get_data_handle(), true);
+            } else if (depthFirstOutView) {
+                out.set_data_handle(rowsPtr(dst, n, band.outBegin));
+            }
+
+            strm.submit(variant.stages);
+
+            if (withOutputSum) {
+                pending = &band;
+                pendingData = out.get_data_handle();
+            } else if (!depthFirstOutView) {
+                copyRows(dst, n, band.outBegin, band.outEnd, out.get_data_handle(), false);
+            }
+        }
+        if (pending)
+            copyRows(dst, n, pending->outBegin, pending->outEnd, pendingData, false);
+    }
 }
 
 bool MKLDNNConvolutionNode::created() const {
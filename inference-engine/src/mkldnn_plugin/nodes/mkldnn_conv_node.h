@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_sparse_weights.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,11 +28,36 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    void execute(mkldnn::stream strm) override;
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
+    /**
+     * Makes the node execute the chain of convolutions (starting with the node) depth-first: the output
+     * is produced in bands of bandRows rows, every band passes all convolutions of the chain while its
+     * intermediate rows are in the cache. The input rows shared by the neighbouring bands are recomputed.
+     * The other convolutions of the chain are not executed on their own then.
+     */
+    void setDepthFirstChain(const std::vector<MKLDNNNodePtr>& chain, int bandRows);
+    MKLDNNNode* getDepthFirstHead() const {
+        return depthFirstHead;
+    }
+
+    /** Sets the density of the weight blocks below which the sparse kernel is used: negative - estimated, 0 - never */
+    void setSparseWeightsThreshold(float threshold) {
+        sparseWeightsThreshold = threshold;
+    }
+
 protected:
     void addScaleToPrimitiveAttr(mkldnn::primitive_attr attr) const;
 
+    bool initDepthFirstBands();
+    void executeDepthFirst(mkldnn::stream strm);
+    std::shared_ptr<mkldnn::convolution_forward::primitive_desc> createBandPrimitiveDescriptor(
+            const mkldnn::memory::desc& in, const mkldnn::memory::desc& out, int padT, int padB);
+
+    void createSparseWeights();
+    void executeSparse();
+
 private:
     static Register<MKLDNNConvolutionNode> reg;
     bool withBiases;
@@ -56,6 +82,30 @@ private:
 
     InferenceEngine::ConvolutionLayer* convLayer;
     InferenceEngine::Blob::Ptr wScale, oScale;
+    mkldnn::primitive_attr attr;
+
+    struct DepthFirstBand {
+        int inBegin, inEnd;    // rows of the chain input
+        int outBegin, outEnd;  // rows of the chain output
+        size_t variant;
+    };
+    // primitives of the bands of the same shape, memories[i] is the band input of the i-th convolution
+    struct DepthFirstVariant {
+        std::vector<mkldnn::primitive> stages;
+        std::vector<std::shared_ptr<mkldnn::memory>> memories;
+    };
+    std::vector<MKLDNNConvolutionNode*> depthFirstChain;
+    MKLDNNConvolutionNode* depthFirstHead = nullptr;
+    int depthFirstBandRows = 0;
+    std::vector<DepthFirstBand> depthFirstBands;
+    std::vector<DepthFirstVariant> depthFirstVariants;
+    // the output of a band is kept until the input of the next band is read, the sum may be done in-place
+    std::vector<MKLDNNMemoryPtr> depthFirstOutput;
+    bool depthFirstInView = false;
+    bool depthFirstOutView = false;
+
+    float sparseWeightsThreshold = 0.f;
+    std::shared_ptr<MKLDNNSparseWeights> sparseWeights;
 };
 
 }  // namespace MKLDNNPlugin
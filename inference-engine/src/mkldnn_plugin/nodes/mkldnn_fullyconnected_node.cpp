@@ -84,7 +84,7 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
 }
 
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || sparseWeights)
         return;
 
     auto prim_desc = createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>();
@@ -101,6 +101,54 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
                                              internalBlobMemory[0]->GetPrimitive(),
                                              getChildEdgeAt(0)->getMemory().GetPrimitive()));
     }
+
+    createSparseWeights();
+}
+
+void MKLDNNFullyConnectedNode::createSparseWeights() {
+    if (sparseWeightsThreshold == 0.f)
+        return;
+
+    // the weights are in the order of the input, every output channel is a row of the weights matrix
+    auto srcDesc = getParentEdgeAt(0)->getMemory().GetDescriptor();
+    auto dstDesc = getChildEdgeAt(0)->getMemory().GetDescriptor();
+    auto wDesc = internalBlobMemory[0]->GetDescriptor();
+    const auto &srcBlk = srcDesc.data.layout_desc.blocking;
+    const auto &dstBlk = dstDesc.data.layout_desc.blocking;
+    const auto &wBlk = wDesc.data.layout_desc.blocking;
+    if (srcDesc.data.data_type != memory::f32 || dstDesc.data.data_type != memory::f32 ||
+        wDesc.data.data_type != memory::f32 || dstDesc.data.format != memory::nc ||
+        srcBlk.offset_padding != 0 || dstBlk.offset_padding != 0 || wBlk.offset_padding != 0)
+        return;
+
+    int oc = dstDesc.data.dims[1];
+    int ic = static_cast<int>(wBlk.strides[0][0]);
+    if (srcBlk.strides[0][0] != wBlk.strides[0][0] || wDesc.data.dims[0] != oc)
+        return;
+
+    MKLDNNSparseWeights::Layout in = {ic, 0, static_cast<size_t>(srcBlk.strides[0][0])};
+    MKLDNNSparseWeights::Layout out = {oc, 0, static_cast<size_t>(dstBlk.strides[0][0])};
+    const float *bias = internalBlobMemory.size() > 1 ? static_cast<const float *>(internalBlobMemory[1]->GetData())
+                                                      : nullptr;
+    sparseWeights = MKLDNNSparseWeights::create(oc, ic, static_cast<const float *>(internalBlobMemory[0]->GetData()),
+                                                ic, bias, in, out, false, false, 0.f, srcDesc.data.dims[0],
+                                                sparseWeightsThreshold);
+    if (!sparseWeights)
+        return;
+    getSelectedPrimitiveDescriptor()->setImplementationType(MKLDNNSparseWeights::getImplementationType());
+    // the compressed weights are taken from the ones reordered for the dense primitive (they follow the layout of
+    // the input), both are not needed anymore
+    prim.reset(nullptr);
+    internalBlobMemory.clear();
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (!sparseWeights) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+    sparseWeights->execute(batchToProcess(), static_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData()),
+                           static_cast<float *>(getChildEdgeAt(0)->getMemory().GetData()));
 }
 
 bool MKLDNNFullyConnectedNode::created() const {
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_sparse_weights.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,6 +20,7 @@ public:
 
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -28,11 +30,20 @@ public:
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
 
+    /** Sets the density of the weight blocks below which the sparse kernel is used: negative - estimated, 0 - never */
+    void setSparseWeightsThreshold(float threshold) {
+        sparseWeightsThreshold = threshold;
+    }
+
 private:
     static Register<MKLDNNFullyConnectedNode> reg;
     InferenceEngine::SizeVector weightsDims;
     InferenceEngine::SizeVector biasesDims;
     mkldnn::memory::format weightsFormatForSrcFormat(mkldnn::memory::format sourceFormat);
+    void createSparseWeights();
+
+    float sparseWeightsThreshold = 0.f;
+    std::shared_ptr<MKLDNNSparseWeights> sparseWeights;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,300 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_mvn_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_depthwise_node.h"
+#include <ie_layers.h>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// Running count, mean and sum of squared deviations of a set of values
+struct Welford {
+    double n = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    // Chan et al. update for merging the statistics of two sets
+    void merge(double bn, double bmean, double bm2) {
+        if (bn == 0.0)
+            return;
+        double total = n + bn;
+        double delta = bmean - mean;
+        mean += delta * bn / total;
+        m2 += bm2 + delta * delta * n * bn / total;
+        n = total;
+    }
+
+    void merge(const Welford& b) {
+        merge(b.n, b.mean, b.m2);
+    }
+};
+
+// Every task reads this many floats, chunks of them stay in L1 between the two passes of a chunk
+const size_t part_elements = 4096;
+const size_t chunk_elements = 256;
+
+}  // namespace
+
+MKLDNNMVNNode::MKLDNNMVNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
+
+void MKLDNNMVNNode::getSupportedDescriptors() {
+    auto * mvnLayer = dynamic_cast<MVNLayer*>(getCnnLayer().get());
+
+    if (mvnLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert MVN layer.";
+
+    if (getParentEdges().size() != 1)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    across_channels = mvnLayer->across_channels != 0;
+    normalize_variance = mvnLayer->normalize != 0;
+    eps = mvnLayer->GetParamAsFloat("eps");
+}
+
+void MKLDNNMVNNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
+    if (precision != InferenceEngine::Precision::FP32)
+        precision = InferenceEngine::Precision::FP32;
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    precision = getCnnLayer()->outData[0]->getPrecision();
+    if (precision != InferenceEngine::Precision::FP32)
+        precision = InferenceEngine::Precision::FP32;
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+
+    auto pushDesc = [&](memory::format format) {
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, format);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, format);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+    };
+
+    // Channel tails of the blocked layouts are handled, so any number of channels is accepted
+    auto& dims = getParentEdgeAt(0)->getDims();
+    pushDesc(MKLDNNMemory::GetPlainFormat(dims));
+    if (dims.ndims() == 4) {
+        pushDesc(memory::nChw8c);
+        pushDesc(memory::nChw16c);
+    } else if (dims.ndims() == 5) {
+        pushDesc(memory::nCdhw8c);
+        pushDesc(memory::nCdhw16c);
+    }
+}
+
+void MKLDNNMVNNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+
+    // Fold the fused ScaleShift layers into one scale and shift per channel
+    auto& dims = getParentEdgeAt(0)->getDims();
+    size_t C = dims.ndims() > 1 ? static_cast<size_t>(dims[1]) : 1lu;
+    fusedScales.clear();
+    fusedShifts.clear();
+    activationAlgorithm = algorithm::algorithm_undef;
+    for (auto &node : fusedWith) {
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            auto* depthwiseLayer = dynamic_cast<WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+            if (depthwiseLayer == nullptr || !depthwiseLayer->_weights)
+                THROW_IE_EXCEPTION << "Cannot get weights of " << node->getName() << " fused into " << getName();
+            if (fusedScales.empty()) {
+                fusedScales.resize(C, 1.0f);
+                fusedShifts.resize(C, 0.0f);
+            }
+            const float* weights = depthwiseLayer->_weights->buffer().as<const float*>();
+            const float* biases = depthwiseLayer->_biases ? depthwiseLayer->_biases->buffer().as<const float*>() : nullptr;
+            bool broadcast = depthwiseLayer->_weights->size() == 1;
+            for (size_t c = 0; c < C; c++) {
+                float scale = weights[broadcast ? 0 : c];
+                float shift = biases ? biases[broadcast ? 0 : c] : 0.0f;
+                fusedScales[c] *= scale;
+                fusedShifts[c] = fusedShifts[c] * scale + shift;
+            }
+            continue;
+        }
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            activationAlgorithm = activationNode->getAlgorithm();
+            activationAlpha = activationNode->getAlpha();
+            activationBeta = activationNode->getBeta();
+        }
+    }
+}
+
+template <size_t blk_size>
+void MKLDNNMVNNode::mvn(const float* src_data, float* dst_data, size_t N, size_t C, size_t S) {
+    const size_t CB = (C + blk_size - 1) / blk_size;
+    const size_t part_size = std::max<size_t>(1lu, part_elements / blk_size);
+    const size_t chunk_size = std::max<size_t>(1lu, chunk_elements / blk_size);
+    const size_t parts = (S + part_size - 1) / part_size;
+
+    // Statistics of every part of the spatial dims of every channel
+    std::vector<Welford> partStats(N * CB * parts * blk_size);
+    parallel_for3d(N, CB, parts, [&](size_t n, size_t cb, size_t p) {
+        const float* src = src_data + (n * CB + cb) * S * blk_size;
+        Welford* stats = &partStats[((n * CB + cb) * parts + p) * blk_size];
+        size_t end = std::min(S, (p + 1) * part_size);
+        for (size_t s0 = p * part_size; s0 < end; s0 += chunk_size) {
+            size_t s1 = std::min(end, s0 + chunk_size);
+            float sum[blk_size] = {};
+            for (size_t s = s0; s < s1; s++) {
+                for (size_t c = 0; c < blk_size; c++)
+                    sum[c] += src[s * blk_size + c];
+            }
+            float mean[blk_size];
+            for (size_t c = 0; c < blk_size; c++)
+                mean[c] = sum[c] / (s1 - s0);
+
+            float m2[blk_size] = {};
+            if (normalize_variance) {
+                for (size_t s = s0; s < s1; s++) {
+                    for (size_t c = 0; c < blk_size; c++) {
+                        float d = src[s * blk_size + c] - mean[c];
+                        m2[c] += d * d;
+                    }
+                }
+            }
+            for (size_t c = 0; c < blk_size; c++)
+                stats[c].merge(static_cast<double>(s1 - s0), mean[c], m2[c]);
+        }
+    });
+
+    // Every channel is reduced to dst = src * scale + shift
+    std::vector<float> scales(N * CB * blk_size, 0.0f);
+    std::vector<float> shifts(N * CB * blk_size, 0.0f);
+    auto setChannel = [&](size_t n, size_t c, const Welford& stats) {
+        float scale = normalize_variance ? static_cast<float>(1.0 / std::sqrt(stats.m2 / stats.n + eps)) : 1.0f;
+        float shift = static_cast<float>(-stats.mean) * scale;
+        if (!fusedScales.empty()) {
+            shift = shift * fusedScales[c] + fusedShifts[c];
+            scale *= fusedScales[c];
+        }
+        scales[n * CB * blk_size + c] = scale;
+        shifts[n * CB * blk_size + c] = shift;
+    };
+    if (across_channels) {
+        for (size_t n = 0; n < N; n++) {
+            Welford stats;
+            for (size_t cb = 0; cb < CB; cb++) {
+                size_t lanes = std::min(blk_size, C - cb * blk_size);
+                for (size_t p = 0; p < parts; p++) {
+                    for (size_t c = 0; c < lanes; c++)
+                        stats.merge(partStats[((n * CB + cb) * parts + p) * blk_size + c]);
+                }
+            }
+            for (size_t c = 0; c < C; c++)
+                setChannel(n, c, stats);
+        }
+    } else {
+        parallel_for2d(N, C, [&](size_t n, size_t c) {
+            size_t cb = c / blk_size;
+            Welford stats;
+            for (size_t p = 0; p < parts; p++)
+                stats.merge(partStats[((n * CB + cb) * parts + p) * blk_size + c % blk_size]);
+            setChannel(n, c, stats);
+        });
+    }
+
+    parallel_for3d(N, CB, parts, [&](size_t n, size_t cb, size_t p) {
+        const float* src = src_data + (n * CB + cb) * S * blk_size;
+        float* dst = dst_data + (n * CB + cb) * S * blk_size;
+        const float* scale = &scales[(n * CB + cb) * blk_size];
+        const float* shift = &shifts[(n * CB + cb) * blk_size];
+        size_t begin = p * part_size * blk_size;
+        size_t end = std::min(S, (p + 1) * part_size) * blk_size;
+        for (size_t i = begin; i < end; i += blk_size) {
+            for (size_t c = 0; c < blk_size; c++)
+                dst[i + c] = src[i + c] * scale[c] + shift[c];
+        }
+
+        // The fused activations keep zero padded channels zero
+        switch (activationAlgorithm) {
+            case algorithm::eltwise_relu:
+                for (size_t i = begin; i < end; i++)
+                    dst[i] = dst[i] > 0.0f ? dst[i] : dst[i] * activationAlpha;
+                break;
+            case algorithm::eltwise_bounded_relu:
+                for (size_t i = begin; i < end; i++)
+                    dst[i] = std::min(std::max(dst[i], 0.0f), activationAlpha);
+                break;
+            case algorithm::eltwise_clamp:
+                for (size_t i = begin; i < end; i++)
+                    dst[i] = std::min(std::max(dst[i], activationAlpha), activationBeta);
+                break;
+            default:
+                break;
+        }
+    });
+}
+
+void MKLDNNMVNNode::execute(mkldnn::stream strm) {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+
+    const float *src_data = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_data = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    memory::dims dims = srcMemory.GetDims();
+    size_t N = static_cast<size_t>(batchToProcess());
+    size_t C = dims.size() > 1 ? static_cast<size_t>(dims[1]) : 1lu;
+    size_t S = 1;
+    for (size_t i = 2; i < dims.size(); i++)
+        S *= static_cast<size_t>(dims[i]);
+
+    int blk_size = 1;
+    if (!MKLDNNMemory::IsPlainFormat(srcMemory.GetFormat())) {
+        blk_size = srcMemory.GetDescriptor().data.layout_desc.blocking.block_dims[1];
+    }
+
+    switch (blk_size) {
+        case 1:
+            mvn<1>(src_data, dst_data, N, C, S);
+            break;
+        case 8:
+            mvn<8>(src_data, dst_data, N, C, S);
+            break;
+        case 16:
+            mvn<16>(src_data, dst_data, N, C, S);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "MVN " << getName() << " does not support the block size " << blk_size;
+    }
+}
+
+bool MKLDNNMVNNode::created() const {
+    return getType() == MVN;
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNMVNNode : public MKLDNNNode {
+public:
+    MKLDNNMVNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNMVNNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    template <size_t blk_size>
+    void mvn(const float* src_data, float* dst_data, size_t N, size_t C, size_t S);
+
+    static Register<MKLDNNMVNNode> reg;
+    bool across_channels = false;
+    bool normalize_variance = true;
+    float eps = 1e-9f;
+
+    // Per-channel scale and shift of the fused Depthwise nodes and the fused activation
+    std::vector<float> fusedScales;
+    std::vector<float> fusedShifts;
+    mkldnn::algorithm activationAlgorithm = mkldnn::algorithm::algorithm_undef;
+    float activationAlpha = 0.0f;
+    float activationBeta = 0.0f;
+};
+
+}  // namespace MKLDNNPlugin
+
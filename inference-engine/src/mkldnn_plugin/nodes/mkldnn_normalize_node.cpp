@@ -0,0 +1,251 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_normalize_node.h"
+#include <ie_layers.h>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "details/caseless.hpp"
+#include "ie_parallel.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+// Spatial positions normalized by one task, their norms stay on the stack
+const size_t positions_per_task = 64;
+// Floats summed by one task when the norm is taken across the spatial dims
+const size_t part_elements = 4096;
+
+}  // namespace
+
+MKLDNNNormalizeNode::MKLDNNNormalizeNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
+        : MKLDNNNode(layer, eng) {}
+
+void MKLDNNNormalizeNode::getSupportedDescriptors() {
+    auto * layer = getCnnLayer().get();
+    if (layer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get CNN layer for " << getName();
+
+    if (getParentEdges().size() != 1)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    if (CaselessEq<std::string>()(layer->type, "GRN")) {
+        auto * grnLayer = dynamic_cast<GRNLayer*>(layer);
+        if (grnLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot convert GRN layer.";
+        across_spatial = false;
+        channel_shared = true;
+        eps = grnLayer->bias;
+        return;
+    }
+
+    auto weights = layer->blobs.find("weights");
+    if (weights == layer->blobs.end() || !weights->second)
+        THROW_IE_EXCEPTION << layer->name << " weights is empty!";
+    if (weights->second->precision() != Precision::FP32)
+        THROW_IE_EXCEPTION << layer->name << " weights precision is not supported!";
+    across_spatial = layer->GetParamAsInt("across_spatial") != 0;
+    channel_shared = layer->GetParamAsInt("channel_shared") != 0;
+    eps = layer->GetParamAsFloat("eps");
+}
+
+void MKLDNNNormalizeNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
+    if (precision != InferenceEngine::Precision::FP32)
+        precision = InferenceEngine::Precision::FP32;
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    precision = getCnnLayer()->outData[0]->getPrecision();
+    if (precision != InferenceEngine::Precision::FP32)
+        precision = InferenceEngine::Precision::FP32;
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+
+    auto pushDesc = [&](memory::format format) {
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, format);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, format);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+    };
+
+    auto& dims = getParentEdgeAt(0)->getDims();
+    pushDesc(MKLDNNMemory::GetPlainFormat(dims));
+    if (dims.ndims() == 4) {
+        pushDesc(memory::nChw8c);
+        pushDesc(memory::nChw16c);
+    }
+}
+
+void MKLDNNNormalizeNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+
+    // The layer is released after the primitives are created, so the scales are copied
+    auto& dims = getParentEdgeAt(0)->getDims();
+    size_t C = dims.ndims() > 1 ? static_cast<size_t>(dims[1]) : 1lu;
+    scales.assign((C + 15lu) / 16lu * 16lu, 0.0f);
+    auto weights = getCnnLayer()->blobs.find("weights");
+    if (weights == getCnnLayer()->blobs.end()) {
+        std::fill(scales.begin(), scales.begin() + C, 1.0f);
+        return;
+    }
+    const float* scl = weights->second->buffer().as<const float*>();
+    for (size_t c = 0; c < C; c++)
+        scales[c] = channel_shared ? scl[0] : scl[c];
+}
+
+template <size_t blk_size>
+void MKLDNNNormalizeNode::normalizeAcrossSpatial(const float* src_data, float* dst_data, size_t N, size_t C, size_t S) {
+    const size_t CB = (C + blk_size - 1) / blk_size;
+    const size_t part_size = std::max<size_t>(1lu, part_elements / blk_size);
+    const size_t parts = (S + part_size - 1) / part_size;
+
+    // Two-level reduction: sums of squares of the parts first, the sample norms from them
+    std::vector<double> partSums(N * CB * parts);
+    parallel_for3d(N, CB, parts, [&](size_t n, size_t cb, size_t p) {
+        const float* src = src_data + (n * CB + cb) * S * blk_size;
+        size_t lanes = std::min(blk_size, C - cb * blk_size);
+        float sum[blk_size] = {};
+        for (size_t s = p * part_size; s < std::min(S, (p + 1) * part_size); s++) {
+            for (size_t c = 0; c < blk_size; c++)
+                sum[c] += src[s * blk_size + c] * src[s * blk_size + c];
+        }
+        double partSum = 0.0;
+        for (size_t c = 0; c < lanes; c++)
+            partSum += sum[c];
+        partSums[(n * CB + cb) * parts + p] = partSum;
+    });
+
+    std::vector<float> norms(N);
+    for (size_t n = 0; n < N; n++) {
+        double sum = eps;
+        for (size_t i = 0; i < CB * parts; i++)
+            sum += partSums[n * CB * parts + i];
+        norms[n] = static_cast<float>(1.0 / std::sqrt(sum));
+    }
+
+    parallel_for3d(N, CB, parts, [&](size_t n, size_t cb, size_t p) {
+        const float* src = src_data + (n * CB + cb) * S * blk_size;
+        float* dst = dst_data + (n * CB + cb) * S * blk_size;
+        float scale[blk_size];
+        for (size_t c = 0; c < blk_size; c++)
+            scale[c] = scales[cb * blk_size + c] * norms[n];
+        for (size_t s = p * part_size; s < std::min(S, (p + 1) * part_size); s++) {
+            for (size_t c = 0; c < blk_size; c++)
+                dst[s * blk_size + c] = src[s * blk_size + c] * scale[c];
+        }
+    });
+}
+
+template <size_t blk_size>
+void MKLDNNNormalizeNode::normalizePerPosition(const float* src_data, float* dst_data, size_t N, size_t C, size_t S) {
+    const size_t CB = (C + blk_size - 1) / blk_size;
+    const size_t tasks = (S + positions_per_task - 1) / positions_per_task;
+
+    parallel_for2d(N, tasks, [&](size_t n, size_t t) {
+        const size_t s0 = t * positions_per_task;
+        const size_t s1 = std::min(S, s0 + positions_per_task);
+        const float* src = src_data + n * CB * S * blk_size;
+        float* dst = dst_data + n * CB * S * blk_size;
+
+        float norms[positions_per_task] = {};
+        for (size_t cb = 0; cb < CB; cb++) {
+            const float* src_cb = src + cb * S * blk_size;
+            size_t lanes = std::min(blk_size, C - cb * blk_size);
+            if (lanes == blk_size) {
+                for (size_t s = s0; s < s1; s++) {
+                    float sum = 0.0f;
+                    for (size_t c = 0; c < blk_size; c++)
+                        sum += src_cb[s * blk_size + c] * src_cb[s * blk_size + c];
+                    norms[s - s0] += sum;
+                }
+            } else {
+                for (size_t s = s0; s < s1; s++) {
+                    for (size_t c = 0; c < lanes; c++)
+                        norms[s - s0] += src_cb[s * blk_size + c] * src_cb[s * blk_size + c];
+                }
+            }
+        }
+        for (size_t s = s0; s < s1; s++)
+            norms[s - s0] = 1.0f / std::sqrt(norms[s - s0] + eps);
+
+        for (size_t cb = 0; cb < CB; cb++) {
+            const float* src_cb = src + cb * S * blk_size;
+            float* dst_cb = dst + cb * S * blk_size;
+            const float* scale = &scales[cb * blk_size];
+            for (size_t s = s0; s < s1; s++) {
+                for (size_t c = 0; c < blk_size; c++)
+                    dst_cb[s * blk_size + c] = src_cb[s * blk_size + c] * norms[s - s0] * scale[c];
+            }
+        }
+    });
+}
+
+void MKLDNNNormalizeNode::execute(mkldnn::stream strm) {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+
+    const float *src_data = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_data = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    memory::dims dims = srcMemory.GetDims();
+    size_t N = static_cast<size_t>(batchToProcess());
+    size_t C = dims.size() > 1 ? static_cast<size_t>(dims[1]) : 1lu;
+    size_t S = 1;
+    for (size_t i = 2; i < dims.size(); i++)
+        S *= static_cast<size_t>(dims[i]);
+
+    int blk_size = 1;
+    if (!MKLDNNMemory::IsPlainFormat(srcMemory.GetFormat())) {
+        blk_size = srcMemory.GetDescriptor().data.layout_desc.blocking.block_dims[1];
+    }
+
+    switch (blk_size) {
+        case 1:
+            across_spatial ? normalizeAcrossSpatial<1>(src_data, dst_data, N, C, S)
+                           : normalizePerPosition<1>(src_data, dst_data, N, C, S);
+            break;
+        case 8:
+            across_spatial ? normalizeAcrossSpatial<8>(src_data, dst_data, N, C, S)
+                           : normalizePerPosition<8>(src_data, dst_data, N, C, S);
+            break;
+        case 16:
+            across_spatial ? normalizeAcrossSpatial<16>(src_data, dst_data, N, C, S)
+                           : normalizePerPosition<16>(src_data, dst_data, N, C, S);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Normalize " << getName() << " does not support the block size " << blk_size;
+    }
+}
+
+bool MKLDNNNormalizeNode::created() const {
+    return getType() == Normalize;
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * L2 normalization over channels, either per spatial position or across the whole sample.
+ * GRN is handled as normalization per position with the bias as epsilon and without scales.
+ */
+class MKLDNNNormalizeNode : public MKLDNNNode {
+public:
+    MKLDNNNormalizeNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNNormalizeNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    template <size_t blk_size>
+    void normalizeAcrossSpatial(const float* src_data, float* dst_data, size_t N, size_t C, size_t S);
+    template <size_t blk_size>
+    void normalizePerPosition(const float* src_data, float* dst_data, size_t N, size_t C, size_t S);
+
+    static Register<MKLDNNNormalizeNode> reg;
+    bool across_spatial = true;
+    bool channel_shared = true;
+    float eps = 1e-10f;
+
+    // Scales of the channels padded with zeros up to the channel blocks
+    std::vector<float> scales;
+};
+
+}  // namespace MKLDNNPlugin
+
@@ -6,12 +6,27 @@
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <string>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "details/caseless.hpp"
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+// Positions ranked by one task when the softmax axis is not the innermost one
+const size_t positions_per_task = 64;
+
+}  // namespace
 
 MKLDNNSoftMaxNode::MKLDNNSoftMaxNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
 
@@ -39,6 +54,21 @@ void MKLDNNSoftMaxNode::getSupportedDescriptors() {
         THROW_IE_EXCEPTION << "Incorrect axis!";
     }
 
+    for (auto& fusedNode : getFusedWith()) {
+        auto layer = fusedNode->getCnnLayer();
+        if (fusedNode->getType() == Generic && layer && CaselessEq<std::string>()(layer->type, "ArgMax")) {
+            fusedTopK = true;
+            top_k = layer->GetParamAsInt("top_k");
+            out_max_val = layer->GetParamAsInt("out_max_val") != 0;
+            has_axis = layer->params.find("axis") != layer->params.end();
+        }
+    }
+    if (fusedTopK) {
+        if (top_k < 1 || top_k > getParentEdgeAt(0)->getDims()[axis])
+            THROW_IE_EXCEPTION << "Incorrect top_k of ArgMax fused into " << getName();
+        return;
+    }
+
     if (getParentEdgeAt(0)->getDims().ndims() == 3) {
         MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType, memory::format::blocked);
         createDescriptor({in_candidate}, {});
@@ -55,7 +85,44 @@ void MKLDNNSoftMaxNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNSoftMaxNode::initSupportedPrimitiveDescriptors() {
+    if (!fusedTopK) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // The fused node reads the logits and writes the ArgMax output, both planar
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = axis != 0;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+
+    auto& inDims = getParentEdgeAt(0)->getDims();
+    auto& outDims = getChildEdgeAt(0)->getDims();
+    config.inConfs[0].desc = MKLDNNMemoryDesc(inDims, memory::f32, MKLDNNMemory::GetPlainFormat(inDims));
+    config.outConfs[0].desc = MKLDNNMemoryDesc(outDims, memory::f32, MKLDNNMemory::GetPlainFormat(outDims));
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+}
+
 void MKLDNNSoftMaxNode::createPrimitive() {
+    if (fusedTopK) {
+        auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+        auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+        if (getSelectedPrimitiveDescriptor() == nullptr)
+            THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
+        return;
+    }
+
     if (prim)
         return;
 
@@ -85,11 +152,95 @@ void MKLDNNSoftMaxNode::createPrimitive() {
                                 getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
+void MKLDNNSoftMaxNode::executeTopK(const float* src_data, float* dst_data, size_t outer, size_t channels,
+                                    size_t inner) {
+    const size_t K = static_cast<size_t>(top_k);
+    const size_t tasks = (inner + positions_per_task - 1) / positions_per_task;
+
+    // Softmax keeps the order of the logits: the ranking needs neither the exponents nor the
+    // probabilities, the sum of the exponents is taken only when the maximums are written
+    parallel_for2d(outer, tasks, [&](size_t o, size_t t) {
+        const size_t i0 = t * positions_per_task;
+        const size_t i1 = std::min(inner, i0 + positions_per_task);
+        const float* src = src_data + o * channels * inner;
+
+        // Sorted top k of every position, equal values rank by the larger index as in ArgMax
+        std::vector<std::pair<float, int>> top((i1 - i0) * K,
+                                               std::make_pair(-std::numeric_limits<float>::infinity(), -1));
+        for (size_t c = 0; c < channels; c++) {
+            const float* src_c = src + c * inner;
+            for (size_t i = i0; i < i1; i++) {
+                std::pair<float, int> value(src_c[i], static_cast<int>(c));
+                auto* top_i = &top[(i - i0) * K];
+                if (value > top_i[K - 1]) {
+                    size_t j = K - 1;
+                    for (; j > 0 && value > top_i[j - 1]; j--)
+                        top_i[j] = top_i[j - 1];
+                    top_i[j] = value;
+                }
+            }
+        }
+
+        float sums[positions_per_task] = {};
+        if (out_max_val) {
+            for (size_t c = 0; c < channels; c++) {
+                const float* src_c = src + c * inner;
+                for (size_t i = i0; i < i1; i++)
+                    sums[i - i0] += std::exp(src_c[i] - top[(i - i0) * K].first);
+            }
+        }
+
+        for (size_t i = i0; i < i1; i++) {
+            const auto* top_i = &top[(i - i0) * K];
+            for (size_t j = 0; j < K; j++) {
+                float index = static_cast<float>(top_i[j].second);
+                float prob = out_max_val ? std::exp(top_i[j].first - top_i[0].first) / sums[i - i0] : 0.0f;
+                if (!has_axis && out_max_val) {
+                    // Indices and then maximums of every sample
+                    dst_data[2 * o * K + j] = index;
+                    dst_data[2 * o * K + K + j] = prob;
+                } else {
+                    dst_data[(o * K + j) * inner + i] = out_max_val ? prob : index;
+                }
+            }
+        }
+    });
+}
+
+void MKLDNNSoftMaxNode::execute(mkldnn::stream strm) {
+    if (!fusedTopK) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+
+    const float *src_data = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_data = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    memory::dims dims = srcMemory.GetDims();
+    size_t outer = 1;
+    for (int i = 0; i < axis; i++)
+        outer *= i == 0 ? static_cast<size_t>(batchToProcess()) : static_cast<size_t>(dims[i]);
+    size_t inner = 1;
+    for (size_t i = axis + 1; i < dims.size(); i++)
+        inner *= static_cast<size_t>(dims[i]);
+
+    executeTopK(src_data, dst_data, outer, static_cast<size_t>(dims[axis]), inner);
+}
+
 bool MKLDNNSoftMaxNode::created() const {
     return getType() == SoftMax;
 }
 
 void MKLDNNSoftMaxNode::initOptimalPrimitiveDescriptor() {
+    // The descriptors of the fused node are final, there is no mkl-dnn primitive to match
+    if (fusedTopK)
+        return;
+
     auto config = getSelectedPrimitiveDescriptor()->getConfig();
     if (isInitConfig(config))
         return;
@@ -12,6 +12,10 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Softmax by the mkl-dnn primitive. Fused with the following ArgMax the node writes
+ * only the top k indices or probabilities of every softmax row.
+ */
 class MKLDNNSoftMaxNode : public MKLDNNNode {
 public:
     MKLDNNSoftMaxNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
@@ -21,12 +25,22 @@ public:
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
 
 private:
+    void executeTopK(const float* src_data, float* dst_data, size_t outer, size_t channels, size_t inner);
+
     static Register<MKLDNNSoftMaxNode> reg;
     int axis = 0;
+
+    // Parameters of the fused ArgMax
+    bool fusedTopK = false;
+    int top_k = 1;
+    bool out_max_val = false;
+    bool has_axis = true;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,307 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmarks {
+
+bool State::KeepRunning() {
+    if (!_started) {
+        _started = true;
+        _left = _error.empty() ? _iterations : 0;
+        ResumeTiming();
+    }
+
+    if (_left > 0) {
+        _left--;
+        return true;
+    }
+
+    PauseTiming();
+    return false;
+}
+
+void State::PauseTiming() {
+    if (_paused)
+        return;
+    _realTime += std::chrono::duration<double>(clock::now() - _realStart).count();
+    _cpuTime += static_cast<double>(std::clock() - _cpuStart) / CLOCKS_PER_SEC;
+    _paused = true;
+}
+
+void State::ResumeTiming() {
+    _realStart = clock::now();
+    _cpuStart = std::clock();
+    _paused = false;
+}
+
+int64_t State::range(size_t i) const {
+    return i < _args.size() ? _args[i] : 0;
+}
+
+void State::SkipWithError(const std::string& message) {
+    _error = message;
+    _left = 0;
+}
+
+void UseCharPointer(char const volatile*) {}
+
+static std::vector<std::unique_ptr<Benchmark>>& registry() {
+    static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+    return benchmarks;
+}
+
+Benchmark* RegisterBenchmark(const std::string& name, Function function) {
+    registry().emplace_back(new Benchmark(name, std::move(function)));
+    return registry().back().get();
+}
+
+class Runner {
+public:
+    struct Result {
+        std::string name;
+        int64_t iterations = 0;
+        int repetitions = 0;
+        // per iteration, medians over the repetitions
+        double realTimeNs = 0.;
+        double cpuTimeNs = 0.;
+        double bytesPerSecond = 0.;
+        double itemsPerSecond = 0.;
+        std::string label;
+        std::string error;
+    };
+
+    Runner(double minTime, int repetitions) : _minTime(minTime), _repetitions(repetitions) {}
+
+    static std::string fullName(const Benchmark& benchmark, const std::vector<int64_t>& args) {
+        std::string name = benchmark._name;
+        for (auto arg : args)
+            name += "/" + std::to_string(arg);
+        return name;
+    }
+
+    // a benchmark without arguments runs once with the empty set
+    static std::vector<std::vector<int64_t>> argSets(const Benchmark& benchmark) {
+        return benchmark._args.empty() ? std::vector<std::vector<int64_t>>(1) : benchmark._args;
+    }
+
+    Result run(const Benchmark& benchmark, const std::vector<int64_t>& args) const {
+        Result result;
+        result.name = fullName(benchmark, args);
+        result.repetitions = _repetitions;
+
+        const double minTime = benchmark._minTime > 0. ? benchmark._minTime : _minTime;
+        std::vector<State> runs;
+        for (int r = 0; r < _repetitions; r++) {
+            int64_t iterations = 1;
+            for (;;) {
+                State state(args, iterations);
+                try {
+                    benchmark._function(state);
+                } catch (const std::exception& e) {
+                    state.SkipWithError(e.what());
+                }
+
+                if (state._error.empty() && (!state._started || state._left != 0 || !state._paused))
+                    state.SkipWithError("the timing loop was not run to the end");
+                if (!state._error.empty()) {
+                    result.error = state._error;
+                    return result;
+                }
+
+                // the growth of the iteration count follows Google Benchmark
+                if (state._realTime >= minTime || iterations >= 1000000000) {
+                    runs.push_back(state);
+                    break;
+                }
+                double multiplier = state._realTime / minTime > 0.1 ? minTime * 1.4 / state._realTime : 10.;
+                iterations = (std::max)(static_cast<int64_t>(iterations * multiplier), iterations + 1);
+            }
+        }
+
+        auto median = [&](std::function<double(const State&)> value) {
+            std::vector<double> values;
+            for (auto& run : runs)
+                values.push_back(value(run));
+            std::sort(values.begin(), values.end());
+            return values[values.size() / 2];
+        };
+
+        const State& last = runs.back();
+        result.iterations = last._iterations;
+        result.label = last._label;
+        result.realTimeNs = median([](const State& s) { return s._realTime * 1e9 / s._iterations; });
+        result.cpuTimeNs = median([](const State& s) { return s._cpuTime * 1e9 / s._iterations; });
+        if (last._bytes)
+            result.bytesPerSecond = median([](const State& s) { return s._bytes / s._realTime; });
+        if (last._items)
+            result.itemsPerSecond = median([](const State& s) { return s._items / s._realTime; });
+        return result;
+    }
+
+private:
+    double _minTime;
+    int _repetitions;
+};
+
+static std::string escape(const std::string& str) {
+    std::string escaped;
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", c);
+            escaped += code;
+            continue;
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+static void writeJson(std::ostream& out, const char* executable, const std::vector<Runner::Result>& results) {
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+
+    out << "{\n";
+    out << "  \"context\": {\n";
+    out << "    \"date\": \"" << date << "\",\n";
+    out << "    \"executable\": \"" << escape(executable) << "\",\n";
+    out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+    out << "    \"library_build_type\": \"release\"\n";
+#else
+    out << "    \"library_build_type\": \"debug\"\n";
+#endif
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        auto& r = results[i];
+        out << (i ? ",\n" : "\n") << "    {\n";
+        out << "      \"name\": \"" << escape(r.name) << "\",\n";
+        if (!r.error.empty()) {
+            out << "      \"error_occurred\": true,\n";
+            out << "      \"error_message\": \"" << escape(r.error) << "\"\n";
+            out << "    }";
+            continue;
+        }
+        out << std::setprecision(10);
+        out << "      \"iterations\": " << r.iterations << ",\n";
+        out << "      \"repetitions\": " << r.repetitions << ",\n";
+        out << "      \"real_time\": " << r.realTimeNs << ",\n";
+        out << "      \"cpu_time\": " << r.cpuTimeNs << ",\n";
+        out << "      \"time_unit\": \"ns\"";
+        if (r.bytesPerSecond > 0.)
+            out << ",\n      \"bytes_per_second\": " << r.bytesPerSecond;
+        if (r.itemsPerSecond > 0.)
+            out << ",\n      \"items_per_second\": " << r.itemsPerSecond;
+        if (!r.label.empty())
+            out << ",\n      \"label\": \"" << escape(r.label) << "\"";
+        out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+static void printResult(const Runner::Result& r) {
+    std::cout << std::left << std::setw(56) << r.name << std::right;
+    if (!r.error.empty()) {
+        std::cout << " ERROR: " << r.error << std::endl;
+        return;
+    }
+    std::cout << std::fixed << std::setprecision(0)
+              << std::setw(14) << r.realTimeNs << " ns"
+              << std::setw(14) << r.cpuTimeNs << " ns"
+              << std::setw(12) << r.iterations;
+    std::cout.unsetf(std::ios::fixed);
+    std::cout << std::setprecision(4);
+    if (r.bytesPerSecond > 0.)
+        std::cout << "  " << r.bytesPerSecond / (1 << 30) << " GiB/s";
+    if (r.itemsPerSecond > 0.)
+        std::cout << "  " << r.itemsPerSecond / 1e6 << " M items/s";
+    if (!r.label.empty())
+        std::cout << "  " << r.label;
+    std::cout << std::endl;
+}
+
+int RunSpecifiedBenchmarks(int argc, char* argv[]) {
+    std::string filter, out;
+    double minTime = 0.5;
+    int repetitions = 3;
+    bool list = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&](const std::string& key) -> const char* {
+            return arg.compare(0, key.size(), key) == 0 ? argv[i] + key.size() : nullptr;
+        };
+        if (auto v = value("--filter=")) {
+            filter = v;
+        } else if (auto v = value("--min_time=")) {
+            minTime = std::atof(v);
+        } else if (auto v = value("--repetitions=")) {
+            repetitions = (std::max)(1, std::atoi(v));
+        } else if (auto v = value("--out=")) {
+            out = v;
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl
+                      << "Usage: " << argv[0]
+                      << " [--filter=<substring>] [--min_time=<seconds>] [--repetitions=<n>] [--out=<file.json>] [--list]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    Runner runner(minTime, repetitions);
+    std::vector<Runner::Result> results;
+    bool failed = false;
+    for (auto& benchmark : registry()) {
+        for (auto& args : Runner::argSets(*benchmark)) {
+            auto name = Runner::fullName(*benchmark, args);
+            if (name.find(filter) == std::string::npos)
+                continue;
+            if (list) {
+                std::cout << name << std::endl;
+                continue;
+            }
+
+            results.push_back(runner.run(*benchmark, args));
+            printResult(results.back());
+            failed |= !results.back().error.empty();
+        }
+    }
+
+    if (!out.empty()) {
+        std::ofstream file(out);
+        if (!file) {
+            std::cerr << "Cannot write " << out << std::endl;
+            return 1;
+        }
+        writeJson(file, argv[0], results);
+    }
+    return failed ? 1 : 0;
+}
+
+}  // namespace benchmarks
+
+int main(int argc, char* argv[]) {
+    return benchmarks::RunSpecifiedBenchmarks(argc, argv);
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A minimal microbenchmark harness with the interface and the JSON report of Google Benchmark
+ * @file benchmark.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmarks {
+
+/**
+ * @brief Timing loop of one run of a benchmark, the body is measured as
+ *  while (state.KeepRunning()) { ... }
+ */
+class State {
+public:
+    State(const std::vector<int64_t>& args, int64_t iterations) : _args(args), _iterations(iterations) {}
+
+    /**
+     * @brief Starts the timer on the first call and stops it after the last iteration
+     * @return true while there are iterations left
+     */
+    bool KeepRunning();
+
+    /** @brief Excludes the setup done inside the timing loop from the measurement */
+    void PauseTiming();
+    void ResumeTiming();
+
+    /** @brief Argument i of the current parameter set */
+    int64_t range(size_t i) const;
+
+    int64_t iterations() const { return _iterations; }
+
+    /** @brief Totals over all the iterations, reported as bytes_per_second and items_per_second */
+    void SetBytesProcessed(int64_t bytes) { _bytes = bytes; }
+    void SetItemsProcessed(int64_t items) { _items = items; }
+
+    /** @brief Free text reported with the result, e.g. the implementation chosen for the parameters */
+    void SetLabel(const std::string& label) { _label = label; }
+
+    /** @brief Marks the run as failed, the result is reported with the message and is not compared */
+    void SkipWithError(const std::string& message);
+
+private:
+    friend class Runner;
+
+    using clock = std::chrono::steady_clock;
+
+    std::vector<int64_t> _args;
+    int64_t _iterations;
+    int64_t _left = 0;
+    bool _started = false;
+    bool _paused = false;
+
+    clock::time_point _realStart;
+    std::clock_t _cpuStart = 0;
+    double _realTime = 0.;
+    double _cpuTime = 0.;
+
+    int64_t _bytes = 0;
+    int64_t _items = 0;
+    std::string _label;
+    std::string _error;
+};
+
+using Function = std::function<void(State&)>;
+
+/**
+ * @brief Registered benchmark: a function and the parameter sets it runs with,
+ *  every set is reported as <name>/<arg0>/<arg1>/...
+ */
+class Benchmark {
+public:
+    Benchmark(std::string name, Function function) : _name(std::move(name)), _function(std::move(function)) {}
+
+    Benchmark* Args(const std::vector<int64_t>& args) {
+        _args.push_back(args);
+        return this;
+    }
+
+    Benchmark* Arg(int64_t arg) {
+        return Args({arg});
+    }
+
+    /** @brief Runs every parameter set for at least the given time instead of the --min_time one */
+    Benchmark* MinTime(double seconds) {
+        _minTime = seconds;
+        return this;
+    }
+
+private:
+    friend class Runner;
+
+    std::string _name;
+    Function _function;
+    std::vector<std::vector<int64_t>> _args;
+    double _minTime = 0.;
+};
+
+/**
+ * @brief Registers a benchmark, the returned pointer stays valid till the end of the program
+ */
+Benchmark* RegisterBenchmark(const std::string& name, Function function);
+
+/**
+ * @brief Runs the benchmarks selected by the command line, prints a table and writes the JSON report
+ *  --filter=<substring>   runs the benchmarks whose full name contains the substring
+ *  --min_time=<seconds>   minimum time of a repetition, 0.5 by default
+ *  --repetitions=<n>      repetitions of every parameter set, the median is reported, 3 by default
+ *  --out=<file>           JSON report in the Google Benchmark format
+ *  --list                 prints the names without running them
+ * @return 0 if no benchmark failed
+ */
+int RunSpecifiedBenchmarks(int argc, char* argv[]);
+
+/**
+ * @brief Keeps the compiler from optimizing away a value computed only for the benchmark
+ */
+void UseCharPointer(char const volatile* pointer);
+
+template <typename T>
+inline void DoNotOptimize(T const& value) {
+    UseCharPointer(&reinterpret_cast<char const volatile&>(value));
+}
+
+}  // namespace benchmarks
+
+#define BENCHMARK_CONCAT_(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_(a, b)
+
+#define BENCHMARK(function) \
+    static ::benchmarks::Benchmark* BENCHMARK_CONCAT(benchmark_, __LINE__) = \
+        ::benchmarks::RegisterBenchmark(#function, function)
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+ Copyright (c) 2018 Intel Corporation
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+"""
+
+"""
+Compares a JSON report of InferenceEngineBenchmarks (or of any Google Benchmark binary) with a stored baseline
+and exits with 1 if a benchmark became slower than the threshold allows or failed.
+
+    InferenceEngineBenchmarks --out=current.json
+    compare_benchmarks.py baseline.json current.json --threshold 10
+    compare_benchmarks.py baseline.json current.json --update    # accept current.json as the new baseline
+
+Regressions are only meaningful against a baseline of the same host, so the baseline is not stored in the tree.
+With --update a missing baseline is created from the current report, so the first run on a machine starts it.
+The benchmarks missing from the baseline are listed as new.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import sys
+
+TIME_UNITS = {"ns": 1., "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    with open(path) as f:
+        report = json.load(f)
+    results = {}
+    for bench in report.get("benchmarks", []):
+        # the aggregates of --benchmark_repetitions of Google Benchmark are compared by their median only
+        if bench.get("run_type") == "aggregate" and bench.get("aggregate_name") != "median":
+            continue
+        results[bench.get("run_name", bench["name"])] = bench
+    return report.get("context", {}), results
+
+
+def time_ns(bench, metric):
+    return bench[metric] * TIME_UNITS[bench.get("time_unit", "ns")]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flags benchmark regressions against a baseline")
+    parser.add_argument("baseline", help="JSON report the current one is compared with")
+    parser.add_argument("current", help="JSON report of the build under review")
+    parser.add_argument("--threshold", type=float, default=10.,
+                        help="slowdown in percent reported as a regression, 10 by default")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="real_time",
+                        help="time compared, real_time by default")
+    parser.add_argument("--filter", default="", help="compares only the benchmarks whose name contains it")
+    parser.add_argument("--update", action="store_true",
+                        help="replaces the baseline with the current report after the comparison "
+                             "(creates the baseline if it is missing)")
+    args = parser.parse_args()
+
+    if args.update and not os.path.exists(args.baseline):
+        shutil.copyfile(args.current, args.baseline)
+        print("no baseline to compare with, {} is created from {}".format(args.baseline, args.current))
+        return 0
+
+    base_context, baseline = load(args.baseline)
+    current_context, current = load(args.current)
+    if base_context.get("num_cpus") != current_context.get("num_cpus"):
+        print("warning: the reports were taken on machines with {} and {} CPUs".format(
+            base_context.get("num_cpus"), current_context.get("num_cpus")))
+
+    regressions, failures = [], []
+    print("{:<60} {:>14} {:>14} {:>9}".format("benchmark", "baseline, ns", "current, ns", "change"))
+    # in the order of the current report, then the benchmarks it lacks
+    for name in list(current) + [name for name in baseline if name not in current]:
+        if args.filter not in name:
+            continue
+        base, cur = baseline.get(name), current.get(name)
+        if cur is None:
+            print("{:<60} {:>14} {:>14} {:>9}".format(name, "", "missing", ""))
+            continue
+        if cur.get("error_occurred"):
+            failures.append(name)
+            print("{:<60} {:>14} {:>14} {:>9}".format(name, "", "FAILED", "") + "  " + cur.get("error_message", ""))
+            continue
+        if base is None or base.get("error_occurred"):
+            print("{:<60} {:>14} {:>14.0f} {:>9}".format(name, "new", time_ns(cur, args.metric), ""))
+            continue
+
+        base_ns, cur_ns = time_ns(base, args.metric), time_ns(cur, args.metric)
+        change = (cur_ns - base_ns) / base_ns * 100. if base_ns > 0 else 0.
+        mark = ""
+        if change > args.threshold:
+            regressions.append(name)
+            mark = "  REGRESSION"
+        elif change < -args.threshold:
+            mark = "  improvement"
+        print("{:<60} {:>14.0f} {:>14.0f} {:>+8.1f}%".format(name, base_ns, cur_ns, change) + mark)
+
+    if args.update:
+        shutil.copyfile(args.current, args.baseline)
+
+    if regressions or failures:
+        print("\n{} regression(s) over {}%, {} failure(s)".format(len(regressions), args.threshold, len(failures)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
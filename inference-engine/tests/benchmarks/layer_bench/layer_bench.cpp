@@ -0,0 +1,588 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Runs a single layer in isolation and reports its time per call, the achieved GFLOP/s and GB/s against
+ * a roofline and the implementation that was chosen for it.
+ *
+ * A layer is described by one line of space separated key=value pairs:
+ *     type=Convolution in=1x64x56x56 kernel-x=3 kernel-y=3 pad-x=1 pad-y=1 output=64 name=res2a_branch2b
+ * The reserved keys are
+ *     type       - the IR type of the layer
+ *     in         - the input shapes, comma separated for the layers with several inputs (Eltwise, Concat)
+ *     out        - the output shape, it is inferred by the shape inference of the IR when omitted
+ *     precision  - the precision of the layer, only FP32 is supported: an int8 layer is made by the calibration
+ *                  tool from the statistics of a network, which a single layer does not have
+ *     layout     - the layout of the network input (NCHW, NHWC, ...)
+ *     impl       - the preferred implementations of the CPU plugin, the PrimitivesPriority of the layer
+ *     name       - the name to report the layer under
+ * all the other keys are passed to the layer as the parameters of the IR.
+ *
+ * The layer is timed inside the MKLDNNGraph (--mode=graph, the default) with the node executed alone, so the
+ * reorders and the input conversion around it are not counted, or as the ILayerExecImpl of ie_cpu_extension
+ * (--mode=ext).
+ */
+
+#include <mkldnn_plugin/mkldnn_graph.h>
+#include <mkldnn_plugin/mkldnn_extension_mngr.h>
+#include <mkldnn_plugin/mkldnn_memory.h>
+#include <ext_list.hpp>
+
+#include <cpp/ie_cnn_net_reader.h>
+#include "xml_net_builder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct Options {
+    std::string mode = "graph";
+    std::string batch;
+    std::vector<std::string> layers;
+    size_t iters = 100;
+    double maxTime = 2.0;
+    size_t warmup = 5;
+    double peakGflops = 0.0;
+    double peakGbps = 0.0;
+};
+
+/**
+ * @brief The layer as it is written in the command line or in a line of the batch file
+ */
+struct LayerSpec {
+    std::string type;
+    std::string name;
+    std::vector<SizeVector> in;
+    SizeVector out;
+    Precision precision = Precision::FP32;
+    Layout layout = ANY;
+    std::map<std::string, std::string> params;
+};
+
+struct Result {
+    std::string impl;
+    std::vector<TensorDesc> inputs;
+    std::vector<TensorDesc> outputs;
+    std::vector<double> times;  // ms per call
+};
+
+SizeVector parseShape(const std::string& str) {
+    SizeVector dims;
+    std::istringstream stream(str);
+    std::string dim;
+    while (std::getline(stream, dim, 'x')) {
+        try {
+            dims.push_back(std::stoul(dim));
+        } catch (const std::exception&) {
+            THROW_IE_EXCEPTION << "Wrong shape '" << str << "', the dimensions are written as NxCxHxW";
+        }
+    }
+    if (dims.empty())
+        THROW_IE_EXCEPTION << "Empty shape";
+    return dims;
+}
+
+std::string shapeToString(const SizeVector& dims) {
+    std::string str;
+    for (auto dim : dims)
+        str += (str.empty() ? "" : "x") + std::to_string(dim);
+    return str;
+}
+
+Layout parseLayout(const std::string& str) {
+    static const std::map<std::string, Layout> layouts = {
+            {"NCHW", NCHW}, {"NHWC", NHWC}, {"NCDHW", NCDHW}, {"NDHWC", NDHWC}, {"CHW", CHW}, {"NC", NC}, {"C", C}};
+    auto found = layouts.find(str);
+    if (found == layouts.end())
+        THROW_IE_EXCEPTION << "Unsupported layout " << str;
+    return found->second;
+}
+
+LayerSpec parseSpec(const std::string& line) {
+    LayerSpec spec;
+    std::istringstream stream(line);
+    std::string token;
+    while (stream >> token) {
+        auto pos = token.find('=');
+        if (pos == std::string::npos || pos == 0)
+            THROW_IE_EXCEPTION << "Wrong token '" << token << "', key=value is expected";
+        std::string key = token.substr(0, pos);
+        std::string value = token.substr(pos + 1);
+
+        if (key == "type") {
+            spec.type = value;
+        } else if (key == "name") {
+            spec.name = value;
+        } else if (key == "in") {
+            std::istringstream shapes(value);
+            std::string shape;
+            while (std::getline(shapes, shape, ','))
+                spec.in.push_back(parseShape(shape));
+        } else if (key == "out") {
+            spec.out = parseShape(value);
+        } else if (key == "precision") {
+            spec.precision = Precision::FromStr(value);
+            if (spec.precision != Precision::FP32)
+                THROW_IE_EXCEPTION << "Unsupported precision " << value << ", the layers are benchmarked in FP32";
+        } else if (key == "layout") {
+            spec.layout = parseLayout(value);
+        } else if (key == "impl") {
+            spec.params["PrimitivesPriority"] = value;
+        } else {
+            spec.params[key] = value;
+        }
+    }
+    if (spec.type.empty())
+        THROW_IE_EXCEPTION << "The layer type is not set";
+    if (spec.in.empty())
+        THROW_IE_EXCEPTION << "The input shape is not set";
+    if (spec.name.empty())
+        spec.name = spec.type;
+    return spec;
+}
+
+size_t product(const SizeVector& dims, size_t first = 0) {
+    return std::accumulate(dims.begin() + (std::min)(first, dims.size()), dims.end(), size_t(1),
+                           std::multiplies<size_t>());
+}
+
+size_t param(const LayerSpec& spec, const std::string& key, size_t def) {
+    auto found = spec.params.find(key);
+    return found == spec.params.end() ? def : std::stoul(found->second);
+}
+
+// the kernel is either kernel-x and kernel-y or the "kernel" list with the innermost dimension last
+size_t kernelSize(const LayerSpec& spec) {
+    auto found = spec.params.find("kernel");
+    if (found == spec.params.end())
+        return param(spec, "kernel-x", 1) * param(spec, "kernel-y", 1);
+    size_t size = 1;
+    std::istringstream stream(found->second);
+    std::string dim;
+    while (std::getline(stream, dim, ','))
+        size *= std::stoul(dim);
+    return size;
+}
+
+/**
+ * @brief Number of the weights and the biases the IR declares for the layer, in elements
+ */
+std::pair<size_t, size_t> weightsOf(const LayerSpec& spec) {
+    const auto& in = spec.in[0];
+    size_t channels = in.size() > 1 ? in[1] : in[0];
+    if (spec.type == "Convolution" || spec.type == "Deconvolution") {
+        size_t outputs = param(spec, "output", 0);
+        return {outputs * channels / param(spec, "group", 1) * kernelSize(spec), outputs};
+    }
+    if (spec.type == "FullyConnected" || spec.type == "InnerProduct") {
+        size_t outputs = param(spec, "out-size", 0);
+        return {outputs * product(in, 1), outputs};
+    }
+    if (spec.type == "ScaleShift" || spec.type == "BatchNormalization")
+        return {channels, channels};
+    if (spec.type == "PReLU")
+        return {param(spec, "channel_shared", 0) ? 1 : channels, 0};
+    return {0, 0};
+}
+
+/**
+ * @brief The network of the inputs and the layer. The output shape of the IR is a placeholder of the right rank,
+ * the network is reshaped to its inputs to get the real one.
+ */
+CNNNetwork buildNetwork(const LayerSpec& spec) {
+    SizeVector out = spec.out;
+    if (out.empty()) {
+        if (spec.type == "FullyConnected" || spec.type == "InnerProduct")
+            out = {spec.in[0][0], param(spec, "out-size", 1)};
+        else
+            out = spec.in[0];
+    }
+
+    auto builder = testing::V2NetBuilder::buildNetworkWithOneInput("LayerBench", spec.in[0], "FP32");
+    for (size_t i = 1; i < spec.in.size(); i++)
+        builder.addInputLayer("FP32", spec.in[i]);
+
+    auto weights = weightsOf(spec);
+    auto params = spec.params;
+    builder.addLayer(spec.type, "FP32", &params, {spec.in, {out}},
+                     static_cast<int>(weights.first * sizeof(float)), static_cast<int>(weights.second * sizeof(float)));
+
+    std::string model;
+    if (spec.in.size() == 1) {
+        model = builder.finish();
+    } else {
+        auto edges = builder.havingEdges();
+        for (size_t i = 0; i < spec.in.size(); i++)
+            edges.connect(i, spec.in.size());
+        model = edges.finish();
+    }
+
+    size_t count = (std::max)(weights.first + weights.second, size_t(1));
+    TBlob<uint8_t>::Ptr blob(new TBlob<uint8_t>(Precision::U8, C, {count * sizeof(float)}));
+    blob->allocate();
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < count; i++)
+        data[i] = 0.01f * static_cast<float>(i % 17) - 0.08f;
+
+    CNNNetReader reader;
+    reader.ReadNetwork(model.data(), model.length());
+    reader.SetWeights(blob);
+    auto network = reader.getNetwork();
+    network.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+
+    if (spec.out.empty()) {
+        std::map<std::string, SizeVector> shapes;
+        for (auto& input : network.getInputsInfo())
+            shapes[input.first] = input.second->getTensorDesc().getDims();
+        try {
+            network.reshape(shapes);
+        } catch (const details::InferenceEngineException& e) {
+            THROW_IE_EXCEPTION << "Failed to infer the output shape, set it with out=: " << e.what();
+        }
+    }
+    return network;
+}
+
+CNNLayerPtr layerOf(CNNNetwork& network) {
+    auto consumers = network.getInputsInfo().begin()->second->getInputData()->getInputTo();
+    if (consumers.empty())
+        THROW_IE_EXCEPTION << "The layer is not connected to the input";
+    return consumers.begin()->second;
+}
+
+Blob::Ptr makeBlob(const TensorDesc& desc) {
+    Blob::Ptr blob;
+    switch (desc.getPrecision()) {
+        case Precision::FP32: blob = make_shared_blob<float>(desc); break;
+        case Precision::I32: blob = make_shared_blob<int32_t>(desc); break;
+        case Precision::I16: blob = make_shared_blob<int16_t>(desc); break;
+        case Precision::U16: blob = make_shared_blob<uint16_t>(desc); break;
+        case Precision::U8: blob = make_shared_blob<uint8_t>(desc); break;
+        case Precision::I8: blob = make_shared_blob<int8_t>(desc); break;
+        default: THROW_IE_EXCEPTION << "Unsupported precision " << desc.getPrecision().name();
+    }
+    blob->allocate();
+
+    // small values in the range of every precision, exact zeros would let some kernels shortcut
+    auto data = blob->buffer().as<uint8_t*>();
+    size_t elementSize = desc.getPrecision().size();
+    for (size_t i = 0; i < blob->size(); i++) {
+        if (desc.getPrecision() == Precision::FP32)
+            reinterpret_cast<float*>(data)[i] = 0.1f * static_cast<float>(i % 23) - 1.1f;
+        else
+            std::fill_n(data + i * elementSize, elementSize, static_cast<uint8_t>(i % 7 + 1));
+    }
+    return blob;
+}
+
+template <typename Call>
+std::vector<double> measure(const Options& options, Call call) {
+    using clock = std::chrono::high_resolution_clock;
+    for (size_t i = 0; i < options.warmup; i++)
+        call();
+
+    std::vector<double> times;
+    auto start = clock::now();
+    while (times.empty() || (times.size() < options.iters &&
+                             std::chrono::duration<double>(clock::now() - start).count() < options.maxTime)) {
+        auto begin = clock::now();
+        call();
+        times.push_back(std::chrono::duration<double, std::milli>(clock::now() - begin).count());
+    }
+    return times;
+}
+
+/**
+ * @brief The layer as a node of MKLDNNGraph, the label is the primitive the plugin selected and the formats
+ * of its input and output memory
+ */
+Result runGraph(const Options& options, const LayerSpec& spec, CNNNetwork& network) {
+    for (auto& input : network.getInputsInfo()) {
+        input.second->setPrecision(spec.precision);
+        if (spec.layout != ANY)
+            input.second->setLayout(spec.layout);
+    }
+    std::string layerName = layerOf(network)->name;
+
+    auto extMgr = std::make_shared<MKLDNNExtensionManager>();
+    extMgr->AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+    MKLDNNGraph graph;
+    graph.CreateGraph(network, extMgr);
+
+    for (auto& input : network.getInputsInfo())
+        graph.PushInputData(input.first, makeBlob(input.second->getTensorDesc()));
+    graph.Infer();
+
+    MKLDNNNodePtr layer;
+    size_t reorders = 0;
+    for (auto& node : graph.GetNodes()) {
+        if (node->getName() == layerName)
+            layer = node;
+        if (node->getType() == Reorder)
+            reorders++;
+    }
+    if (!layer)
+        THROW_IE_EXCEPTION << "The graph has no node for the layer " << layerName;
+
+    Result result;
+    result.impl = layer->getPrimitiveDescriptorType();
+    for (size_t i = 0; i < layer->getParentEdges().size(); i++) {
+        auto edge = layer->getParentEdgeAt(i);
+        result.inputs.push_back(edge->getDesc());
+        result.impl += (i ? "," : ":") + MKLDNNMemory::formatToString(edge->getMemory().GetFormat());
+    }
+    for (size_t i = 0; i < layer->getChildEdges().size(); i++) {
+        auto edge = layer->getChildEdgeAt(i);
+        result.outputs.push_back(edge->getDesc());
+        result.impl += (i ? "," : "->") + MKLDNNMemory::formatToString(edge->getMemory().GetFormat());
+    }
+    if (reorders)
+        result.impl += " (+" + std::to_string(reorders) + " reorders)";
+
+    // the node runs on the memory the graph has already prepared for it
+    mkldnn::stream stream(mkldnn::stream::kind::eager);
+    result.times = measure(options, [&] { layer->execute(stream); });
+    return result;
+}
+
+/**
+ * @brief The layer as ILayerExecImpl of ie_cpu_extension, the configuration of the requested input layout is
+ * preferred, otherwise the first one the implementation supports is used
+ */
+Result runExtension(const Options& options, const LayerSpec& spec, CNNNetwork& network) {
+    auto layer = layerOf(network);
+    Extensions::Cpu::CpuExtensions extensions;
+    ResponseDesc resp;
+
+    ILayerImplFactory* factoryPtr = nullptr;
+    if (extensions.getFactoryFor(factoryPtr, layer.get(), &resp) != OK)
+        THROW_IE_EXCEPTION << "ie_cpu_extension has no implementation of " << layer->type << ": " << resp.msg;
+    std::unique_ptr<ILayerImplFactory> factory(factoryPtr);
+
+    std::vector<ILayerImpl::Ptr> impls;
+    if (factory->getImplementations(impls, &resp) != OK || impls.empty())
+        THROW_IE_EXCEPTION << "Failed to create the implementation of " << layer->type << ": " << resp.msg;
+    auto impl = std::dynamic_pointer_cast<ILayerExecImpl>(impls[0]);
+    if (!impl)
+        THROW_IE_EXCEPTION << "The implementation of " << layer->type << " is not executable";
+
+    std::vector<LayerConfig> configs;
+    if (impl->getSupportedConfigurations(configs, &resp) != OK || configs.empty())
+        THROW_IE_EXCEPTION << "The implementation of " << layer->type << " has no configurations: " << resp.msg;
+    auto config = configs[0];
+    for (auto& conf : configs) {
+        if (!conf.inConfs.empty() && conf.inConfs[0].desc.getLayout() == spec.layout) {
+            config = conf;
+            break;
+        }
+    }
+    if (impl->init(config, &resp) != OK)
+        THROW_IE_EXCEPTION << "Failed to initialize the implementation of " << layer->type << ": " << resp.msg;
+
+    Result result;
+    std::vector<Blob::Ptr> inputs, outputs;
+    for (auto& conf : config.inConfs) {
+        result.inputs.push_back(conf.desc);
+        inputs.push_back(makeBlob(conf.desc));
+    }
+    for (auto& conf : config.outConfs) {
+        result.outputs.push_back(conf.desc);
+        outputs.push_back(makeBlob(conf.desc));
+    }
+
+    std::ostringstream label;
+    label << "ext:" << config.inConfs[0].desc.getLayout() << "->" << config.outConfs[0].desc.getLayout();
+    result.impl = label.str();
+
+    result.times = measure(options, [&] {
+        if (impl->execute(inputs, outputs, &resp) != OK)
+            THROW_IE_EXCEPTION << "Failed to execute " << layer->type << ": " << resp.msg;
+    });
+    return result;
+}
+
+double kernelVolume(const PropertyVector<unsigned int>& kernel) {
+    double volume = 1.0;
+    for (size_t i = 0; i < kernel.size(); i++)
+        volume *= kernel[i];
+    return volume;
+}
+
+/**
+ * @brief Floating point operations of one call, a multiply-add is two. The layers without a formula here are
+ * counted as one operation per output element.
+ */
+double flopsOf(const CNNLayerPtr& layer) {
+    const auto& in = layer->insData[0].lock()->getTensorDesc().getDims();
+    const auto& out = layer->outData[0]->getTensorDesc().getDims();
+    double outElements = static_cast<double>(product(out));
+
+    if (auto deconv = std::dynamic_pointer_cast<DeconvolutionLayer>(layer))
+        return 2.0 * static_cast<double>(product(in)) * out[1] / deconv->_group * kernelVolume(deconv->_kernel);
+    if (auto conv = std::dynamic_pointer_cast<ConvolutionLayer>(layer))
+        return 2.0 * outElements * in[1] / conv->_group * kernelVolume(conv->_kernel);
+    if (std::dynamic_pointer_cast<FullyConnectedLayer>(layer))
+        return 2.0 * outElements * static_cast<double>(product(in, 1));
+    if (auto pool = std::dynamic_pointer_cast<PoolingLayer>(layer))
+        return outElements * kernelVolume(pool->_kernel);
+    if (std::dynamic_pointer_cast<EltwiseLayer>(layer))
+        return outElements * static_cast<double>(layer->insData.size() - 1);
+    return outElements;
+}
+
+size_t bytesOf(const std::vector<TensorDesc>& descs) {
+    size_t bytes = 0;
+    for (auto& desc : descs)
+        bytes += product(desc.getDims()) * desc.getPrecision().size();
+    return bytes;
+}
+
+void printHeader() {
+    std::cout << std::left << std::setw(24) << "name" << std::setw(18) << "type" << std::setw(40) << "impl"
+              << std::setw(30) << "in -> out" << std::right << std::setw(10) << "min ms" << std::setw(10)
+              << "median ms" << std::setw(10) << "mean ms" << std::setw(10) << "GFLOP/s" << std::setw(10)
+              << "GB/s" << std::setw(8) << "roof %" << std::endl;
+}
+
+bool runSpec(const Options& options, const std::string& line) {
+    LayerSpec spec;
+    try {
+        spec = parseSpec(line);
+        auto network = buildNetwork(spec);
+        auto layer = layerOf(network);
+
+        Result result = options.mode == "ext" ? runExtension(options, spec, network)
+                                              : runGraph(options, spec, network);
+
+        auto times = result.times;
+        std::sort(times.begin(), times.end());
+        double median = times[times.size() / 2];
+        double mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
+
+        auto weights = weightsOf(spec);
+        double flops = flopsOf(layer);
+        double bytes = static_cast<double>(bytesOf(result.inputs) + bytesOf(result.outputs) +
+                                           (weights.first + weights.second) * sizeof(float));
+        double gflops = flops / (median * 1e6);
+        double gbps = bytes / (median * 1e6);
+
+        std::string shapes;
+        for (auto& desc : result.inputs)
+            shapes += (shapes.empty() ? "" : ",") + shapeToString(desc.getDims());
+        shapes += "->" + shapeToString(layer->outData[0]->getTensorDesc().getDims());
+
+        std::cout << std::left << std::setw(24) << spec.name << std::setw(18) << spec.type << std::setw(40)
+                  << result.impl << std::setw(30) << shapes << std::right << std::fixed << std::setprecision(4)
+                  << std::setw(10) << times.front() << std::setw(10) << median << std::setw(10) << mean
+                  << std::setprecision(2) << std::setw(10) << gflops << std::setw(10) << gbps;
+
+        // the attainable performance of the arithmetic intensity of the layer: min(peak, intensity * bandwidth)
+        if (options.peakGflops > 0 && options.peakGbps > 0) {
+            double attainable = (std::min)(options.peakGflops, flops / bytes * options.peakGbps);
+            std::cout << std::setw(8) << 100.0 * gflops / attainable;
+        } else if (options.peakGflops > 0) {
+            std::cout << std::setw(8) << 100.0 * gflops / options.peakGflops;
+        } else {
+            std::cout << std::setw(8) << "-";
+        }
+        std::cout << std::endl;
+        return true;
+    } catch (const std::exception& e) {
+        std::cout << std::left << std::setw(24) << (spec.name.empty() ? line : spec.name) << "FAILED: " << e.what()
+                  << std::endl;
+        return false;
+    }
+}
+
+void usage(const char* app) {
+    std::cout << "Usage: " << app << " [options] [layer ...]\n"
+              << "  a layer is a quoted list of key=value pairs, for example\n"
+              << "    \"type=Convolution in=1x64x56x56 kernel-x=3 kernel-y=3 pad-x=1 pad-y=1 output=64\"\n"
+              << "  reserved keys: type, in, out, precision, layout, impl, name; the others are layer parameters\n"
+              << "Options:\n"
+              << "  --batch=<file>       the layers to run, one per line, '#' starts a comment\n"
+              << "  --mode=graph|ext     run the layer as a MKLDNNGraph node or as ie_cpu_extension layer\n"
+              << "  --iters=<n>          the maximum number of timed calls (" << Options().iters << ")\n"
+              << "  --max_time=<s>       stop timing after this many seconds (" << Options().maxTime << ")\n"
+              << "  --warmup=<n>         untimed calls before the measurement (" << Options().warmup << ")\n"
+              << "  --peak_gflops=<f>    peak compute of the machine for the roofline\n"
+              << "  --peak_gbps=<f>      peak memory bandwidth of the machine for the roofline\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            auto value = [&arg](const std::string& key) -> const char* {
+                return arg.compare(0, key.size(), key) == 0 ? arg.c_str() + key.size() : nullptr;
+            };
+            if (arg == "-h" || arg == "--help") {
+                usage(argv[0]);
+                return 0;
+            } else if (auto v = value("--batch=")) {
+                options.batch = v;
+            } else if (auto v = value("--mode=")) {
+                options.mode = v;
+            } else if (auto v = value("--iters=")) {
+                options.iters = std::stoul(v);
+            } else if (auto v = value("--max_time=")) {
+                options.maxTime = std::stod(v);
+            } else if (auto v = value("--warmup=")) {
+                options.warmup = std::stoul(v);
+            } else if (auto v = value("--peak_gflops=")) {
+                options.peakGflops = std::stod(v);
+            } else if (auto v = value("--peak_gbps=")) {
+                options.peakGbps = std::stod(v);
+            } else if (arg.compare(0, 2, "--") == 0) {
+                THROW_IE_EXCEPTION << "Unknown option " << arg;
+            } else {
+                options.layers.push_back(arg);
+            }
+        }
+        if (options.mode != "graph" && options.mode != "ext")
+            THROW_IE_EXCEPTION << "Unknown mode " << options.mode;
+
+        if (!options.batch.empty()) {
+            std::ifstream file(options.batch);
+            if (!file)
+                THROW_IE_EXCEPTION << "Cannot open " << options.batch;
+            std::string line;
+            while (std::getline(file, line)) {
+                line = line.substr(0, line.find('#'));
+                if (line.find_first_not_of(" \t\r") != std::string::npos)
+                    options.layers.push_back(line);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (options.layers.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    printHeader();
+    bool ok = true;
+    for (auto& layer : options.layers)
+        ok = runSpec(options, layer) && ok;
+    return ok ? 0 : 1;
+}
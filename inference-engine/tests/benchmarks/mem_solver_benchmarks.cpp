@@ -0,0 +1,42 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark.hpp"
+
+#include <memory_solver.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using Box = InferenceEngine::MemorySolver::Box;
+
+namespace {
+
+// Boxes of a topologically sorted graph: each edge lives from its producer to one of the next few consumers
+std::vector<Box> makeBoxes(int count, int maxLifetime) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> lifetime(1, maxLifetime);
+    std::uniform_int_distribution<int> size(1, 1024);
+
+    std::vector<Box> boxes;
+    for (int i = 0; i < count; i++) {
+        boxes.push_back({i, i + lifetime(gen), size(gen), i});
+    }
+    return boxes;
+}
+
+}  // namespace
+
+// range(0) boxes, range(1) the longest lifetime in execution steps
+static void BM_MemorySolver_Solve(benchmarks::State& state) {
+    auto boxes = makeBoxes(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+
+    while (state.KeepRunning()) {
+        InferenceEngine::MemorySolver solver(boxes);
+        benchmarks::DoNotOptimize(solver.solve());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MemorySolver_Solve)->Args({64, 4})->Args({512, 8})->Args({512, 64})->Args({4096, 16});
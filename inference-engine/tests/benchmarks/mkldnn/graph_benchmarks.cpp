@@ -0,0 +1,417 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark.hpp"
+
+#include <mkldnn_plugin/mkldnn_graph.h>
+#include <mkldnn_plugin/mkldnn_extension_mngr.h>
+
+#include <cpp/ie_cnn_net_reader.h>
+#include <ie_plugin_config.hpp>
+#include "xml_net_builder.hpp"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+/**
+ * @brief Synthetic FP32 IR built layer by layer, every layer takes the output of the previous one
+ */
+class SyntheticNet : testing::V2NetBuilder {
+    SizeVector _dims;
+    size_t _weightsSize = 0;
+
+    using Params = std::map<std::string, std::string>;
+
+    SyntheticNet& layer(const std::string& type, Params params, const SizeVector& out,
+                        const std::string& dataName = "data", size_t weights = 0, size_t biases = 0) {
+        addLayer(type, "FP32", &params, {{_dims}, {out}}, static_cast<int>(weights), static_cast<int>(biases), dataName);
+        _weightsSize = (std::max)(_weightsSize, weights + biases);
+        _dims = out;
+        return *this;
+    }
+
+public:
+    explicit SyntheticNet(const SizeVector& in)
+            : testing::V2NetBuilder(buildNetworkWithOneInput("Synthetic", in, "FP32")), _dims(in) {}
+
+    SyntheticNet& convolution(size_t oc, size_t kernel) {
+        Params params = {{"stride-x", "1"}, {"stride-y", "1"},
+                         {"pad-x", std::to_string(kernel / 2)}, {"pad-y", std::to_string(kernel / 2)},
+                         {"kernel-x", std::to_string(kernel)}, {"kernel-y", std::to_string(kernel)},
+                         {"output", std::to_string(oc)}, {"group", "1"}};
+        size_t weights = oc * _dims[1] * kernel * kernel * sizeof(float);
+        return layer("Convolution", params, {_dims[0], oc, _dims[2], _dims[3]}, "convolution_data",
+                     weights, oc * sizeof(float));
+    }
+
+    SyntheticNet& relu() {
+        return layer("ReLU", {{"negative_slope", "0"}}, _dims);
+    }
+
+    SyntheticNet& pooling(size_t kernel) {
+        Params params = {{"stride-x", std::to_string(kernel)}, {"stride-y", std::to_string(kernel)},
+                         {"pad-x", "0"}, {"pad-y", "0"},
+                         {"kernel-x", std::to_string(kernel)}, {"kernel-y", std::to_string(kernel)},
+                         {"pool-method", "max"}};
+        return layer("Pooling", params, {_dims[0], _dims[1], _dims[2] / kernel, _dims[3] / kernel}, "pooling_data");
+    }
+
+    SyntheticNet& fullyConnected(size_t oc) {
+        size_t weights = oc * _dims[1] * _dims[2] * _dims[3] * sizeof(float);
+        return layer("FullyConnected", {{"out-size", std::to_string(oc)}}, {_dims[0], oc}, "fc",
+                     weights, oc * sizeof(float));
+    }
+
+    SyntheticNet& softmax() {
+        return layer("SoftMax", {{"axis", "1"}}, _dims);
+    }
+
+    SyntheticNet& lrn() {
+        return layer("LRN", {{"local_size", "5"}, {"alpha", "0.0001"}, {"beta", "0.75"}, {"k", "1"},
+                             {"region", "across"}}, _dims, "lrn");
+    }
+
+    CNNNetwork network() {
+        std::string model = finish();
+
+        // all the layers read their weights from the offset 0
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {(std::max)(_weightsSize, sizeof(float))}));
+        weights->allocate();
+        auto data = weights->buffer().as<float*>();
+        for (size_t i = 0; i < weights->size() / sizeof(float); i++)
+            data[i] = 0.01f * static_cast<float>(i % 17) - 0.08f;
+
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        reader.SetWeights(weights);
+        return reader.getNetwork();
+    }
+};
+
+/**
+ * @brief Synthetic FP32 IR with branches, a layer takes the outputs of any earlier layers given by their ids
+ */
+class BranchedNet {
+    using Params = std::map<std::string, std::string>;
+
+    struct Layer {
+        std::string type;
+        std::string dataName;
+        Params params;
+        std::vector<size_t> inputs;
+        SizeVector out;
+        size_t weights;
+        size_t biases;
+    };
+    std::vector<Layer> _layers;
+
+    size_t layer(Layer l) {
+        _layers.push_back(std::move(l));
+        return _layers.size() - 1;
+    }
+
+    static void dims(std::ostringstream& xml, size_t port, const SizeVector& dims) {
+        xml << "<port id=\"" << port << "\">";
+        for (auto dim : dims)
+            xml << "<dim>" << dim << "</dim>";
+        xml << "</port>";
+    }
+
+public:
+    explicit BranchedNet(const SizeVector& in) {
+        layer({"Input", "", {}, {}, in, 0, 0});
+    }
+
+    const SizeVector& dimsOf(size_t id) const {
+        return _layers[id].out;
+    }
+
+    // convolution with the same spatial size followed by ReLU, returns the id of the ReLU
+    size_t convolution(size_t from, size_t oc, size_t kernel) {
+        const SizeVector& in = dimsOf(from);
+        Params params = {{"stride-x", "1"}, {"stride-y", "1"},
+                         {"pad-x", std::to_string(kernel / 2)}, {"pad-y", std::to_string(kernel / 2)},
+                         {"kernel-x", std::to_string(kernel)}, {"kernel-y", std::to_string(kernel)},
+                         {"output", std::to_string(oc)}, {"group", "1"}};
+        SizeVector out = {in[0], oc, in[2], in[3]};
+        size_t conv = layer({"Convolution", "convolution_data", params, {from}, out,
+                             oc * in[1] * kernel * kernel * sizeof(float), oc * sizeof(float)});
+        return layer({"ReLU", "data", {{"negative_slope", "0"}}, {conv}, out, 0, 0});
+    }
+
+    // max pooling, the 3x3 one with the stride 1 keeps the size as in the Inception modules
+    size_t pooling(size_t from, size_t kernel, size_t stride) {
+        const SizeVector& in = dimsOf(from);
+        const size_t pad = stride == 1 ? kernel / 2 : 0;
+        Params params = {{"stride-x", std::to_string(stride)}, {"stride-y", std::to_string(stride)},
+                         {"pad-x", std::to_string(pad)}, {"pad-y", std::to_string(pad)},
+                         {"kernel-x", std::to_string(kernel)}, {"kernel-y", std::to_string(kernel)},
+                         {"pool-method", "max"}, {"rounding-type", "floor"}};
+        return layer({"Pooling", "pooling_data", params, {from},
+                      {in[0], in[1], (in[2] + 2 * pad - kernel) / stride + 1, (in[3] + 2 * pad - kernel) / stride + 1},
+                      0, 0});
+    }
+
+    size_t concat(const std::vector<size_t>& from) {
+        SizeVector out = dimsOf(from[0]);
+        out[1] = 0;
+        for (auto id : from)
+            out[1] += dimsOf(id)[1];
+        return layer({"Concat", "concat_data", {{"axis", "1"}}, from, out, 0, 0});
+    }
+
+    CNNNetwork network() const {
+        std::ostringstream xml;
+        size_t weightsSize = sizeof(float);
+        xml << "<net name=\"Branched\" version=\"2\" batch=\"1\"><layers>";
+        for (size_t id = 0; id < _layers.size(); id++) {
+            const Layer& l = _layers[id];
+            xml << "<layer name=\"" << l.type << id << "\" type=\"" << l.type << "\" precision=\"FP32\" id=\""
+                << id << "\">";
+            if (!l.params.empty()) {
+                xml << "<" << l.dataName;
+                for (auto& kv : l.params)
+                    xml << " " << kv.first << "=\"" << kv.second << "\"";
+                xml << "/>";
+            }
+            if (!l.inputs.empty()) {
+                xml << "<input>";
+                for (size_t i = 0; i < l.inputs.size(); i++)
+                    dims(xml, i, dimsOf(l.inputs[i]));
+                xml << "</input>";
+            }
+            xml << "<output>";
+            dims(xml, l.inputs.size(), l.out);
+            xml << "</output>";
+            // all the layers read their weights from the offset 0
+            if (l.weights) {
+                xml << "<weights offset=\"0\" size=\"" << l.weights << "\"/>"
+                    << "<biases offset=\"" << l.weights << "\" size=\"" << l.biases << "\"/>";
+                weightsSize = (std::max)(weightsSize, l.weights + l.biases);
+            }
+            xml << "</layer>";
+        }
+        xml << "</layers><edges>";
+        for (size_t id = 0; id < _layers.size(); id++) {
+            for (size_t i = 0; i < _layers[id].inputs.size(); i++) {
+                const size_t from = _layers[id].inputs[i];
+                xml << "<edge from-layer=\"" << from << "\" from-port=\"" << _layers[from].inputs.size()
+                    << "\" to-layer=\"" << id << "\" to-port=\"" << i << "\"/>";
+            }
+        }
+        xml << "</edges></net>";
+        std::string model = xml.str();
+
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {weightsSize}));
+        weights->allocate();
+        auto data = weights->buffer().as<float*>();
+        for (size_t i = 0; i < weights->size() / sizeof(float); i++)
+            data[i] = 0.01f * static_cast<float>(i % 17) - 0.08f;
+
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        reader.SetWeights(weights);
+        return reader.getNetwork();
+    }
+};
+
+// Two GoogLeNet inception modules (3a and 3b) on the batch x 192 x 28 x 28 input
+CNNNetwork inceptionNetwork(size_t batch) {
+    BranchedNet net({batch, 192, 28, 28});
+    size_t input = 0;
+    const size_t modules[2][6] = {{64, 96, 128, 16, 32, 32}, {128, 128, 192, 32, 96, 64}};
+    for (auto& m : modules) {
+        size_t b1 = net.convolution(input, m[0], 1);
+        size_t b2 = net.convolution(net.convolution(input, m[1], 1), m[2], 3);
+        size_t b3 = net.convolution(net.convolution(input, m[3], 1), m[4], 5);
+        size_t b4 = net.convolution(net.pooling(input, 3, 1), m[5], 1);
+        input = net.concat({b1, b2, b3, b4});
+    }
+    return net.network();
+}
+
+// SSD-like detection heads: a box and a class convolution 3x3 (4 boxes, 21 classes) on each of the 40 x 40 to
+// 5 x 5 feature maps of a small backbone, every head is an output of the network
+CNNNetwork ssdNetwork(size_t batch) {
+    BranchedNet net({batch, 64, 40, 40});
+    size_t features = net.convolution(0, 64, 3);
+    for (int map = 0; map < 4; map++) {
+        if (map)
+            features = net.convolution(net.pooling(features, 2, 2), 128, 3);
+        net.convolution(features, 4 * 4, 3);
+        net.convolution(features, 4 * 21, 3);
+    }
+    return net.network();
+}
+
+enum NodeKind { CONVOLUTION_1X1, CONVOLUTION_3X3, RELU, POOLING, FULLY_CONNECTED, SOFTMAX, LRN };
+
+const std::vector<std::pair<NodeKind, std::string>> nodeKinds = {
+        {CONVOLUTION_1X1, "Convolution1x1"}, {CONVOLUTION_3X3, "Convolution3x3"}, {RELU, "ReLU"},
+        {POOLING, "Pooling"}, {FULLY_CONNECTED, "FullyConnected"}, {SOFTMAX, "SoftMax"}, {LRN, "LRN"}};
+
+CNNNetwork singleLayerNetwork(NodeKind kind, const SizeVector& in) {
+    SyntheticNet net(in);
+    switch (kind) {
+        case CONVOLUTION_1X1: net.convolution(in[1], 1); break;
+        case CONVOLUTION_3X3: net.convolution(in[1], 3); break;
+        case RELU: net.relu(); break;
+        case POOLING: net.pooling(2); break;
+        case FULLY_CONNECTED: net.fullyConnected(1000); break;
+        case SOFTMAX: net.softmax(); break;
+        case LRN: net.lrn(); break;
+    }
+    return net.network();
+}
+
+SizeVector dimsOf(const benchmarks::State& state, size_t first) {
+    return {static_cast<size_t>(state.range(first)), static_cast<size_t>(state.range(first + 1)),
+            static_cast<size_t>(state.range(first + 2)), static_cast<size_t>(state.range(first + 3))};
+}
+
+}  // namespace
+
+// The graph of range(0) convolution 3x3 + ReLU pairs on the 1 x range(1) x range(2) x range(2) input
+static void BM_MKLDNNGraph_CreateGraph(benchmarks::State& state) {
+    SyntheticNet net({1, static_cast<size_t>(state.range(1)), static_cast<size_t>(state.range(2)),
+                      static_cast<size_t>(state.range(2))});
+    for (int64_t i = 0; i < state.range(0); i++)
+        net.convolution(static_cast<size_t>(state.range(1)), 3).relu();
+    auto network = net.network();
+    MKLDNNExtensionManager::Ptr extMgr;
+
+    while (state.KeepRunning()) {
+        MKLDNNGraph graph;
+        graph.CreateGraph(network, extMgr);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_MKLDNNGraph_CreateGraph)->Args({1, 16, 56})->Args({8, 64, 56})->Args({32, 64, 28})->Args({128, 32, 14});
+
+// A single layer of the kind on the range(0) x range(1) x range(2) x range(3) input, the label is the implementation
+// the plugin chose for it
+static void runNode(benchmarks::State& state, NodeKind kind) {
+    auto dims = dimsOf(state, 0);
+    auto network = singleLayerNetwork(kind, dims);
+    MKLDNNExtensionManager::Ptr extMgr;
+    MKLDNNGraph graph;
+    graph.CreateGraph(network, extMgr);
+
+    auto input = make_shared_blob<float>({Precision::FP32, dims, NCHW});
+    input->allocate();
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = static_cast<float>(i % 23) - 11.f;
+    std::string inputName = network.getInputsInfo().begin()->first;
+
+    std::string label;
+    for (auto& node : graph.GetNodes()) {
+        if (node->getType() == Input || node->getType() == Output || node->getType() == Reorder)
+            continue;
+        label += (label.empty() ? "" : " ") + node->getPrimitiveDescriptorType();
+    }
+    state.SetLabel(label);
+
+    graph.PushInputData(inputName, input);
+    graph.Infer();
+    while (state.KeepRunning()) {
+        graph.PushInputData(inputName, input);
+        graph.Infer();
+    }
+    state.SetBytesProcessed(state.iterations() * input->byteSize());
+}
+
+static const bool nodeBenchmarks = [] {
+    for (auto& kind : nodeKinds) {
+        NodeKind k = kind.first;
+        auto benchmark = benchmarks::RegisterBenchmark("BM_MKLDNNNode_" + kind.second,
+                                                       [k](benchmarks::State& state) { runNode(state, k); });
+        if (k == FULLY_CONNECTED) {
+            // 1000 outputs on the pooled features of a classifier, the weights are 37 MB
+            benchmark->Args({1, 256, 6, 6})->Args({8, 256, 6, 6})->Args({32, 256, 6, 6});
+        } else {
+            benchmark->Args({1, 64, 56, 56})->Args({8, 64, 56, 56})->Args({1, 256, 14, 14});
+        }
+    }
+    return true;
+}();
+
+// Four convolution 3x3 + ReLU pairs on the range(0) x range(2) x 56 x 56 input run by micro-batches of range(1)
+// samples, 0 runs the whole batch at once
+static void BM_MKLDNNGraph_MicroBatch(benchmarks::State& state) {
+    const size_t channels = static_cast<size_t>(state.range(2));
+    SizeVector dims = {static_cast<size_t>(state.range(0)), channels, 56, 56};
+    SyntheticNet net(dims);
+    for (int i = 0; i < 4; i++)
+        net.convolution(channels, 3).relu();
+    auto network = net.network();
+    MKLDNNExtensionManager::Ptr extMgr;
+    MKLDNNGraph graph;
+    if (state.range(1))
+        graph.setProperty({{PluginConfigParams::KEY_CPU_MICRO_BATCH, std::to_string(state.range(1))}});
+    graph.CreateGraph(network, extMgr);
+
+    auto input = make_shared_blob<float>({Precision::FP32, dims, NCHW});
+    input->allocate();
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = static_cast<float>(i % 23) - 11.f;
+    std::string inputName = network.getInputsInfo().begin()->first;
+
+    graph.PushInputData(inputName, input);
+    graph.Infer();
+    while (state.KeepRunning()) {
+        graph.PushInputData(inputName, input);
+        graph.Infer();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// the activations of the larger batches exceed the last level cache, 24 channels are padded to the blocks
+BENCHMARK(BM_MKLDNNGraph_MicroBatch)
+    ->Args({8, 0, 64})->Args({8, 2, 64})
+    ->Args({64, 0, 64})->Args({64, 2, 64})->Args({64, 8, 64})
+    ->Args({128, 0, 64})->Args({128, 2, 64})->Args({128, 8, 64})
+    ->Args({128, 0, 24})->Args({128, 2, 24})->Args({128, 8, 24});
+
+// A branched network of range(0) samples run with KEY_CPU_PARALLEL_BRANCHES set to range(1)
+static void runBranched(benchmarks::State& state, CNNNetwork network) {
+    MKLDNNExtensionManager::Ptr extMgr;
+    MKLDNNGraph graph;
+    graph.setProperty({{PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                        state.range(1) ? PluginConfigParams::YES : PluginConfigParams::NO}});
+    graph.CreateGraph(network, extMgr);
+
+    auto inputInfo = *network.getInputsInfo().begin();
+    auto input = make_shared_blob<float>(inputInfo.second->getTensorDesc());
+    input->allocate();
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = static_cast<float>(i % 23) - 11.f;
+
+    graph.PushInputData(inputInfo.first, input);
+    graph.Infer();
+    while (state.KeepRunning()) {
+        graph.PushInputData(inputInfo.first, input);
+        graph.Infer();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_MKLDNNGraph_InceptionBranches(benchmarks::State& state) {
+    runBranched(state, inceptionNetwork(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_MKLDNNGraph_InceptionBranches)->Args({1, 0})->Args({1, 1})->Args({4, 0})->Args({4, 1});
+
+static void BM_MKLDNNGraph_SSDBranches(benchmarks::State& state) {
+    runBranched(state, ssdNetwork(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_MKLDNNGraph_SSDBranches)->Args({1, 0})->Args({1, 1})->Args({4, 0})->Args({4, 1});
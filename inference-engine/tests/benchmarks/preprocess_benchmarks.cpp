@@ -0,0 +1,157 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark.hpp"
+
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include <ie_preprocess_data.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace {
+
+Blob::Ptr makeBlob(Precision precision, Layout layout, const SizeVector& dims) {
+    auto blob = make_blob_with_precision(TensorDesc(precision, dims, layout));
+    blob->allocate();
+    auto data = blob->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < blob->byteSize(); i++)
+        data[i] = static_cast<uint8_t>(i * 7 % 251);
+    if (precision == Precision::FP32) {
+        auto values = blob->buffer().as<float*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            values[i] = static_cast<float>(i % 255);
+    }
+    return blob;
+}
+
+Precision precisionOf(int64_t arg) {
+    return arg == 0 ? Precision::U8 : Precision::FP32;
+}
+
+ResizeAlgorithm algorithmOf(int64_t arg) {
+    return arg == 0 ? RESIZE_BILINEAR : RESIZE_AREA;
+}
+
+}  // namespace
+
+// range(0) precision (0 U8, 1 FP32), range(1) channels, range(2) height, range(3) width
+static void BM_BlobCopy_NHWCToNCHW(benchmarks::State& state) {
+    SizeVector dims = {1, static_cast<size_t>(state.range(1)), static_cast<size_t>(state.range(2)),
+                       static_cast<size_t>(state.range(3))};
+    auto src = makeBlob(precisionOf(state.range(0)), NHWC, dims);
+    auto dst = makeBlob(precisionOf(state.range(0)), NCHW, dims);
+
+    while (state.KeepRunning()) {
+        blob_copy(src, dst);
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * src->byteSize());
+}
+BENCHMARK(BM_BlobCopy_NHWCToNCHW)
+    ->Args({0, 3, 224, 224})->Args({0, 3, 1080, 1920})->Args({0, 4, 224, 224})
+    ->Args({1, 3, 224, 224})->Args({1, 3, 1080, 1920});
+
+static void BM_BlobCopy_NCHWToNHWC(benchmarks::State& state) {
+    SizeVector dims = {1, static_cast<size_t>(state.range(1)), static_cast<size_t>(state.range(2)),
+                       static_cast<size_t>(state.range(3))};
+    auto src = makeBlob(precisionOf(state.range(0)), NCHW, dims);
+    auto dst = makeBlob(precisionOf(state.range(0)), NHWC, dims);
+
+    while (state.KeepRunning()) {
+        blob_copy(src, dst);
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * src->byteSize());
+}
+BENCHMARK(BM_BlobCopy_NCHWToNHWC)
+    ->Args({0, 3, 224, 224})->Args({0, 3, 1080, 1920})->Args({0, 4, 224, 224})
+    ->Args({1, 3, 224, 224})->Args({1, 3, 1080, 1920});
+
+// The resize without G-API (NCHW only)
+// range(0) precision, range(1) algorithm (0 bilinear, 1 area), range(2..3) source HxW, range(4..5) destination HxW
+static void BM_Resize(benchmarks::State& state) {
+    auto precision = precisionOf(state.range(0));
+    auto src = makeBlob(precision, NCHW, {1, 3, static_cast<size_t>(state.range(2)), static_cast<size_t>(state.range(3))});
+    auto dst = makeBlob(precision, NCHW, {1, 3, static_cast<size_t>(state.range(4)), static_cast<size_t>(state.range(5))});
+
+    while (state.KeepRunning()) {
+        Resize::resize(src, dst, algorithmOf(state.range(1)));
+    }
+    state.SetBytesProcessed(state.iterations() * (src->byteSize() + dst->byteSize()));
+}
+BENCHMARK(BM_Resize)
+    ->Args({0, 0, 1080, 1920, 224, 224})->Args({0, 1, 1080, 1920, 224, 224})->Args({0, 1, 112, 112, 224, 224})
+    ->Args({1, 0, 1080, 1920, 224, 224})->Args({1, 1, 1080, 1920, 224, 224})->Args({1, 0, 112, 112, 224, 224})
+    ->Args({1, 1, 112, 112, 224, 224});
+
+// The pre-processing of an infer request: G-API resize and layout conversion, falls back to the plain resize
+// when G-API is disabled with USE_GAPI=NO
+// range(0) precision, range(1) algorithm, range(2..3) source HxW (NHWC), range(4..5) destination HxW (NCHW)
+static void BM_Preprocess(benchmarks::State& state) {
+    auto precision = precisionOf(state.range(0));
+    auto src = makeBlob(precision, NHWC, {1, 3, static_cast<size_t>(state.range(2)), static_cast<size_t>(state.range(3))});
+    auto dst = makeBlob(precision, NCHW, {1, 3, static_cast<size_t>(state.range(4)), static_cast<size_t>(state.range(5))});
+
+    PreProcessData preprocess;
+    preprocess.setRoiBlob(src);
+    // the graph compilation is measured by BM_Preprocess_FirstCall
+    preprocess.execute(dst, algorithmOf(state.range(1)), false);
+
+    while (state.KeepRunning()) {
+        preprocess.execute(dst, algorithmOf(state.range(1)), false);
+    }
+    state.SetBytesProcessed(state.iterations() * (src->byteSize() + dst->byteSize()));
+}
+BENCHMARK(BM_Preprocess)
+    ->Args({0, 0, 1080, 1920, 224, 224})->Args({0, 1, 1080, 1920, 224, 224})->Args({0, 0, 112, 112, 224, 224})
+    ->Args({1, 0, 1080, 1920, 224, 224})->Args({1, 1, 1080, 1920, 224, 224});
+
+// The first pre-processing of a shape, including the compilation of the G-API graph
+static void BM_Preprocess_FirstCall(benchmarks::State& state) {
+    auto precision = precisionOf(state.range(0));
+    auto src = makeBlob(precision, NHWC, {1, 3, static_cast<size_t>(state.range(2)), static_cast<size_t>(state.range(3))});
+    auto dst = makeBlob(precision, NCHW, {1, 3, static_cast<size_t>(state.range(4)), static_cast<size_t>(state.range(5))});
+
+    while (state.KeepRunning()) {
+        PreProcessData preprocess;
+        preprocess.setRoiBlob(src);
+        preprocess.execute(dst, algorithmOf(state.range(1)), false);
+    }
+}
+BENCHMARK(BM_Preprocess_FirstCall)->Args({0, 0, 1080, 1920, 224, 224})->Args({1, 1, 1080, 1920, 224, 224});
+
+// The pre-processing of a tracked object, its region alternates between range(1) sizes around the 128 x 256 output,
+// the time is per frame
+// range(0) precision, range(1) number of region sizes
+static void BM_Preprocess_AlternatingShapes(benchmarks::State& state) {
+    auto precision = precisionOf(state.range(0));
+    const size_t shapes = static_cast<size_t>(state.range(1));
+    const size_t outH = 128, outW = 256, inH = 720, inW = 1280;
+    auto src = makeBlob(precision, NHWC, {1, 3, inH, inW});
+    auto dst = makeBlob(precision, NCHW, {1, 3, outH, outW});
+
+    std::vector<Blob::Ptr> regions;
+    for (size_t i = 0; i < shapes; i++) {
+        const size_t w = outW / 2 + i * outW / 3;
+        const size_t h = outH / 2 + i * outH / 3;
+        regions.push_back(make_shared_blob(src, ROI{0, i * 17 % (inW - w), i * 29 % (inH - h), w, h}));
+    }
+
+    PreProcessData preprocess;
+    // the first round compiles every shape
+    for (auto& region : regions) {
+        preprocess.setRoiBlob(region);
+        preprocess.execute(dst, RESIZE_BILINEAR, false);
+    }
+
+    size_t frame = 0;
+    while (state.KeepRunning()) {
+        preprocess.setRoiBlob(regions[frame++ % shapes]);
+        preprocess.execute(dst, RESIZE_BILINEAR, false);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Preprocess_AlternatingShapes)->Args({0, 1})->Args({0, 2})->Args({0, 5})->Args({1, 2})->Args({1, 5});
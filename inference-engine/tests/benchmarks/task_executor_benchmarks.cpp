@@ -0,0 +1,31 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark.hpp"
+
+#include <cpp_interfaces/ie_task.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace InferenceEngine;
+
+// range(0) tasks queued at once before waiting for all of them, 1 is a plain start-and-wait round trip
+static void BM_TaskExecutor_RoundTrip(benchmarks::State& state) {
+    TaskExecutor executor("benchmark");
+    std::vector<Task::Ptr> tasks;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        tasks.push_back(std::make_shared<Task>([] {}));
+    }
+
+    while (state.KeepRunning()) {
+        for (auto& task : tasks)
+            executor.startTask(task);
+        for (auto& task : tasks)
+            task->wait(-1);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TaskExecutor_RoundTrip)->Arg(1)->Arg(4)->Arg(32);
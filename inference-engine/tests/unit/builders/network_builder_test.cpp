@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <string.h>
+#include <chrono>
 #include <ie_builders.hpp>
 
 
@@ -14,6 +15,23 @@ using namespace InferenceEngine;
 
 class NetworkBuilderTest : public BuilderTestCommon {
 protected:
+    // Input -> blocks of two ReLU branches joined by Eltwise -> Output
+    static Builder::Network prepareSyntheticBuilder(size_t blocks) {
+        const Port port({1, 8});
+        Builder::Network builder("synthetic");
+        idx_t lastId = builder.addLayer(Builder::InputLayer("in").setPort(port));
+        for (size_t i = 0; i < blocks; i++) {
+            const std::string suffix = std::to_string(i);
+            idx_t leftId = builder.addLayer({{lastId}}, Builder::ReLULayer("left" + suffix).setPort(port));
+            idx_t rightId = builder.addLayer({{lastId}}, Builder::ReLULayer("right" + suffix).setPort(port));
+            lastId = builder.addLayer({{leftId}, {rightId}}, Builder::EltwiseLayer("sum" + suffix)
+                    .setInputPorts({port, port}).setOutputPort(port)
+                    .setEltwiseType(Builder::EltwiseLayer::EltwiseType::SUM));
+        }
+        builder.addLayer({{lastId}}, Builder::OutputLayer("out"));
+        return builder;
+    }
+
     std::vector<std::string> alexNetNames = {
             "in1",
             "mean",
@@ -925,3 +943,101 @@ TEST_F(NetworkBuilderTest, DocumentationExample) {
     // Build network without relu2
     InferenceEngine::INetwork::Ptr changedNetwork = graph.build();
 }
+
+TEST_F(NetworkBuilderTest, KeepsLayersAndConnectionsIndexedAfterChanges) {
+    Builder::Network builder("indexes");
+    idx_t inId = builder.addLayer(Builder::InputLayer("in").setPort(Port({1, 8})));
+    idx_t reluId = builder.addLayer({{inId}}, Builder::ReLULayer("relu"));
+    idx_t sameNameId = builder.addLayer({{inId}}, Builder::ReLULayer("relu"));
+    idx_t outId = builder.addLayer({{reluId}}, Builder::OutputLayer("out"));
+    ASSERT_EQ("relu_id" + std::to_string(sameNameId), builder.getLayer(sameNameId).getName());
+    ASSERT_EQ(2, builder.getLayerConnections(inId).size());
+
+    for (const auto& connection : builder.getLayerConnections(sameNameId))
+        builder.disconnect(connection);
+    builder.removeLayer(sameNameId);
+    ASSERT_EQ(1, builder.getLayerConnections(inId).size());
+    ASSERT_EQ(reluId, builder.getLayerConnections(inId)[0].to().layerId());
+    ASSERT_THROW(builder.getLayer(sameNameId), InferenceEngine::details::InferenceEngineException);
+    ASSERT_EQ("out", builder.getLayer(outId).getName());
+
+    // The freed id and name are given again
+    ASSERT_EQ(sameNameId, builder.addLayer(Builder::ReLULayer("relu_id" + std::to_string(sameNameId))));
+    ASSERT_EQ("relu_id" + std::to_string(sameNameId), builder.getLayer(sameNameId).getName());
+    builder.removeLayer(sameNameId);
+
+    // Layers added through getLayers() are found as well
+    builder.getLayers().push_back(Builder::Layer(100, Builder::ReLULayer("direct")));
+    ASSERT_EQ("direct", builder.getLayer(100).getName());
+    builder.getLayers().pop_back();
+
+    Builder::Network copy(builder);
+    builder.disconnect(builder.getLayerConnections(outId)[0]);
+    ASSERT_EQ(1, copy.getLayerConnections(outId).size());
+    ASSERT_NO_THROW(copy.build());
+}
+
+TEST_F(NetworkBuilderTest, KeepsNamesUniqueAfterRenames) {
+    Builder::Network builder("renames");
+    idx_t aId = builder.addLayer(Builder::ReLULayer("a"));
+
+    // Renamed through the layer given away, the index still has the old name
+    builder.getLayer(aId).setName("b");
+    idx_t bId = builder.addLayer(Builder::ReLULayer("b"));
+    ASSERT_EQ("b", builder.getLayer(aId).getName());
+    ASSERT_EQ("b_id" + std::to_string(bId), builder.getLayer(bId).getName());
+
+    // The old name is free again
+    idx_t newAId = builder.addLayer(Builder::ReLULayer("a"));
+    ASSERT_EQ("a", builder.getLayer(newAId).getName());
+
+    for (auto& layer : builder.getLayers()) {
+        if (layer.getId() == newAId)
+            layer.setName("c");
+    }
+    idx_t cId = builder.addLayer(Builder::ReLULayer("c"));
+    ASSERT_EQ("c_id" + std::to_string(cId), builder.getLayer(cId).getName());
+}
+
+TEST_F(NetworkBuilderTest, BuildsAndConvertsLargeSyntheticNetwork) {
+    const size_t blocks = 1000;
+    auto builder = prepareSyntheticBuilder(blocks);
+    ASSERT_EQ(3 * blocks + 2, builder.getLayers().size());
+
+    INetwork::Ptr network;
+    ASSERT_NO_THROW(network = builder.build());
+    ASSERT_EQ(3 * blocks + 2, network->size());
+
+    std::shared_ptr<ICNNNetwork> cnnNetwork;
+    ASSERT_NO_THROW(cnnNetwork = Builder::convertToICNNNetwork(network));
+    // Output layers are not converted
+    ASSERT_EQ(3 * blocks + 1, cnnNetwork->layerCount());
+
+    Builder::Network fromCNNNetwork(*cnnNetwork);
+    ASSERT_EQ(3 * blocks + 2, fromCNNNetwork.getLayers().size());
+    ASSERT_NO_THROW(fromCNNNetwork.build());
+}
+
+#ifdef ENABLE_STRESS_UNIT_TESTS
+// Every step is expected to grow linearly with the number of layers
+TEST_F(NetworkBuilderTest, reportScalingOfSyntheticNetworks) {
+    for (size_t blocks : {1000, 2000, 4000, 8000}) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto builder = prepareSyntheticBuilder(blocks);
+        auto created = std::chrono::high_resolution_clock::now();
+        INetwork::Ptr network = builder.build();
+        auto built = std::chrono::high_resolution_clock::now();
+        auto cnnNetwork = Builder::convertToICNNNetwork(network);
+        auto converted = std::chrono::high_resolution_clock::now();
+        Builder::Network fromCNNNetwork(*cnnNetwork);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        using ms = std::chrono::duration<double, std::milli>;
+        std::cout << "[ BUILDER ] " << builder.getLayers().size() << " layers: "
+                  << ms(created - start).count() << " ms add, "
+                  << ms(built - created).count() << " ms build, "
+                  << ms(converted - built).count() << " ms convert, "
+                  << ms(end - converted).count() << " ms from ICNNNetwork" << std::endl;
+    }
+}
+#endif
@@ -2,16 +2,21 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstddef>
+#include <fstream>
 #include <vector>
 #include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include <inference_engine/layer_transform.hpp>
 #include <gna_plugin/quantization/model_quantizer.hpp>
 #include "gna_plugin/quantization/layer_quantizer.hpp"
 #include "gna_matcher.hpp"
+#include "gna_mock_api.hpp"
 
 using namespace InferenceEngine;
 using namespace GNAPluginNS;
 using namespace GNATestIRs;
+using namespace ::testing;
 
 class GNAAOTTests : public GNATest {
  protected:
@@ -83,3 +88,156 @@ TEST_F(GNAAOTTests, CanConvertFromAOTtoSueModel) {
         .inNotCompactMode().withGNAConfig(GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE), "sue.dump").gna().dumpXNN().called();
 }
 
+
+TEST_F(GNAAOTTests, ExportedGraphIsAlignedForMapping) {
+
+    const std::string X = registerFileForRemove("unit_tests.bin");
+
+    export_network(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().as().gna().model().to(X);
+
+    std::ifstream is(X, std::ios_base::in | std::ios_base::binary);
+    auto header = GNAModelSerial::ReadHeader(is);
+
+    ASSERT_EQ(header.version.major, HEADER_MAJOR);
+    ASSERT_EQ(header.version.minor, HEADER_MINOR);
+    ASSERT_EQ(header.alignment, GNAModelSerial::graphAlignment);
+    ASSERT_NE(header.graphOffset, 0);
+    ASSERT_EQ(header.graphOffset % header.alignment, 0);
+    ASSERT_GT(header.rwSectionSize, 0);
+    ASSERT_LT(header.rwSectionSize, header.gnaMemSize);
+    ASSERT_NE(header.roChecksum, 0);
+}
+
+TEST_F(GNAAOTTests, AffineWith2AffineOutputs_canbe_imported_without_copy) {
+
+    const std::string X = registerFileForRemove("unit_tests.bin");
+
+    export_network(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().as().gna().model().to(X);
+
+    assert_that().onInferModel().importedFrom(X)
+        .inNotCompactMode().withGNAConfig(GNA_CONFIG_KEY(IMPORT_ZERO_COPY), CONFIG_VALUE(YES))
+        .gna().propagate_forward().called().once();
+}
+
+TEST_F(GNAAOTTests, AffineWith2AffineOutputs_canbe_imported_without_copy_verify_structure) {
+
+    auto & nnet_type = storage<intel_nnet_type_t>();
+
+    save_args().onInferModel(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().from().gna().propagate_forward().to(&nnet_type);
+
+    const std::string X = registerFileForRemove("unit_tests.bin");
+
+    export_network(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().as().gna().model().to(X);
+
+    assert_that().onInferModel().importedFrom(X)
+        .inNotCompactMode().withGNAConfig(GNA_CONFIG_KEY(IMPORT_ZERO_COPY), CONFIG_VALUE(YES))
+        .gna().propagate_forward().called_with().exact_nnet_structure(&nnet_type);
+}
+
+TEST_F(GNAAOTTests, CorruptedReadOnlySectionDetectedBeforeInfer) {
+
+    const std::string X = registerFileForRemove("unit_tests.bin");
+
+    export_network(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().as().gna().model().to(X);
+
+    ModelHeader header;
+    {
+        std::fstream file(X, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        header = GNAModelSerial::ReadHeader(file);
+        // last byte of graph belongs to RO section
+        file.seekg(header.graphOffset + header.gnaMemSize - 1);
+        auto last = static_cast<char>(file.get());
+        file.seekp(header.graphOffset + header.gnaMemSize - 1);
+        file.put(static_cast<char>(~last));
+    }
+
+    for (std::string zeroCopy : {CONFIG_VALUE(NO), CONFIG_VALUE(YES)}) {
+        GNAAllocatingApi mockApi;
+        EXPECT_CALL(mockApi, GNAPropagateForward(_, _, _, _, _, _)).Times(0);
+
+        GNAPlugin plugin({{GNA_CONFIG_KEY(IMPORT_ZERO_COPY), zeroCopy}});
+        plugin.ImportNetwork(X);
+
+        auto elements = header.input.elements_count / header.nGroup;
+        TBlob<float> input(Precision::FP32, NC, {elements, header.nGroup});
+        input.allocate();
+        BlobMap result;
+        ASSERT_ANY_THROW(plugin.QueueInference(input, result));
+    }
+}
+
+TEST_F(GNAAOTTests, ModelWithUnexpectedAlignmentIsRejected) {
+
+    const std::string X = registerFileForRemove("unit_tests.bin");
+
+    export_network(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().as().gna().model().to(X);
+
+    {
+        std::fstream file(X, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        auto header = GNAModelSerial::ReadHeader(file);
+        header.alignment = GNAModelSerial::graphAlignment / 2;
+        file.seekp(0);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+
+    std::ifstream is(X, std::ios_base::in | std::ios_base::binary);
+    ASSERT_ANY_THROW(GNAModelSerial::ReadHeader(is));
+}
+
+TEST_F(GNAAOTTests, ModelOfVersion_1_1_canbe_imported) {
+
+    auto & nnet_type = storage<intel_nnet_type_t>();
+
+    save_args().onInferModel(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().from().gna().propagate_forward().to(&nnet_type);
+
+    const std::string X = registerFileForRemove("unit_tests.bin");
+    const std::string Y = registerFileForRemove("unit_tests_1_1.bin");
+
+    export_network(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().as().gna().model().to(X);
+
+    // rewriting exported model in version 1.1 layout: short header, gna graph right after layers definition
+    {
+        std::ifstream is(X, std::ios_base::in | std::ios_base::binary);
+        auto header = GNAModelSerial::ReadHeader(is);
+        auto structureStart = is.tellg();
+
+        CPPWrapper<intel_nnet_type_t> nnet(header.layersCount);
+        nnet.obj.nGroup = header.nGroup;
+        GNAModelSerial::MemoryType mt;
+        std::vector<uint8_t> graph(header.gnaMemSize);
+        GNAModelSerial(&nnet.obj, mt).ImportStructure(graph.data(), graph.data(), header, is);
+        std::vector<char> structure(static_cast<size_t>(is.tellg() - structureStart));
+        is.seekg(structureStart);
+        is.read(structure.data(), structure.size());
+        is.seekg(header.graphOffset);
+        is.read(reinterpret_cast<char *>(graph.data()), graph.size());
+
+        ModelHeader old = header;
+        old.headerSize = offsetof(ModelHeader, alignment);
+        old.version.minor = 1;
+        std::ofstream os(Y, std::ios_base::out | std::ios_base::binary);
+        os.write(reinterpret_cast<const char *>(&old), old.headerSize);
+        os.write(structure.data(), structure.size());
+        os.write(reinterpret_cast<const char *>(graph.data()), graph.size());
+    }
+
+    {
+        std::ifstream is(Y, std::ios_base::in | std::ios_base::binary);
+        auto header = GNAModelSerial::ReadHeader(is);
+        ASSERT_EQ(1, header.version.minor);
+        ASSERT_EQ(1, header.alignment);
+        ASSERT_EQ(0, header.graphOffset);
+        ASSERT_EQ(0, header.roChecksum);
+    }
+
+    assert_that().onInferModel().importedFrom(Y)
+        .inNotCompactMode().gna().propagate_forward().called_with().exact_nnet_structure(&nnet_type);
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "gna_matcher.hpp"
+#include "gna_mock_api.hpp"
+#include "pwl.h"
+#include "gna_plugin/quantization/quantization.h"
+
+using namespace InferenceEngine;
+using namespace GNAPluginNS;
+using namespace GNATestIRs;
+using namespace ::testing;
+using namespace std;
+
+#ifdef ENABLE_STRESS_UNIT_TESTS
+using ModelFactory = std::string (*)();
+
+/**
+ * @brief measures GNA LoadNetwork time on speech-like test IRs, where quantization and PWL design dominate
+ */
+class GNALoadTimeTest : public ::testing::TestWithParam<std::pair<const char *, ModelFactory>> {
+ protected:
+    const size_t LOADS = 200;
+
+    double loadTimeMs(const std::string &model) {
+        CNNNetReader net_reader;
+        GNATest::readNetworkWithWeights(net_reader, model);
+        GNAAllocatingApi mockApi;
+
+        double total = 0;
+        for (size_t i = 0; i < LOADS; i++) {
+            // quantizer works on a copy of the network, so the same network is loaded every time
+            auto start = chrono::high_resolution_clock::now();
+            GNAPlugin plugin(std::map<std::string, std::string>{{GNA_CONFIG_KEY(SCALE_FACTOR), "1.0"}});
+            plugin.LoadNetwork(net_reader.getNetwork());
+            total += chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+        }
+        return total / LOADS;
+    }
+};
+
+TEST_P(GNALoadTimeTest, reportLoadNetworkTime) {
+    PwlDesignCacheClear();
+    double ms = 0;
+    ASSERT_NO_THROW_IE_EXCEPTION(ms = loadTimeMs(GetParam().second()));
+
+    // the numbers go to the XML report (--gtest_output=xml) instead of the console
+    auto stats = PwlDesignCacheStatistics();
+    RecordProperty("load_network_ms", std::to_string(ms));
+    RecordProperty("pwl_cache_hits", std::to_string(stats.hits));
+    RecordProperty("pwl_cache_misses", std::to_string(stats.misses));
+}
+
+INSTANTIATE_TEST_CASE_P(GNALayerTests, GNALoadTimeTest,
+    ::testing::Values(
+        std::make_pair("SigmoidActivationModel", &SigmoidActivationModel),
+        std::make_pair("TanhActivationModel", &TanhActivationModel),
+        std::make_pair("clampFollowedByTanhModel", &clampFollowedByTanhModel),
+        std::make_pair("affineToMemoryModel", &affineToMemoryModel),
+        std::make_pair("eltwiseWithMemoryAndActivationInputModel", &eltwiseWithMemoryAndActivationInputModel),
+        std::make_pair("AffineWith2AffineOutputsModel", &AffineWith2AffineOutputsModel)));
+
+/**
+ * @brief test IRs have tiny layers, so weights of an LSTM acoustic model gate are quantized directly
+ */
+TEST(GNAQuantizationStressTest, reportLstmGateQuantizationThroughput) {
+    const uint32_t num_rows = 4 * 1024;
+    const uint32_t num_columns = 1024 + 512;
+    std::vector<float> weights(num_rows * num_columns), biases(num_rows);
+    std::mt19937 gen(0);
+    std::normal_distribution<float> dist(0.0f, 0.1f);
+    for (auto &w : weights) w = dist(gen);
+    for (auto &b : biases) b = dist(gen);
+
+    std::vector<int16_t> weights16(weights.size());
+    std::vector<int32_t> biases16(num_rows);
+    std::vector<int8_t> weights8(weights.size());
+    std::vector<intel_compound_bias_t> biases8(num_rows);
+
+    const int iterations = 10;
+    double ms16 = 0, ms8 = 0;
+    for (int i = 0; i < iterations; i++) {
+        float weight_scale = 1.0f, output_scale = 1.0f;
+        auto start = chrono::high_resolution_clock::now();
+        QuantizeAffine16(weights.data(), biases.data(), weights16.data(), biases16.data(), 2048.0f,
+                         &weight_scale, &output_scale, num_rows, num_columns, num_rows, num_columns);
+        auto middle = chrono::high_resolution_clock::now();
+        weight_scale = 1.0f;
+        QuantizeAffine8(weights.data(), biases.data(), weights8.data(), biases8.data(), 2048.0f,
+                        &weight_scale, &output_scale, num_rows, num_columns, num_rows, num_columns);
+        auto end = chrono::high_resolution_clock::now();
+        ms16 += chrono::duration<double, milli>(middle - start).count();
+        ms8 += chrono::duration<double, milli>(end - middle).count();
+    }
+    double mb = weights.size() * sizeof(float) / (1024.0 * 1024.0);
+    RecordProperty("i16_ms", std::to_string(ms16 / iterations));
+    RecordProperty("i16_mb_per_s", std::to_string(mb * iterations * 1000 / ms16));
+    RecordProperty("i8_ms", std::to_string(ms8 / iterations));
+    RecordProperty("i8_mb_per_s", std::to_string(mb * iterations * 1000 / ms8));
+}
+#endif  // ENABLE_STRESS_UNIT_TESTS
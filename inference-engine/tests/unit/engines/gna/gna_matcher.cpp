@@ -26,32 +26,6 @@ using namespace InferenceEngine;
 using namespace GNAPluginNS;
 using namespace ::testing;
 
-class NullAllocator : public IAllocator {
- void * ptr = nullptr;
-public:
-    NullAllocator() {
-        ptr = malloc(1);
-    }
-    ~NullAllocator() {
-        free(ptr);
-    }
-    void * lock(void * handle, LockOp = LOCK_FOR_WRITE)  noexcept override {
-        return ptr;
-    }
-    void  unlock(void * handle) noexcept override {
-
-    }
-    void * alloc(size_t size) noexcept override {
-        return ptr;
-    }
-    virtual bool   free(void* handle) noexcept {
-        return true;
-    }
-    virtual void Release() noexcept {
-        delete this;
-    }
-};
-
 void GNAPropagateMatcher :: match() {
     try {
         // matching gna propagate forward call.
@@ -6,12 +6,14 @@
 #include <limits>
 #include <inference_engine/graph_tools.hpp>
 #include "gtest/gtest.h"
+#include "gmock/gmock.h"
 #include "inference_engine.hpp"
 #include "gna/gna_config.hpp"
 #include "gna_plugin.hpp"
 #include "gna-api.h"
 #include "test_irs.hpp"
 #include "dnn.h"
+#include "gna_mock_api.hpp"
 
 
 #define withConfig(key, value) withGNAConfig(GNA_CONFIG_KEY(key), value)
@@ -25,6 +27,35 @@ catch(...) {\
     FAIL() << "unknown exception";\
 }
 
+/**
+ * @brief allocator that fakes allocation of any size, used to read IR without actual weights
+ */
+class NullAllocator : public InferenceEngine::IAllocator {
+ void * ptr = nullptr;
+public:
+    NullAllocator() {
+        ptr = malloc(1);
+    }
+    ~NullAllocator() {
+        free(ptr);
+    }
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE)  noexcept override {
+        return ptr;
+    }
+    void  unlock(void * handle) noexcept override {
+
+    }
+    void * alloc(size_t size) noexcept override {
+        return ptr;
+    }
+    virtual bool   free(void* handle) noexcept {
+        return true;
+    }
+    virtual void Release() noexcept {
+        delete this;
+    }
+};
+
 /**
  * GNA unit tests environment
  */
@@ -487,4 +518,48 @@ class GNATest : public ::testing::Test, public GNATestConfigurability<GNATest>
     static void fillWeights(InferenceEngine::Blob::Ptr weights, float value = 1) {
         std::fill_n(weights->buffer().as<float*>(), weights->byteSize()/sizeof(float), value);
     }
+
+    /**
+     * @brief reads IR and sets weights of the size required by its layers, filled by fillWeights()
+     */
+    static void readNetworkWithWeights(InferenceEngine::CNNNetReader &net_reader, const std::string &model) {
+        using namespace InferenceEngine;
+        net_reader.ReadNetwork(model.data(), model.length());
+        net_reader.SetWeights(std::make_shared<TBlob<uint8_t>>(Precision::U8, C,
+            SizeVector({std::numeric_limits<uint32_t>::max()}), std::make_shared<NullAllocator>()));
+
+        size_t weightsSize = 0;
+        for (auto &layer : net_reader.getNetwork()) {
+            for (auto &&blob : {layer->blobs["weights"], layer->blobs["biases"]}) {
+                if (blob) weightsSize += blob->byteSize();
+            }
+        }
+        auto weights = make_shared_blob<uint8_t>(Precision::U8, C, {weightsSize});
+        weights->allocate();
+        fillWeights(weights);
+        net_reader.SetWeights(weights);
+        net_reader.getNetwork().setTargetDevice(TargetDevice::eGNA);
+    }
+};
+
+/**
+ * @brief GNA api mock for tests that only load or import networks: any call is allowed,
+ * GNAAlloc is served from the owned buffer and the device is always opened
+ */
+class GNAAllocatingApi : public ::testing::NiceMock<GNACppApi> {
+ public:
+    std::vector<uint8_t> data;
+
+    GNAAllocatingApi() {
+        using ::testing::_;
+        ON_CALL(*this, GNAAlloc(_, _, _)).WillByDefault(::testing::Invoke([this](
+            intel_gna_handle_t nGNADevice,
+            uint32_t sizeRequested,
+            uint32_t *sizeGranted) {
+            data.resize(sizeRequested);
+            *sizeGranted = sizeRequested;
+            return &data.front();
+        }));
+        ON_CALL(*this, GNADeviceOpenSetThreads(_, _)).WillByDefault(::testing::Return(1));
+    }
 };
@@ -0,0 +1,109 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "gna_matcher.hpp"
+#include "gna_mock_api.hpp"
+
+using namespace InferenceEngine;
+using namespace GNAPluginNS;
+using namespace GNATestIRs;
+using namespace ::testing;
+using namespace std;
+
+using ModelFactory = std::string (*)();
+
+/**
+ * @brief loads test IRs with and without intermediate buffers reuse and compares GNA RW memory footprint
+ */
+class GNAMemoryReuseOnIRsTest : public ::testing::TestWithParam<std::pair<const char *, ModelFactory>> {
+ protected:
+    size_t loadAndGetRWBytes(const std::string &model, bool compact) {
+        CNNNetReader net_reader;
+        GNATest::readNetworkWithWeights(net_reader, model);
+        GNAAllocatingApi mockApi;
+
+        GNAPlugin plugin(std::map<std::string, std::string>{
+            {GNA_CONFIG_KEY(COMPACT_MODE), compact ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)}});
+        plugin.LoadNetwork(net_reader.getNetwork());
+        return plugin.GetRWBytesUsed();
+    }
+};
+
+TEST_P(GNAMemoryReuseOnIRsTest, compactModeDecreasesRWBytes) {
+    auto model = GetParam().second();
+    size_t dedicated = 0, compact = 0;
+    ASSERT_NO_THROW_IE_EXCEPTION(dedicated = loadAndGetRWBytes(model, false));
+    ASSERT_NO_THROW_IE_EXCEPTION(compact = loadAndGetRWBytes(model, true));
+
+    ASSERT_LT(compact, dedicated);
+}
+
+TEST_F(GNAMemoryReuseOnIRsTest, compactModeKeepsMemoryStateDedicated) {
+    size_t dedicated = 0, compact = 0;
+    ASSERT_NO_THROW_IE_EXCEPTION(dedicated = loadAndGetRWBytes(affineToMemoryModel(), false));
+    ASSERT_NO_THROW_IE_EXCEPTION(compact = loadAndGetRWBytes(affineToMemoryModel(), true));
+
+    // affine output is stored into the state, so nothing is left to share
+    ASSERT_EQ(compact, dedicated);
+}
+
+INSTANTIATE_TEST_CASE_P(GNALayerTests, GNAMemoryReuseOnIRsTest,
+    ::testing::Values(
+        std::make_pair("AffineWith2AffineOutputsModel", &AffineWith2AffineOutputsModel),
+        std::make_pair("eltwiseSummModel", &eltwiseSummModel),
+        std::make_pair("eltwiseWithMemoryAndActivationInputModel", &eltwiseWithMemoryAndActivationInputModel),
+        std::make_pair("concatModel", &concatModel),
+        std::make_pair("doubleConcatModel", &doubleConcatModel),
+        std::make_pair("twoFCWithPaddingAfterSliceModel", &twoFCWithPaddingAfterSliceModel),
+        std::make_pair("clampFollowedByTanhModel", &clampFollowedByTanhModel),
+        std::make_pair("maxpoolAfterRelu", &maxpoolAfterRelu),
+        std::make_pair("cropWithOffsetModel", &cropWithOffsetModel),
+        std::make_pair("copyModel", &copyModel)));
+
+/**
+ * @brief runs the same IR with and without intermediate buffers reuse and matches identical outputs
+ */
+class GNAMemoryReuseInferTest : public GNATest {
+ protected:
+    void inferInBothModes(const std::string &model, std::vector<float> input, std::vector<float> expected) {
+        assert_that().onInferModel(model)
+            .inNotCompactMode().gna().propagate_forward().onCPU()
+            .called_with_input_and_expected_output(input, expected);
+        assert_that().onInferModel(model)
+            .withGNAConfig(GNA_CONFIG_KEY(COMPACT_MODE), CONFIG_VALUE(YES)).gna().propagate_forward().onCPU()
+            .called_with_input_and_expected_output(input, expected);
+    }
+};
+
+TEST_F(GNAMemoryReuseInferTest, SliceFollowedByFCAndEltwise) {
+    inferInBothModes(FCWithPaddingAfterSliceModel(), std::vector<float>(20, 1.0), std::vector<float>(8, 14.0));
+}
+
+TEST_F(GNAMemoryReuseInferTest, SliceFollowedBy2FCsAnd2Eltwises) {
+    inferInBothModes(twoFCWithPaddingAfterSliceModel(), std::vector<float>(20, 1.0), std::vector<float>(8, 27.0));
+}
+
+TEST_F(GNAMemoryReuseInferTest, Concat) {
+    inferInBothModes(concatModel(), std::vector<float>(20, 1.0), std::vector<float>(20, 121.0));
+}
+
+TEST_F(GNAMemoryReuseInferTest, DoubleConcat) {
+    inferInBothModes(doubleConcatModel(), std::vector<float>(40, 1.0), std::vector<float>(40, 141.0));
+}
+
+TEST_F(GNAMemoryReuseInferTest, CropWithOffsetAfterFC) {
+    std::vector<float> input(20, 0.0);
+    std::fill_n(input.begin(), 10, 1.0);
+    inferInBothModes(cropWithOffsetExtendedModel(), input, std::vector<float>(10, 111.0));
+}
+
+TEST_F(GNAMemoryReuseInferTest, Copy) {
+    std::vector<float> input(20, 0.0), expected(20, 11.0);
+    std::fill_n(input.begin(), 10, 1.0);
+    std::fill_n(expected.begin(), 10, 12.0);
+    inferInBothModes(copyModel(), input, expected);
+}
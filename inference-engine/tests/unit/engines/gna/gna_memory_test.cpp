@@ -437,4 +437,104 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+class GNAMemoryReuseTest : public GNAMemoryTest {
+ protected:
+    struct Component {
+        void *ptr_inputs = nullptr;
+        void *ptr_outputs = nullptr;
+    };
+    Component components[4];
+
+    void SetUp() override {
+        mem.setLifetimeResolver([this](const void *ptr) {
+            for (int i = 0; i != 4; i++) {
+                if (ptr == &components[i].ptr_inputs || ptr == &components[i].ptr_outputs) {
+                    return i;
+                }
+            }
+            return -1;
+        });
+    }
+
+    /**
+     * chain of 4 components each one reads output of previous one
+     */
+    void reserveChain(size_t len) {
+        for (int i = 0; i != 4; i++) {
+            mem.reserve_ptr(&components[i].ptr_outputs, len);
+            if (i != 0) {
+                mem.bind_ptr(&components[i].ptr_inputs, &components[i - 1].ptr_outputs);
+            }
+        }
+    }
+};
+
+TEST_F(GNAMemoryReuseTest, canReuseBuffersWithNonIntersectingLifetimes) {
+    reserveChain(64);
+    mem.commit();
+
+    // at most two buffers are alive at a time
+    ASSERT_EQ(mem.getRWBytes(), 2 * 64);
+    ASSERT_EQ(mem.getRWBytesUsedWithoutReuse(), 4 * 64);
+
+    ASSERT_EQ(components[0].ptr_outputs, components[2].ptr_outputs);
+    ASSERT_EQ(components[1].ptr_outputs, components[3].ptr_outputs);
+    ASSERT_NE(components[0].ptr_outputs, components[1].ptr_outputs);
+    ASSERT_EQ(components[1].ptr_inputs, components[0].ptr_outputs);
+}
+
+TEST_F(GNAMemoryReuseTest, doesNotReuseBufferBindedOutsideOfComponents) {
+    void *ptr_outputs_global = nullptr;
+
+    reserveChain(64);
+    mem.bind_ptr(&ptr_outputs_global, &components[1].ptr_outputs);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 3 * 64);
+    ASSERT_EQ(ptr_outputs_global, components[1].ptr_outputs);
+    ASSERT_NE(components[1].ptr_outputs, components[3].ptr_outputs);
+    ASSERT_NE(components[1].ptr_outputs, components[2].ptr_outputs);
+}
+
+TEST_F(GNAMemoryReuseTest, doesNotReuseStoredData) {
+    float input[16] = {1, 2, 3};
+    void *ptr_stored = nullptr;
+
+    mem.push_ptr(&components[0].ptr_inputs, input, sizeof(input));
+    reserveChain(64);
+    mem.bind_ptr(&ptr_stored, &components[0].ptr_inputs);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 2 * 64 + sizeof(input));
+    ASSERT_FLOAT_EQ(reinterpret_cast<float*>(components[0].ptr_inputs)[2], 3);
+}
+
+TEST_F(GNAMemoryReuseTest, sharedBuffersAreAlignedAndReadOnlyIsNotAffected) {
+    float weights[] = {1, 2, 3};
+    float *ptr_weights = nullptr;
+
+    mem.readonly().push_ptr(&ptr_weights, weights, sizeof(weights));
+    reserveChain(10);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 2 * 64);
+    ASSERT_EQ(mem.getTotalBytes(), 2 * 64 + sizeof(weights));
+    for (auto &component : components) {
+        ASSERT_EQ(0, (reinterpret_cast<uint8_t *>(component.ptr_outputs) -
+                      reinterpret_cast<uint8_t *>(mem.getBasePtr())) % 64);
+    }
+    ASSERT_EQ(reinterpret_cast<uint8_t *>(ptr_weights), reinterpret_cast<uint8_t *>(mem.getBasePtr()) + 2 * 64);
+    ASSERT_FLOAT_EQ(ptr_weights[2], 3);
+}
+
+TEST_F(GNAMemoryReuseTest, rwSizeIsStableWhenRequestedBeforeCommit) {
+    reserveChain(64);
+    auto rwBytes = mem.getRWBytes();
+    void *ptr_parallel = nullptr;
+    mem.reserve_ptr(&ptr_parallel, rwBytes);
+    mem.commit();
+
+    ASSERT_EQ(reinterpret_cast<uint8_t *>(ptr_parallel), reinterpret_cast<uint8_t *>(mem.getBasePtr()) + rwBytes);
+}
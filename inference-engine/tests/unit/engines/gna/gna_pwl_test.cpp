@@ -5,6 +5,7 @@
 #include <vector>
 #include <gtest/gtest.h>
 #include "gna_matcher.hpp"
+#include "pwl.h"
 
 class PWLAproximationTest : public GNATest {
  protected:
@@ -212,3 +213,40 @@ TEST_F(PWLAproximationTest, forClampOnUniformAlgoWithSegmentThresholdIsSuccess)
                                 .pwl_quantization_activation(DnnActivationType::kActKaldiLstmClipping)
                                 .pwl_quantization_segments_threshold(3);
 }
+
+TEST(PWLDesignCacheTest, sameActivationAndScaleFactorsReuseSegments) {
+    PwlDesignCacheClear();
+    std::vector<intel_pwl_segment_t> designed, cached, rescaled;
+
+    PwlDesignOpt16(DnnActivation::fromType(kActSigmoid), designed, 2048.0f, 4096.0f);
+    PwlDesignOpt16(DnnActivation::fromType(kActSigmoid), cached, 2048.0f, 4096.0f);
+    PwlDesignOpt16(DnnActivation::fromType(kActSigmoid), rescaled, 1024.0f, 4096.0f);
+
+    auto stats = PwlDesignCacheStatistics();
+    ASSERT_EQ(1, stats.hits);
+    ASSERT_EQ(2, stats.misses);
+
+    ASSERT_EQ(designed.size(), cached.size());
+    for (size_t i = 0; i < designed.size(); i++) {
+        ASSERT_EQ(designed[i].xBase, cached[i].xBase);
+        ASSERT_EQ(designed[i].yBase, cached[i].yBase);
+        ASSERT_EQ(designed[i].slope, cached[i].slope);
+    }
+    ASSERT_EQ(designed.size(), rescaled.size());
+    ASSERT_NE(designed[1].xBase, rescaled[1].xBase);
+}
+
+TEST(PWLDesignCacheTest, oldestDesignsAreEvictedWhenCacheIsFull) {
+    PwlDesignCacheClear();
+    std::vector<intel_pwl_segment_t> segments;
+    for (int i = 0; i < 1024; i++) {
+        PwlDesignOpt16(DnnActivation::fromType(kActRelu), segments, 1.0f + i, 1.0f);
+    }
+    // the first design is gone, the last one is still cached
+    PwlDesignOpt16(DnnActivation::fromType(kActRelu), segments, 1.0f, 1.0f);
+    PwlDesignOpt16(DnnActivation::fromType(kActRelu), segments, 1024.0f, 1.0f);
+
+    auto stats = PwlDesignCacheStatistics();
+    ASSERT_EQ(1025, stats.misses);
+    ASSERT_EQ(1, stats.hits);
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+#include "gna_plugin/quantization/quantization.h"
+
+class GNAQuantizationTest : public ::testing::Test {
+ protected:
+    const uint32_t num_rows = 5;
+    const uint32_t num_columns = 19;   // covers vector body and scalar tail
+    const uint32_t num_rows_padded = 8;
+    const uint32_t num_columns_padded = 24;
+
+    std::vector<float> weights;
+    std::vector<float> biases;
+
+    void SetUp() override {
+        for (uint32_t i = 0; i < num_rows * num_columns; i++) {
+            weights.push_back((i % 7 == 0 ? -1.0f : 1.0f) * (i % 11) / 10.0f);
+        }
+        for (uint32_t i = 0; i < num_rows; i++) {
+            biases.push_back(i - 2.0f);
+        }
+    }
+
+    static int16_t reference16(float w, float scale) {
+        float value = w * scale + ((w > 0) ? 0.5f : -0.5f);
+        if (value > 32767.0) return 32767;
+        if (value < -32768.0) return -32768;
+        return static_cast<int16_t>(value);
+    }
+};
+
+TEST_F(GNAQuantizationTest, quantizeAffine16MatchesScalarRoundingAndZeroesPadding) {
+    std::vector<int16_t> int_weights(num_rows_padded * num_columns_padded, 1);
+    std::vector<int32_t> int_biases(num_rows_padded, 1);
+    float weight_scale = 1.0f, output_scale = 1.0f;
+    quantization_stats_t stats = {};
+
+    QuantizeAffine16(weights.data(), biases.data(), int_weights.data(), int_biases.data(), 2.0f,
+                     &weight_scale, &output_scale, num_rows, num_columns, num_rows_padded, num_columns_padded, &stats);
+
+    ASSERT_FLOAT_EQ(weight_scale, MAX_VAL_2B_WEIGHT / 1.0f);
+    ASSERT_FLOAT_EQ(output_scale, 2.0f * weight_scale);
+    for (uint32_t row = 0; row < num_rows_padded; row++) {
+        for (uint32_t col = 0; col < num_columns_padded; col++) {
+            int16_t expected = (row < num_rows && col < num_columns) ?
+                               reference16(weights[row * num_columns + col], weight_scale) : 0;
+            ASSERT_EQ(expected, int_weights[row * num_columns_padded + col]) << "row " << row << ", col " << col;
+        }
+    }
+    for (uint32_t row = num_rows; row < num_rows_padded; row++) {
+        ASSERT_EQ(0, int_biases[row]);
+    }
+    ASSERT_EQ(num_rows * num_columns, stats.num_weights);
+    ASSERT_EQ(0, stats.num_weights_saturated);
+    ASSERT_EQ(0, stats.num_biases_saturated);
+}
+
+TEST_F(GNAQuantizationTest, fixedQuantizeAffine16CountsSaturations) {
+    std::vector<int16_t> int_weights(num_rows_padded * num_columns_padded);
+    std::vector<int32_t> int_biases(num_rows_padded);
+    float output_scale = 1.0f;
+    quantization_stats_t stats = {};
+
+    // every weight with magnitude of 0.5 and above does not fit int16
+    FixedQuantizeAffine16(weights.data(), biases.data(), int_weights.data(), int_biases.data(), 1.0f,
+                          65536.0f, &output_scale, num_rows, num_columns, num_rows_padded, num_columns_padded, &stats);
+
+    uint32_t expected_saturations = 0;
+    for (uint32_t row = 0; row < num_rows; row++) {
+        for (uint32_t col = 0; col < num_columns; col++) {
+            float w = weights[row * num_columns + col];
+            expected_saturations += (w >= 0.5f || w <= -0.5f) ? 1 : 0;
+            ASSERT_EQ(reference16(w, 65536.0f), int_weights[row * num_columns_padded + col]);
+        }
+    }
+    ASSERT_NE(0, expected_saturations);
+    ASSERT_EQ(expected_saturations, stats.num_weights_saturated);
+}
+
+TEST_F(GNAQuantizationTest, quantizeAffine8UsesPerRowMultiplier) {
+    std::vector<int8_t> int_weights(num_rows_padded * num_columns_padded, 1);
+    std::vector<intel_compound_bias_t> int_biases(num_rows_padded);
+    float weight_scale = 1.0f, output_scale = 1.0f;
+
+    QuantizeAffine8(weights.data(), biases.data(), int_weights.data(), int_biases.data(), 1.0f,
+                    &weight_scale, &output_scale, num_rows, num_columns, num_rows_padded, num_columns_padded);
+
+    ASSERT_TRUE(IntegrityCheckAffine8(weights.data(), biases.data(), int_weights.data(), int_biases.data(),
+                                      weight_scale, output_scale, num_rows, num_columns,
+                                      num_rows_padded, num_columns_padded));
+}
@@ -11,6 +11,7 @@
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include <extension/ext_list.hpp>
+#include <inference_engine/precision_utils.h>
 #include "tests_common.hpp"
 
 
@@ -693,3 +694,218 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::Values(
         gatherTF_test_params{ { 1, 5, 2, 2 }, in1,{ 1, 3, 2, 2 }, dict, 1,{ 2, 2, 2, 2 }, ref_in1_a0_d322 }));
 
+
+
+struct gather_embedding_test_params {
+    std::string dictPrecision;
+    size_t rows;
+    size_t embedding_size;
+    InferenceEngine::SizeVector in_dim;
+    std::string reduce;
+    bool withScales;
+    bool withShifts;
+    InferenceEngine::SizeVector out_dim;
+};
+
+class MKLDNNCPUExtGatherEmbeddingTests : public TestsCommon, public WithParamInterface<gather_embedding_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="Gather_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="InputText" type="Input" precision="I32" id="1">
+            <output>
+                <port id="1">
+                    _IIDX_
+                </port>
+            </output>
+        </layer>
+        <layer name="gather" id="2" type="Gather" precision="FP32">
+            <data embedding_size="_ES_" reduce="_RED_"/>
+            <input>
+                <port id="1">
+                    _IIDX_
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    _OUT_
+                </port>
+            </output>
+            <blobs>
+                <dictionary offset="0" size="_DS_" precision="_DP_"/>
+                _ROW_PARAMS_
+            </blobs>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    static size_t elementSize(const std::string& precision) {
+        if (precision == "FP32")
+            return sizeof(float);
+        if (precision == "FP16")
+            return sizeof(InferenceEngine::ie_fp16);
+        return sizeof(int8_t);
+    }
+
+    static size_t dictionaryBytes(gather_embedding_test_params p) {
+        //  Row parameters that follow the dictionary are kept aligned
+        return (p.rows * p.embedding_size * elementSize(p.dictPrecision) + 3) / 4 * 4;
+    }
+
+    std::string getModel(gather_embedding_test_params p) {
+        std::string model = model_t;
+        std::string inIdx;
+        std::string out;
+
+        for (auto& idx : p.in_dim) {
+            inIdx += "<dim>";
+            inIdx += std::to_string(idx) + "</dim>\n";
+        }
+
+        for (auto& dst : p.out_dim) {
+            out += "<dim>";
+            out += std::to_string(dst) + "</dim>\n";
+        }
+
+        std::string rowParams;
+        size_t offset = dictionaryBytes(p);
+        if (p.withScales) {
+            rowParams += "<scales offset=\"" + std::to_string(offset) + "\" size=\"" +
+                         std::to_string(p.rows * sizeof(float)) + "\" precision=\"FP32\"/>\n";
+            offset += p.rows * sizeof(float);
+        }
+        if (p.withShifts) {
+            rowParams += "<shifts offset=\"" + std::to_string(offset) + "\" size=\"" +
+                         std::to_string(p.rows * sizeof(float)) + "\" precision=\"FP32\"/>\n";
+        }
+
+        REPLACE_WITH_STR(model, "_IIDX_", inIdx);
+        REPLACE_WITH_STR(model, "_OUT_", out);
+        REPLACE_WITH_NUM(model, "_ES_", p.embedding_size);
+        REPLACE_WITH_STR(model, "_RED_", p.reduce);
+        REPLACE_WITH_NUM(model, "_DS_", p.rows * p.embedding_size * elementSize(p.dictPrecision));
+        REPLACE_WITH_STR(model, "_DP_", p.dictPrecision);
+        REPLACE_WITH_STR(model, "_ROW_PARAMS_", rowParams);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            gather_embedding_test_params p = ::testing::WithParamInterface<gather_embedding_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            //  Dictionary, then per-row scales and shifts
+            size_t dictElements = p.rows * p.embedding_size;
+            size_t weightsSize = dictionaryBytes(p) + (p.withScales + p.withShifts) * p.rows * sizeof(float);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights(new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {weightsSize}));
+            weights->allocate();
+            uint8_t* weightsData = weights->data();
+            std::vector<float> values(dictElements);
+            for (size_t i = 0; i < dictElements; i++) {
+                if (p.dictPrecision == "FP32") {
+                    values[i] = std::sin(static_cast<float>(i)) * 10.0f;
+                    reinterpret_cast<float*>(weightsData)[i] = values[i];
+                } else if (p.dictPrecision == "FP16") {
+                    InferenceEngine::ie_fp16 v = InferenceEngine::PrecisionUtils::f32tof16(std::sin(static_cast<float>(i)) * 10.0f);
+                    values[i] = InferenceEngine::PrecisionUtils::f16tof32(v);
+                    reinterpret_cast<InferenceEngine::ie_fp16*>(weightsData)[i] = v;
+                } else if (p.dictPrecision == "I8") {
+                    int8_t v = static_cast<int8_t>(static_cast<int>(i * 37 % 255) - 127);
+                    values[i] = v;
+                    reinterpret_cast<int8_t*>(weightsData)[i] = v;
+                } else {
+                    uint8_t v = static_cast<uint8_t>(i * 37 % 256);
+                    values[i] = v;
+                    weightsData[i] = v;
+                }
+            }
+            float* rowParams = reinterpret_cast<float*>(weightsData + dictionaryBytes(p));
+            std::vector<float> scales(p.rows, 1.0f);
+            std::vector<float> shifts(p.rows, 0.0f);
+            if (p.withScales) {
+                for (size_t r = 0; r < p.rows; r++)
+                    scales[r] = *rowParams++ = 0.01f * (r % 7 + 1);
+            }
+            if (p.withShifts) {
+                for (size_t r = 0; r < p.rows; r++)
+                    shifts[r] = *rowParams++ = -0.5f * (r % 5);
+            }
+            net_reader.SetWeights(weights);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // Input Indexes, out of range ones are clipped
+            InferenceEngine::Blob::Ptr srcIdx;
+            srcIdx = InferenceEngine::make_shared_blob<int32_t>({ InferenceEngine::Precision::I32, p.in_dim, InferenceEngine::TensorDesc::getLayoutByDims(p.in_dim) });
+            srcIdx->allocate();
+            int32_t* idxData = static_cast<int32_t*>(srcIdx->buffer());
+            for (size_t i = 0; i < srcIdx->size(); i++)
+                idxData[i] = static_cast<int32_t>((i * 7919) % (p.rows + 2)) - 1;
+
+            //  Output Data
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            //  Infer
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputText", srcIdx));
+            graph.Infer(srcs, outputBlobs);
+
+            //  Reference
+            size_t bagSize = p.reduce == "none" ? 1 : p.in_dim.back();
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            float* ref = dst_ref.data();
+            std::fill(ref, ref + dst_ref.size(), 0.0f);
+            for (size_t i = 0; i < srcIdx->size(); i++) {
+                int row = idxData[i];
+                clipping(&row, 0, p.rows);
+                float* dst = ref + (i / bagSize) * p.embedding_size;
+                for (size_t k = 0; k < p.embedding_size; k++) {
+                    float v = values[row * p.embedding_size + k] * scales[row] + shifts[row];
+                    dst[k] += p.reduce == "mean" ? v / bagSize : v;
+                }
+            }
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtGatherEmbeddingTests, TestsGather) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsGather, MKLDNNCPUExtGatherEmbeddingTests,
+        ::testing::Values(
+        gather_embedding_test_params{ "FP32", 100, 16, { 3, 5 }, "none", false, false, { 3, 5, 16 } },
+        gather_embedding_test_params{ "FP32", 100, 16, { 3, 5 }, "sum", false, false, { 3, 16 } },
+        gather_embedding_test_params{ "FP16", 1000, 33, { 64, 20 }, "none", false, false, { 64, 20, 33 } },
+        gather_embedding_test_params{ "FP16", 1000, 33, { 64, 20 }, "mean", true, false, { 64, 33 } },
+        gather_embedding_test_params{ "I8", 517, 64, { 128, 10 }, "none", true, false, { 128, 10, 64 } },
+        gather_embedding_test_params{ "I8", 517, 64, { 128, 10 }, "sum", true, false, { 128, 64 } },
+        gather_embedding_test_params{ "U8", 300, 7, { 1000 }, "none", true, true, { 1000, 7 } },
+        gather_embedding_test_params{ "U8", 300, 7, { 50, 20 }, "mean", true, true, { 50, 7 } }));
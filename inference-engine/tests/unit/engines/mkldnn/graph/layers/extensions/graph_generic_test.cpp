@@ -1360,16 +1360,12 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteNotInLineGRN) {
         <edge from-layer="2" from-port="4" to-layer="3" to-port="6"/>
     </edges>
 </net>)V0G0N";
-    InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
-    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
-
-    extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
-
     InferenceEngine::CNNNetReader net_reader;
     ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
 
+    // GRN is a plugin node, no extension is needed
     MKLDNNGraphTestClass graph;
-    graph.CreateGraph(net_reader.getNetwork(), extMgr);
+    graph.CreateGraph(net_reader.getNetwork());
 
     InferenceEngine::SizeVector dims_src = {1, 3, 2, 2};
 
@@ -1504,15 +1500,12 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteInLineGRN) {
     </edges>
 </net>)V0G0N";
 
-    InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
-    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
-    extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
-
     InferenceEngine::CNNNetReader net_reader;
     ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
 
+    // GRN is a plugin node, no extension is needed
     MKLDNNGraphTestClass graph;
-    graph.CreateGraph(net_reader.getNetwork(), extMgr);
+    graph.CreateGraph(net_reader.getNetwork());
 
     InferenceEngine::SizeVector dims_src = {1, 3, 2, 2};
 
@@ -278,12 +278,15 @@ protected:
                     }
                     ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
                     Xbyak::util::Cpu cpu;
-                    if (cpu.has(Xbyak::util::Cpu::tAVX512F)
+                    if ((cpu.has(Xbyak::util::Cpu::tAVX512F)
                             && cpu.has(Xbyak::util::Cpu::tAVX512BW)
                             && cpu.has(Xbyak::util::Cpu::tAVX512VL)
                             && cpu.has(Xbyak::util::Cpu::tAVX512DQ)
                             && !p.preferTypes.empty()
-                            && p.preferTypes[0] == MKLDNNPlugin::impl_desc_type::jit_avx512_winograd) {
+                            && p.preferTypes[0] == MKLDNNPlugin::impl_desc_type::jit_avx512_winograd)
+                        || (cpu.has(Xbyak::util::Cpu::tAVX2)
+                            && !p.preferTypes.empty()
+                            && p.preferTypes[0] == MKLDNNPlugin::impl_desc_type::jit_avx2_winograd)) {
                         isWino = true;
                         ASSERT_EQ(p.preferTypes[0], node->getSelectedPrimitiveDescriptor()->getImplementationType());
                     } else {
@@ -371,8 +374,15 @@ INSTANTIATE_TEST_CASE_P(
                 conv_test_params{{1, 4, 54, 96},
                                  {3, 3}, {1, 1}, {1, 1}, {0, 0}, 64, 1, "", 3, MKLDNNPlugin::impl_desc_type::ref_any,
                                  {MKLDNNPlugin::impl_desc_type::jit_avx512_winograd, MKLDNNPlugin::impl_desc_type::ref_any}},
+                // avx2 winograd: F(4x4, 3x3) with tails of tiles and F(2x2, 3x3)
+                conv_test_params{{1, 12, 27, 35},
+                                 {3, 3}, {1, 1}, {1, 1}, {1, 1}, 20, 1, "", 3, MKLDNNPlugin::impl_desc_type::ref_any,
+                                 {MKLDNNPlugin::impl_desc_type::jit_avx2_winograd, MKLDNNPlugin::impl_desc_type::ref_any}},
+                conv_test_params{{1, 8, 6, 6},
+                                 {3, 3}, {1, 1}, {1, 1}, {1, 1}, 16, 1, "", 3, MKLDNNPlugin::impl_desc_type::ref_any,
+                                 {MKLDNNPlugin::impl_desc_type::jit_avx2_winograd, MKLDNNPlugin::impl_desc_type::ref_any}},
                 // 5D
-        /*9*/   conv_test_params{{1, 3, 15, 20, 20},
+        /*11*/  conv_test_params{{1, 3, 15, 20, 20},
                                  {3, 3, 3}, {2, 2, 2}, {0, 0, 0}, {0, 0, 0}, 64, 1, "", 2, MKLDNNPlugin::impl_desc_type::ref_any,
                                  {MKLDNNPlugin::impl_desc_type::ref_any} },
                 conv_test_params{{1, 24, 15, 20, 20},
@@ -385,7 +395,7 @@ INSTANTIATE_TEST_CASE_P(
                                  {3, 3, 3}, {2, 2, 2}, {0, 0, 0}, {0, 0, 0}, 64, 1, "", 2, MKLDNNPlugin::impl_desc_type::jit },
                 conv_test_params{{1, 24, 15, 25, 20},
                                  {3, 3, 3}, {2, 2, 2}, {0, 0, 0}, {0, 0, 0}, 64, 1, "", 2, MKLDNNPlugin::impl_desc_type::jit },
-        /*14*/  conv_test_params{{1, 32, 15, 25, 20},
+        /*16*/  conv_test_params{{1, 32, 15, 25, 20},
                                  {3, 3, 3}, {2, 2, 2}, {0, 0, 0}, {0, 0, 0}, 64, 1, "", 2, MKLDNNPlugin::impl_desc_type::jit },
 #ifdef USE_MKL
                 conv_test_params{{1, 5, 15, 20, 20},
@@ -400,7 +410,7 @@ INSTANTIATE_TEST_CASE_P(
                 conv_test_params{{1, 4, 16, 16, 16},
                                  {3, 3, 3}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, 8, 1, "same_upper", 2, MKLDNNPlugin::impl_desc_type::gemm_blas },
 #endif
-        /*20*/  conv_test_params{{1, 16, 30, 30, 10},
+        /*22*/  conv_test_params{{1, 16, 30, 30, 10},
                                  {5, 5, 5}, {1, 1, 1}, {2, 2, 2}, {2, 2, 2}, 16, 1, "", 2, MKLDNNPlugin::impl_desc_type::jit },
                 conv_test_params{{1, 16, 30, 30, 10},
                                  {5, 5, 5}, {1, 1, 1}, {2, 2, 2}, {2, 2, 2}, 16, 1, "", 2, MKLDNNPlugin::impl_desc_type::ref_any,
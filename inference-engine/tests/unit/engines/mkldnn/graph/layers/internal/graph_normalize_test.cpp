@@ -0,0 +1,250 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+using namespace single_layer_tests;
+
+
+struct normalize_test_params {
+    // Formats: NCHW
+    vector<size_t> dims;
+
+    // "Normalize" or "GRN"
+    std::string type;
+    int across_spatial;
+    int channel_shared;
+    float eps;
+
+    size_t num_prim_desc;
+    bool isBlockedFormat;
+    int selectedType;
+
+    vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+template <typename data_t>
+void ref_normalize(const TBlob<data_t> &src, const data_t *scales, TBlob<data_t> &dst, normalize_test_params prm) {
+    const data_t *src_data = src.readOnly();
+    data_t *dst_data = dst.data();
+
+    size_t N = prm.dims[0];
+    size_t C = prm.dims[1];
+    size_t S = 1;
+    for (size_t i = 2; i < prm.dims.size(); i++)
+        S *= prm.dims[i];
+
+    bool across_spatial = prm.type == "Normalize" && prm.across_spatial;
+    for (size_t n = 0; n < N; n++) {
+        const data_t *src_n = src_data + n * C * S;
+        data_t *dst_n = dst_data + n * C * S;
+        if (across_spatial) {
+            double sum = prm.eps;
+            for (size_t i = 0; i < C * S; i++)
+                sum += src_n[i] * src_n[i];
+            double norm = 1.0 / std::sqrt(sum);
+            for (size_t c = 0; c < C; c++) {
+                double scale = scales ? scales[prm.channel_shared ? 0 : c] : 1.0;
+                for (size_t s = 0; s < S; s++)
+                    dst_n[c * S + s] = static_cast<data_t>(src_n[c * S + s] * norm * scale);
+            }
+        } else {
+            for (size_t s = 0; s < S; s++) {
+                double sum = prm.eps;
+                for (size_t c = 0; c < C; c++)
+                    sum += src_n[c * S + s] * src_n[c * S + s];
+                double norm = 1.0 / std::sqrt(sum);
+                for (size_t c = 0; c < C; c++) {
+                    double scale = scales ? scales[prm.channel_shared ? 0 : c] : 1.0;
+                    dst_n[c * S + s] = static_cast<data_t>(src_n[c * S + s] * norm * scale);
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNGraphNormalizeTests: public TestsCommon, public WithParamInterface<normalize_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="normalize" id="2" type="_LT_" precision="FP32">
+            <data _PARAMS_/>
+            _WEIGHTS_
+            <input>
+                <port id="3">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+)V0G0N";
+
+    std::string getModel(normalize_test_params p) {
+        std::string model = layers_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        std::string s_dims;
+        for (auto& dim : p.dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+
+        REPLACE_WITH_STR(model, "_LT_", p.type);
+        if (p.type == "GRN") {
+            REPLACE_WITH_STR(model, "_PARAMS_", "bias=\"" + std::to_string(p.eps) + "\"");
+            REPLACE_WITH_STR(model, "_WEIGHTS_", "");
+        } else {
+            REPLACE_WITH_STR(model, "_PARAMS_", "across_spatial=\"" + std::to_string(p.across_spatial) +
+                                                "\" channel_shared=\"" + std::to_string(p.channel_shared) +
+                                                "\" eps=\"" + std::to_string(p.eps) + "\"");
+            size_t weights_size = (p.channel_shared ? 1 : p.dims[1]) * sizeof(float);
+            REPLACE_WITH_STR(model, "_WEIGHTS_", "<weights offset=\"0\" size=\"" + std::to_string(weights_size) + "\"/>");
+        }
+
+        model = IRTemplateGenerator::getIRTemplate("Normalize_Only", p.dims, "FP32", model, edges_t);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            normalize_test_params p = ::testing::WithParamInterface<normalize_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            TBlob<uint8_t>::Ptr weights;
+            if (p.type == "Normalize") {
+                size_t weights_size = (p.channel_shared ? 1 : p.dims[1]) * sizeof(float);
+                weights = TBlob<uint8_t>::Ptr(new TBlob<uint8_t>(Precision::U8, C, {weights_size}));
+                weights->allocate();
+                fill_data_sine(weights->data().as<float*>(), weights->size() / sizeof(float), 1, 4, 0.3);
+                net_reader.SetWeights(weights);
+            }
+
+            // the layer is implemented by the cpu extension as well, but the native node has to be picked
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(make_FakeExtensions());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getName() == "normalize") {
+                    ASSERT_EQ(MKLDNNPlugin::Normalize, node->getType());
+                    ASSERT_EQ(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
+                        p.comp.at(j)(node->getSupportedPrimitiveDescriptors().at(j));
+                    }
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType,
+                              node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                }
+            }
+            if (p.isBlockedFormat)
+                ASSERT_EQ(6, nodes.size());
+            else
+                ASSERT_EQ(4, nodes.size());
+
+            Blob::Ptr src = make_shared_blob<float, const SizeVector>(Precision::FP32, NCHW, p.dims);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_normalize(*srcPtr, weights ? weights->readOnly().as<const float*>() : nullptr, dst_ref, p);
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphNormalizeTests, TestsNormalize) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNormalize, MKLDNNGraphNormalizeTests,
+        ::testing::Values(
+                normalize_test_params{{2, 64, 15, 15}, "Normalize", 0, 0, 0.0001f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 19, 33, 65}, "Normalize", 0, 1, 0.0001f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 64, 15, 15}, "Normalize", 1, 0, 0.0001f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 19, 33, 65}, "Normalize", 1, 1, 0.0001f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 64, 15, 15}, "Normalize", 0, 0, 0.0001f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 19, 33, 65}, "Normalize", 0, 1, 0.0001f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 64, 15, 15}, "Normalize", 1, 0, 0.0001f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 19, 33, 65}, "Normalize", 1, 1, 0.0001f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 512, 38, 38}, "Normalize", 0, 0, 0.0001f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 64, 15, 15}, "GRN", 0, 0, 1.0f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 17, 9}, "GRN", 0, 0, 0.5f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 64, 15, 15}, "GRN", 0, 0, 1.0f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 3, 17, 9}, "GRN", 0, 0, 0.5f, 3, true, MKLDNNPlugin::impl_desc_type::unknown }
+        ));
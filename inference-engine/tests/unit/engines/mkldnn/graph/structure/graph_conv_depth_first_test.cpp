@@ -0,0 +1,319 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/nodes/mkldnn_conv_node.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct depth_first_conv_params {
+    size_t krn;
+    size_t str;
+    size_t pad;
+    size_t out_c;
+    size_t grp_c;
+    bool relu;
+};
+
+struct depth_first_test_params {
+    InferenceEngine::SizeVector in;
+
+    // the first convolution makes the input of the chain of the others, it is summed with the output of
+    // the chain if with_sum
+    std::vector<depth_first_conv_params> convs;
+    bool with_sum;
+
+    // the cost model rejects the chain regardless of the cache size
+    bool never_depth_first;
+};
+
+static InferenceEngine::SizeVector conv_out_dims(const InferenceEngine::SizeVector &in, const depth_first_conv_params &prm) {
+    return {in[0], prm.out_c, (in[2] + 2 * prm.pad - prm.krn) / prm.str + 1, (in[3] + 2 * prm.pad - prm.krn) / prm.str + 1};
+}
+
+static size_t conv_weights_size(size_t in_c, const depth_first_conv_params &prm) {
+    return prm.krn * prm.krn * prm.out_c * in_c / prm.grp_c + prm.out_c;
+}
+
+static void ref_conv_batch(const std::vector<float> &src, const InferenceEngine::SizeVector &in, const float *weights,
+                           std::vector<float> &dst, const depth_first_conv_params &prm) {
+    const size_t K = prm.krn, G = prm.grp_c;
+    const size_t N = in[0], IC = in[1], IH = in[2], IW = in[3];
+    auto out = conv_out_dims(in, prm);
+    const size_t OC = out[1], OH = out[2], OW = out[3];
+    const float *bias = weights + K * K * OC * IC / G;
+
+    dst.assign(N * OC * OH * OW, 0.f);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t g = 0; g < G; g++) {
+            for (size_t oc = 0; oc < OC / G; oc++) {
+                for (size_t oh = 0; oh < OH; oh++) {
+                    for (size_t ow = 0; ow < OW; ow++) {
+                        float acc = bias[g * OC / G + oc];
+                        for (size_t ic = 0; ic < IC / G; ic++) {
+                            for (size_t kh = 0; kh < K; kh++) {
+                                for (size_t kw = 0; kw < K; kw++) {
+                                    int ih = static_cast<int>(oh * prm.str + kh) - static_cast<int>(prm.pad);
+                                    int iw = static_cast<int>(ow * prm.str + kw) - static_cast<int>(prm.pad);
+                                    if (ih < 0 || ih >= static_cast<int>(IH) || iw < 0 || iw >= static_cast<int>(IW))
+                                        continue;
+                                    acc += src[((n * IC + g * IC / G + ic) * IH + ih) * IW + iw] *
+                                           weights[(((g * OC / G + oc) * IC / G + ic) * K + kh) * K + kw];
+                                }
+                            }
+                        }
+                        if (prm.relu && acc < 0)
+                            acc = 0;
+                        dst[((n * OC + g * OC / G + oc) * OH + oh) * OW + ow] = acc;
+                    }
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNGraphConvDepthFirstTests: public TestsCommon,
+                                      public WithParamInterface<depth_first_test_params> {
+    std::string dims_to_str(const InferenceEngine::SizeVector& dims) {
+        std::string s_dims;
+        for (auto& dim : dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        return s_dims;
+    }
+
+    std::string getModel(depth_first_test_params p) {
+        std::string layers, edges;
+        auto dims = p.in;
+        int id = 1;
+        size_t offset = 0;
+
+        layers += R"V0G0N(
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">)V0G0N" + dims_to_str(dims) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+        int prev = 0;
+        int chain_input = 0;
+        for (size_t i = 0; i < p.convs.size(); i++) {
+            const auto &conv = p.convs[i];
+            auto out = conv_out_dims(dims, conv);
+            size_t w_size = conv.krn * conv.krn * conv.out_c * dims[1] / conv.grp_c * sizeof(float);
+            size_t b_size = conv.out_c * sizeof(float);
+
+            layers += R"V0G0N(
+        <layer name="conv)V0G0N" + std::to_string(i + 1) + R"V0G0N(" id=")V0G0N" + std::to_string(id) + R"V0G0N(" type="Convolution" precision="FP32">
+            <convolution stride-x="_S_" stride-y="_S_" pad-x="_P_" pad-y="_P_" kernel-x="_K_" kernel-y="_K_" output="_OC_" group="_G_"/>
+            <weights offset="_WO_" size="_WS_" />
+            <biases offset="_BO_" size="_BS_" />
+            <input>
+                <port id="0">)V0G0N" + dims_to_str(dims) + R"V0G0N(
+                </port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + dims_to_str(out) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+            REPLACE_WITH_NUM(layers, "_S_", conv.str);
+            REPLACE_WITH_NUM(layers, "_P_", conv.pad);
+            REPLACE_WITH_NUM(layers, "_K_", conv.krn);
+            REPLACE_WITH_NUM(layers, "_OC_", conv.out_c);
+            REPLACE_WITH_NUM(layers, "_G_", conv.grp_c);
+            REPLACE_WITH_NUM(layers, "_WO_", offset);
+            REPLACE_WITH_NUM(layers, "_WS_", w_size);
+            REPLACE_WITH_NUM(layers, "_BO_", offset + w_size);
+            REPLACE_WITH_NUM(layers, "_BS_", b_size);
+            offset += w_size + b_size;
+
+            edges += "\n        <edge from-layer=\"" + std::to_string(prev) + "\" from-port=\"" + std::to_string(prev ? 1 : 0) +
+                     "\" to-layer=\"" + std::to_string(id) + "\" to-port=\"0\"/>";
+            prev = id++;
+            if (i == 0)
+                chain_input = prev;
+
+            if (conv.relu) {
+                layers += R"V0G0N(
+        <layer name="relu)V0G0N" + std::to_string(i + 1) + R"V0G0N(" id=")V0G0N" + std::to_string(id) + R"V0G0N(" type="ReLU" precision="FP32">
+            <data negative_slope="0"/>
+            <input>
+                <port id="0">)V0G0N" + dims_to_str(out) + R"V0G0N(
+                </port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + dims_to_str(out) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+                edges += "\n        <edge from-layer=\"" + std::to_string(prev) + "\" from-port=\"1\" to-layer=\"" +
+                         std::to_string(id) + "\" to-port=\"0\"/>";
+                prev = id++;
+                if (i == 0)
+                    chain_input = prev;
+            }
+            dims = out;
+        }
+
+        if (p.with_sum) {
+            layers += R"V0G0N(
+        <layer name="sum" id=")V0G0N" + std::to_string(id) + R"V0G0N(" type="Eltwise" precision="FP32">
+            <data operation="sum"/>
+            <input>
+                <port id="0">)V0G0N" + dims_to_str(dims) + R"V0G0N(
+                </port>
+                <port id="1">)V0G0N" + dims_to_str(dims) + R"V0G0N(
+                </port>
+            </input>
+            <output>
+                <port id="2">)V0G0N" + dims_to_str(dims) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+            edges += "\n        <edge from-layer=\"" + std::to_string(prev) + "\" from-port=\"1\" to-layer=\"" +
+                     std::to_string(id) + "\" to-port=\"0\"/>";
+            edges += "\n        <edge from-layer=\"" + std::to_string(chain_input) + "\" from-port=\"1\" to-layer=\"" +
+                     std::to_string(id) + "\" to-port=\"1\"/>";
+        }
+
+        return R"V0G0N(
+<Net Name="Depth_First_Convolutions" version="2" precision="FP32" batch="1">
+    <layers>)V0G0N" + layers + R"V0G0N(
+    </layers>
+    <edges>)V0G0N" + edges + R"V0G0N(
+    </edges>
+</Net>
+)V0G0N";
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            depth_first_test_params p = ::testing::WithParamInterface<depth_first_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t weights_size = 0;
+            size_t in_c = p.in[1];
+            for (auto &conv : p.convs) {
+                weights_size += conv_weights_size(in_c, conv);
+                in_c = conv.out_c;
+            }
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {weights_size * sizeof(float)});
+            weights->allocate();
+            fill_data_sine((float *) weights->buffer(), weights_size, 0.f, 0.1f, 0.7f);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            // the cost model selects the chain when its intermediate tensors spill out of the L2 of the threads
+            size_t inter_bytes = 0;
+            auto dims = conv_out_dims(p.in, p.convs[0]);
+            for (size_t i = 1; i + 1 < p.convs.size(); i++) {
+                dims = conv_out_dims(dims, p.convs[i]);
+                inter_bytes += dims[0] * dims[1] * dims[2] * dims[3] * sizeof(float);
+            }
+            const size_t cache_size = static_cast<size_t>(mkldnn_get_cache_size(2, true)) * parallel_get_max_threads();
+            bool expect_depth_first = !p.never_depth_first && inter_bytes > 2 * cache_size;
+
+            size_t chained = 0;
+            for (auto &node : graph.getNodes()) {
+                auto *conv = dynamic_cast<MKLDNNPlugin::MKLDNNConvolutionNode *>(node.get());
+                if (conv && conv->getDepthFirstHead()) {
+                    ASSERT_EQ(MKLDNNPlugin::Type::Convolution_Activation, conv->getDepthFirstHead()->getType());
+                    chained++;
+                }
+            }
+            if (p.never_depth_first)
+                ASSERT_EQ(0, chained);
+            else if (expect_depth_first)
+                ASSERT_EQ(p.convs.size() - 2, chained);
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, p.in);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            std::vector<float> ref(src->buffer().as<float*>(), src->buffer().as<float*>() + src->size());
+            std::vector<float> next, chain_input;
+            const float *w = (const float *) weights->buffer();
+            dims = p.in;
+            for (auto &conv : p.convs) {
+                ref_conv_batch(ref, dims, w, next, conv);
+                w += conv_weights_size(dims[1], conv);
+                dims = conv_out_dims(dims, conv);
+                ref.swap(next);
+                if (chain_input.empty())
+                    chain_input = ref;
+            }
+            if (p.with_sum) {
+                for (size_t i = 0; i < ref.size(); i++)
+                    ref[i] += chain_input[i];
+            }
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            float *dst = dst_ref.data();
+            std::copy(ref.begin(), ref.end(), dst);
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphConvDepthFirstTests, TestsConvDepthFirst) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsConvDepthFirst, MKLDNNGraphConvDepthFirstTests,
+        ::testing::Values(
+                // MobileNetV2 inverted residual blocks
+                depth_first_test_params{{2, 32, 112, 112}, {{1, 1, 0, 32, 1, true}, {1, 1, 0, 144, 1, true},
+                                                            {3, 1, 1, 144, 144, true}, {1, 1, 0, 32, 1, false}}, true, false},
+                depth_first_test_params{{2, 16, 112, 112}, {{1, 1, 0, 16, 1, true}, {1, 1, 0, 96, 1, true},
+                                                            {3, 2, 1, 96, 96, true}, {1, 1, 0, 24, 1, false}}, false, false},
+                depth_first_test_params{{1, 32, 28, 28}, {{1, 1, 0, 32, 1, true}, {1, 1, 0, 192, 1, true},
+                                                          {3, 1, 1, 192, 192, true}, {1, 1, 0, 32, 1, false}}, true, false},
+                // dense 3x3 convolutions recompute too much of the halo
+                depth_first_test_params{{1, 64, 56, 56}, {{3, 1, 1, 64, 1, true}, {3, 1, 1, 64, 1, true},
+                                                          {3, 1, 1, 64, 1, true}, {3, 1, 1, 64, 1, true}}, false, true}
+        ));
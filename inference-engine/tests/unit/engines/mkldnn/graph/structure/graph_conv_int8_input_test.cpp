@@ -0,0 +1,358 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <cnn_network_int8_normalizer.hpp>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct conv_int8_input_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    size_t krn;
+    size_t pad;
+    size_t out_c;
+
+    // ScaleShift after the input, shifts are taken as zeros if false
+    bool withShifts;
+    // Precision of the input, U8 or I8
+    InferenceEngine::Precision precision;
+
+    // Whether the input is expected to go to the convolution as is
+    bool folded;
+};
+
+template <typename data_t>
+void ref_scaleshift_conv_relu(const data_t *src, const float *weights, InferenceEngine::TBlob<float> &dst,
+                              conv_int8_input_test_params& prm) {
+    size_t C = prm.in.c, IH = prm.in.h, IW = prm.in.w;
+    size_t OC = prm.out_c, K = prm.krn, P = prm.pad;
+    size_t OH = IH + 2 * P - K + 1, OW = IW + 2 * P - K + 1;
+
+    const float *ss_w = weights;
+    const float *ss_b = weights + C;
+    const float *conv_w = weights + 2 * C;
+    const float *conv_b = conv_w + OC * C * K * K;
+    float *dst_data = dst.data();
+
+    for (size_t n = 0; n < prm.in.n; n++) {
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t oh = 0; oh < OH; oh++) {
+                for (size_t ow = 0; ow < OW; ow++) {
+                    double acc = conv_b[oc];
+                    for (size_t ic = 0; ic < C; ic++) {
+                        for (size_t kh = 0; kh < K; kh++) {
+                            for (size_t kw = 0; kw < K; kw++) {
+                                ptrdiff_t ih = static_cast<ptrdiff_t>(oh + kh) - P;
+                                ptrdiff_t iw = static_cast<ptrdiff_t>(ow + kw) - P;
+                                if (ih < 0 || ih >= IH || iw < 0 || iw >= IW)
+                                    continue;
+                                double x = src[((n * C + ic) * IH + ih) * IW + iw] * ss_w[ic] +
+                                           (prm.withShifts ? ss_b[ic] : 0.0f);
+                                acc += x * conv_w[((oc * C + ic) * K + kh) * K + kw];
+                            }
+                        }
+                    }
+                    dst_data[((n * OC + oc) * OH + oh) * OW + ow] = static_cast<float>(acc > 0 ? acc : 0);
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNGraphConvInt8InputTests: public TestsCommon,
+                                     public WithParamInterface<conv_int8_input_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="ScaleShift_Convolution_ReLU" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scaleshift" id="1" type="ScaleShift" precision="FP32">
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="_S1_" />
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" id="2" type="Convolution" precision="FP32">
+            <convolution stride-x="1" stride-y="1" pad-x="_P_" pad-y="_P_" kernel-x="_K_" kernel-y="_K_"
+                         output="_OC_" group="1"/>
+            <weights offset="_S2_" size="_S3_" />
+            <biases offset="_S4_" size="_S5_" />
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" id="3" type="ReLU" precision="FP32">
+            <input>
+                <port id="5">
+                    <dim>_IN_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>_IN_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+    <statistics>
+        <layer>
+            <name>in1</name>
+            <min>_IMIN_</min>
+            <max>_IMAX_</max>
+        </layer>
+        <layer>
+            <name>scaleshift</name>
+            <min>_SMIN_</min>
+            <max>_SMAX_</max>
+        </layer>
+        <layer>
+            <name>conv</name>
+            <min>_CMIN_</min>
+            <max>_CMAX_</max>
+        </layer>
+        <layer>
+            <name>relu</name>
+            <min>_RMIN_</min>
+            <max>_CMAX_</max>
+        </layer>
+    </statistics>
+</Net>
+)V0G0N";
+
+    std::string getModel(conv_int8_input_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_K_", p.krn);
+        REPLACE_WITH_NUM(model, "_P_", p.pad);
+        REPLACE_WITH_NUM(model, "_OC_", p.out_c);
+        REPLACE_WITH_NUM(model, "_OH_", p.in.h + 2 * p.pad - p.krn + 1);
+        REPLACE_WITH_NUM(model, "_OW_", p.in.w + 2 * p.pad - p.krn + 1);
+
+        size_t ss_size = p.in.c * sizeof(float);
+        size_t w_size = p.out_c * p.in.c * p.krn * p.krn * sizeof(float);
+        REPLACE_WITH_NUM(model, "_S1_", ss_size);
+        REPLACE_WITH_NUM(model, "_S2_", 2 * ss_size);
+        REPLACE_WITH_NUM(model, "_S3_", w_size);
+        REPLACE_WITH_NUM(model, "_S4_", 2 * ss_size + w_size);
+        REPLACE_WITH_NUM(model, "_S5_", p.out_c * sizeof(float));
+
+        auto stats = [](size_t channels, float value) {
+            std::string s;
+            for (size_t c = 0; c < channels; c++)
+                s += (c ? ", " : "") + std::to_string(value);
+            return s;
+        };
+        bool isSigned = p.precision == InferenceEngine::Precision::I8;
+        REPLACE_WITH_STR(model, "_IMIN_", stats(p.in.c, isSigned ? -128.f : 0.f));
+        REPLACE_WITH_STR(model, "_IMAX_", stats(p.in.c, isSigned ? 127.f : 255.f));
+        REPLACE_WITH_STR(model, "_SMIN_", stats(p.in.c, -2.f));
+        REPLACE_WITH_STR(model, "_SMAX_", stats(p.in.c, 2.f));
+        REPLACE_WITH_STR(model, "_CMIN_", stats(p.out_c, -50.f));
+        REPLACE_WITH_STR(model, "_CMAX_", stats(p.out_c, 50.f));
+        REPLACE_WITH_STR(model, "_RMIN_", stats(p.out_c, 0.f));
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            conv_int8_input_test_params p = ::testing::WithParamInterface<conv_int8_input_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t weights_count = 2 * p.in.c + p.out_c * p.in.c * p.krn * p.krn + p.out_c;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {weights_count * sizeof(float)});
+            weights->allocate();
+            float *weights_data = (float *) weights->buffer();
+            fill_data_sine(weights_data, weights_count, -0.1, 0.1, 0.5);
+            // scales of the input, the shifts are [-1, 1] and folded only into unpadded convolutions
+            fill_data_sine(weights_data, p.in.c, 0.004, 0.01, 1);
+            fill_data_sine(weights_data + p.in.c, p.in.c, -1, 1, 1);
+            if (!p.withShifts)
+                std::fill(weights_data + p.in.c, weights_data + 2 * p.in.c, 0.0f);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+            network.getInputsInfo().begin()->second->setPrecision(p.precision);
+
+            InferenceEngine::ICNNNetworkStats* pstats = nullptr;
+            InferenceEngine::ICNNNetwork& inetwork = network;
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, inetwork.getStats(&pstats, nullptr));
+            InferenceEngine::details::CNNNetworkInt8Normalizer cnnorm;
+            cnnorm.NormalizeNetwork(inetwork, *pstats);
+
+            // the folded ScaleShift is removed from the network along with its output
+            InferenceEngine::CNNLayerPtr scaleShift;
+            ASSERT_EQ(p.folded ? InferenceEngine::StatusCode::NOT_FOUND : InferenceEngine::StatusCode::OK,
+                      inetwork.getLayerByName("scaleshift", scaleShift, nullptr));
+            // the graph drops the layers of its nodes after the creation, so the precision is checked here
+            InferenceEngine::CNNLayerPtr conv;
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, inetwork.getLayerByName("conv", conv, nullptr));
+            ASSERT_EQ(InferenceEngine::Precision::I8, conv->precision);
+            if (p.folded) {
+                auto inputData = network.getInputsInfo().begin()->second->getInputData();
+                ASSERT_EQ(1, inputData->getInputTo().size());
+                ASSERT_EQ("conv", inputData->getInputTo().begin()->first);
+            }
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(inetwork);
+
+            // With the folding the integer input goes to the convolution without any FP32 tensor in between
+            auto& nodes = graph.getNodes();
+            bool hasConv = false;
+            for (auto &node : nodes) {
+                if (p.folded && node->getType() == MKLDNNPlugin::Type::Input)
+                    ASSERT_EQ(p.precision, node->getChildEdgeAt(0)->getDesc().getPrecision());
+                if (node->getType() == MKLDNNPlugin::Type::Convolution_Activation ||
+                    node->getType() == MKLDNNPlugin::Type::Convolution) {
+                    hasConv = true;
+                    if (p.folded)
+                        ASSERT_EQ(p.precision, node->getParentEdgeAt(0)->getDesc().getPrecision());
+                }
+                if (p.folded)
+                    ASSERT_NE(MKLDNNPlugin::Type::Depthwise, node->getType());
+            }
+            ASSERT_TRUE(hasConv);
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+            InferenceEngine::Blob::Ptr src;
+            if (p.precision == InferenceEngine::Precision::U8) {
+                src = InferenceEngine::make_shared_blob<uint8_t, const InferenceEngine::SizeVector>(InferenceEngine::Precision::U8, InferenceEngine::NCHW, dims_src);
+                src->allocate();
+                uint8_t *src_data = src->buffer().as<uint8_t *>();
+                for (size_t i = 0; i < src->size(); i++)
+                    src_data[i] = static_cast<uint8_t>((i * 37) % 256);
+            } else {
+                src = InferenceEngine::make_shared_blob<int8_t, const InferenceEngine::SizeVector>(InferenceEngine::Precision::I8, InferenceEngine::NCHW, dims_src);
+                src->allocate();
+                int8_t *src_data = src->buffer().as<int8_t *>();
+                for (size_t i = 0; i < src->size(); i++)
+                    src_data[i] = static_cast<int8_t>((i * 37) % 256 - 128);
+            }
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = network.getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+
+            if (p.precision == InferenceEngine::Precision::U8)
+                ref_scaleshift_conv_relu(src->buffer().as<const uint8_t *>(), weights_data, dst_ref, p);
+            else
+                ref_scaleshift_conv_relu(src->buffer().as<const int8_t *>(), weights_data, dst_ref, p);
+
+            // The weights are quantized to 8 bits, so the outputs are compared relative to their range
+            const float *ref_data = dst_ref.readOnly();
+            const float *out_data = output->readOnly();
+            float max_ref = 0.0f;
+            for (size_t i = 0; i < dst_ref.size(); i++)
+                max_ref = std::max(max_ref, std::fabs(ref_data[i]));
+            for (size_t i = 0; i < dst_ref.size(); i++)
+                ASSERT_NEAR(ref_data[i], out_data[i], 0.03f * max_ref) << "at " << i;
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphConvInt8InputTests, TestsConvInt8Input) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsConvInt8Input, MKLDNNGraphConvInt8InputTests,
+        ::testing::Values(
+                conv_int8_input_test_params{{1, 3, 16, 16}, 3, 0, 16, true, InferenceEngine::Precision::U8, true},
+                conv_int8_input_test_params{{2, 3, 13, 17}, 3, 1, 32, false, InferenceEngine::Precision::U8, true},
+                conv_int8_input_test_params{{1, 4, 16, 16}, 1, 0, 16, true, InferenceEngine::Precision::I8, true},
+                // the shifts are not folded into a padded convolution
+                conv_int8_input_test_params{{1, 3, 16, 16}, 3, 1, 16, true, InferenceEngine::Precision::U8, false}
+        ));
@@ -0,0 +1,257 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct mvn_fusing_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    int across_channels;
+    bool isBroadcast;
+    float negative_slope;
+};
+
+template <typename data_t>
+void ref_mvn_scaleshift_relu(const InferenceEngine::TBlob<data_t> &src, const data_t *weights,
+                             InferenceEngine::TBlob<data_t> &dst, mvn_fusing_test_params& prm) {
+    size_t N = prm.in.n;
+    size_t C = prm.in.c;
+    size_t S = prm.in.h * prm.in.w;
+    const double eps = 1e-9;
+
+    const data_t *src_data = src.readOnly();
+    const data_t *scale_data = weights;
+    const data_t *shift_data = weights + (prm.isBroadcast ? 1 : C);
+    data_t *dst_data = dst.data();
+
+    for (size_t n = 0; n < N; n++) {
+        size_t groups = prm.across_channels ? 1 : C;
+        size_t group_size = prm.across_channels ? C * S : S;
+        for (size_t g = 0; g < groups; g++) {
+            const data_t *src_g = src_data + n * C * S + g * group_size;
+            data_t *dst_g = dst_data + n * C * S + g * group_size;
+
+            double mean = 0.0;
+            for (size_t i = 0; i < group_size; i++)
+                mean += src_g[i];
+            mean /= group_size;
+
+            double variance = 0.0;
+            for (size_t i = 0; i < group_size; i++)
+                variance += (src_g[i] - mean) * (src_g[i] - mean);
+            variance = std::sqrt(variance / group_size + eps);
+
+            for (size_t i = 0; i < group_size; i++) {
+                size_t c = prm.across_channels ? i / S : g;
+                size_t widx = prm.isBroadcast ? 0 : c;
+                double value = (src_g[i] - mean) / variance * scale_data[widx] + shift_data[widx];
+                dst_g[i] = static_cast<data_t>(value > 0 ? value : value * prm.negative_slope);
+            }
+        }
+    }
+}
+
+class MKLDNNGraphMVNFusingTests: public TestsCommon,
+                                 public WithParamInterface<mvn_fusing_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="MVN_ScaleShift_ReLU" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="mvn" id="1" type="MVN" precision="FP32">
+            <data across_channels="_AC_" normalize_variance="1" eps="1e-9"/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scaleshift" id="2" type="ScaleShift" precision="FP32">
+            <data broadcast="_BR_"/>
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="_S1_" />
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" id="3" type="ReLU" precision="FP32">
+            <data negative_slope="_NS_"/>
+            <input>
+                <port id="5">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(mvn_fusing_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_AC_", p.across_channels);
+        REPLACE_WITH_NUM(model, "_BR_", p.isBroadcast ? 1 : 0);
+        REPLACE_WITH_NUM(model, "_NS_", p.negative_slope);
+
+        size_t array_size = p.isBroadcast ? 1 : p.in.c;
+        REPLACE_WITH_NUM(model, "_S1_", array_size * sizeof(float));
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            mvn_fusing_test_params p = ::testing::WithParamInterface<mvn_fusing_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t array_size = p.isBroadcast ? 1 : p.in.c;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {2 * array_size * sizeof(float)});
+            weights->allocate();
+            fill_data_sine((float *) weights->buffer(), weights->size() / sizeof(float), -1, 1, 0.5);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            auto& nodes = graph.getNodes();
+            bool hasMVN = false;
+            for (auto &node : nodes) {
+                ASSERT_NE(MKLDNNPlugin::Type::Depthwise, node->getType());
+                ASSERT_NE(MKLDNNPlugin::Type::Activation, node->getType());
+                if (node->getType() == MKLDNNPlugin::Type::MVN) {
+                    hasMVN = true;
+                    ASSERT_EQ(2, node->getFusedWith().size());
+                }
+            }
+            ASSERT_TRUE(hasMVN);
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+
+            ref_mvn_scaleshift_relu(*srcPtr, (const float *)weights->buffer(), dst_ref, p);
+
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphMVNFusingTests, TestsMVNFusing) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsMVNFusing, MKLDNNGraphMVNFusingTests,
+        ::testing::Values(
+                mvn_fusing_test_params{{1, 16, 8, 8}, 0, false, 0.0f},
+                mvn_fusing_test_params{{2, 19, 7, 9}, 0, false, 0.1f},
+                mvn_fusing_test_params{{2, 19, 7, 9}, 0, true, 0.0f},
+                mvn_fusing_test_params{{1, 32, 5, 5}, 1, false, 0.0f},
+                mvn_fusing_test_params{{2, 3, 17, 13}, 1, true, 0.25f}
+        ));
@@ -0,0 +1,229 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct softmax_argmax_fusing_test_params {
+    InferenceEngine::SizeVector dims;
+
+    int axis;
+    int top_k;
+    int out_max_val;
+    bool has_axis;
+};
+
+static InferenceEngine::SizeVector argmax_out_dims(const softmax_argmax_fusing_test_params& prm) {
+    InferenceEngine::SizeVector out = prm.dims;
+    if (prm.has_axis) {
+        out[prm.axis] = prm.top_k;
+    } else {
+        std::fill(out.begin(), out.end(), 1);
+        out[0] = prm.dims[0];
+        out[1] = prm.out_max_val ? 2 : 1;
+        out[2] = prm.top_k;
+    }
+    return out;
+}
+
+// Softmax followed by the ArgMax extension
+template <typename data_t>
+void ref_softmax_argmax(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TBlob<data_t> &dst,
+                        softmax_argmax_fusing_test_params& prm) {
+    const data_t *src_data = src.readOnly();
+    data_t *dst_data = dst.data();
+
+    size_t outer = 1, inner = 1;
+    size_t C = prm.dims[prm.axis];
+    for (int i = 0; i < prm.axis; i++)
+        outer *= prm.dims[i];
+    for (size_t i = prm.axis + 1; i < prm.dims.size(); i++)
+        inner *= prm.dims[i];
+
+    for (size_t o = 0; o < outer; o++) {
+        for (size_t i = 0; i < inner; i++) {
+            const data_t *src_row = src_data + o * C * inner + i;
+            double max = src_row[0];
+            for (size_t c = 1; c < C; c++)
+                max = std::max(max, static_cast<double>(src_row[c * inner]));
+            double sum = 0.0;
+            for (size_t c = 0; c < C; c++)
+                sum += std::exp(src_row[c * inner] - max);
+
+            std::vector<std::pair<float, int>> probs(C);
+            for (size_t c = 0; c < C; c++)
+                probs[c] = std::make_pair(static_cast<float>(std::exp(src_row[c * inner] - max) / sum),
+                                          static_cast<int>(c));
+            std::partial_sort(probs.begin(), probs.begin() + prm.top_k, probs.end(),
+                              std::greater<std::pair<float, int>>());
+
+            for (int j = 0; j < prm.top_k; j++) {
+                if (!prm.has_axis && prm.out_max_val) {
+                    dst_data[2 * o * prm.top_k + j] = probs[j].second;
+                    dst_data[2 * o * prm.top_k + prm.top_k + j] = probs[j].first;
+                } else {
+                    dst_data[(o * prm.top_k + j) * inner + i] = prm.out_max_val ? probs[j].first : probs[j].second;
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNGraphSoftMaxArgMaxFusingTests: public TestsCommon,
+                                           public WithParamInterface<softmax_argmax_fusing_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="SoftMax_ArgMax" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">__SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="softmax" id="1" type="SoftMax" precision="FP32">
+            <data axis="_AX_"/>
+            <input>
+                <port id="1">__SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">__SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="argmax" id="2" type="ArgMax" precision="FP32">
+            <data _PARAMS_/>
+            <input>
+                <port id="3">__SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">__DST_DIMS__
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(softmax_argmax_fusing_test_params p) {
+        std::string model = model_t;
+
+        auto dims_to_str = [](const InferenceEngine::SizeVector& dims) {
+            std::string s_dims;
+            for (auto& dim : dims) {
+                s_dims += "\n                    <dim>";
+                s_dims += std::to_string(dim) + "</dim>";
+            }
+            return s_dims;
+        };
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", dims_to_str(p.dims));
+        REPLACE_WITH_STR(model, "__DST_DIMS__", dims_to_str(argmax_out_dims(p)));
+        REPLACE_WITH_NUM(model, "_AX_", p.axis);
+
+        std::string params = "top_k=\"" + std::to_string(p.top_k) + "\" out_max_val=\"" + std::to_string(p.out_max_val) + "\"";
+        if (p.has_axis)
+            params += " axis=\"" + std::to_string(p.axis) + "\"";
+        REPLACE_WITH_STR(model, "_PARAMS_", params);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            softmax_argmax_fusing_test_params p = ::testing::WithParamInterface<softmax_argmax_fusing_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            bool hasSoftMax = false;
+            for (auto &node : nodes) {
+                ASSERT_NE(MKLDNNPlugin::Type::Generic, node->getType());
+                if (node->getType() == MKLDNNPlugin::Type::SoftMax) {
+                    hasSoftMax = true;
+                    ASSERT_EQ(1, node->getFusedWith().size());
+                }
+            }
+            ASSERT_TRUE(hasSoftMax);
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+                    InferenceEngine::Precision::FP32, InferenceEngine::NCHW, p.dims);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+
+            ref_softmax_argmax(*srcPtr, dst_ref, p);
+
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphSoftMaxArgMaxFusingTests, TestsSoftMaxArgMaxFusing) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsSoftMaxArgMaxFusing, MKLDNNGraphSoftMaxArgMaxFusingTests,
+        ::testing::Values(
+                softmax_argmax_fusing_test_params{{2, 1000, 1, 1}, 1, 1, 0, false},
+                softmax_argmax_fusing_test_params{{2, 1000, 1, 1}, 1, 5, 1, false},
+                softmax_argmax_fusing_test_params{{2, 1000, 1, 1}, 1, 5, 0, true},
+                softmax_argmax_fusing_test_params{{1, 21, 32, 32}, 1, 1, 0, true},
+                softmax_argmax_fusing_test_params{{2, 19, 7, 9}, 1, 3, 1, true},
+                softmax_argmax_fusing_test_params{{2, 3, 10, 81}, 3, 2, 0, true}
+        ));
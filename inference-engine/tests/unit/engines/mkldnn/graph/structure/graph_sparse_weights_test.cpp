@@ -0,0 +1,250 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_sparse_weights.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct sparse_weights_test_params {
+    InferenceEngine::SizeVector in;
+    size_t conv_oc;
+    size_t fc_oc;
+
+    // the output of the second 1x1 convolution is summed with the first one
+    bool with_sum;
+
+    // the share of the kept blocks of 16 output channels of the weights
+    float density;
+    bool expect_sparse;
+};
+
+class MKLDNNGraphSparseWeightsTests: public TestsCommon,
+                                     public WithParamInterface<sparse_weights_test_params> {
+    std::string dims_to_str(const InferenceEngine::SizeVector& dims) {
+        std::string s_dims;
+        for (auto& dim : dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        return s_dims;
+    }
+
+    std::string conv_layer(const std::string& name, int id, const InferenceEngine::SizeVector& in,
+                           const InferenceEngine::SizeVector& out, size_t& offset) {
+        size_t w_size = in[1] * out[1] * sizeof(float);
+        size_t b_size = out[1] * sizeof(float);
+        std::string layer = R"V0G0N(
+        <layer name=")V0G0N" + name + R"V0G0N(" id=")V0G0N" + std::to_string(id) + R"V0G0N(" type="Convolution" precision="FP32">
+            <convolution stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output=")V0G0N" + std::to_string(out[1]) + R"V0G0N(" group="1"/>
+            <weights offset=")V0G0N" + std::to_string(offset) + R"V0G0N(" size=")V0G0N" + std::to_string(w_size) + R"V0G0N(" />
+            <biases offset=")V0G0N" + std::to_string(offset + w_size) + R"V0G0N(" size=")V0G0N" + std::to_string(b_size) + R"V0G0N(" />
+            <input>
+                <port id="0">)V0G0N" + dims_to_str(in) + R"V0G0N(
+                </port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + dims_to_str(out) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+        offset += w_size + b_size;
+        return layer;
+    }
+
+protected:
+    std::string getModel(sparse_weights_test_params p, size_t &weights_size) {
+        InferenceEngine::SizeVector conv_out = {p.in[0], p.conv_oc, p.in[2], p.in[3]};
+        InferenceEngine::SizeVector fc_out = {p.in[0], p.fc_oc};
+        size_t offset = 0;
+        std::string layers, edges;
+
+        layers += R"V0G0N(
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">)V0G0N" + dims_to_str(p.in) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+        layers += conv_layer("conv1", 1, p.in, conv_out, offset);
+        edges += "\n        <edge from-layer=\"0\" from-port=\"0\" to-layer=\"1\" to-port=\"0\"/>";
+        int prev = 1;
+
+        if (p.with_sum) {
+            layers += conv_layer("conv2", 2, p.in, conv_out, offset);
+            layers += R"V0G0N(
+        <layer name="sum" id="3" type="Eltwise" precision="FP32">
+            <data operation="sum"/>
+            <input>
+                <port id="0">)V0G0N" + dims_to_str(conv_out) + R"V0G0N(
+                </port>
+                <port id="1">)V0G0N" + dims_to_str(conv_out) + R"V0G0N(
+                </port>
+            </input>
+            <output>
+                <port id="2">)V0G0N" + dims_to_str(conv_out) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+            edges += "\n        <edge from-layer=\"0\" from-port=\"0\" to-layer=\"2\" to-port=\"0\"/>";
+            edges += "\n        <edge from-layer=\"2\" from-port=\"1\" to-layer=\"3\" to-port=\"0\"/>";
+            edges += "\n        <edge from-layer=\"1\" from-port=\"1\" to-layer=\"3\" to-port=\"1\"/>";
+            prev = 3;
+        }
+
+        size_t fc_w_size = p.fc_oc * p.conv_oc * p.in[2] * p.in[3] * sizeof(float);
+        layers += R"V0G0N(
+        <layer name="relu" id="4" type="ReLU" precision="FP32">
+            <input>
+                <port id="0">)V0G0N" + dims_to_str(conv_out) + R"V0G0N(
+                </port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + dims_to_str(conv_out) + R"V0G0N(
+                </port>
+            </output>
+        </layer>
+        <layer name="fc" id="5" type="FullyConnected" precision="FP32">
+            <fc out-size=")V0G0N" + std::to_string(p.fc_oc) + R"V0G0N("/>
+            <weights offset=")V0G0N" + std::to_string(offset) + R"V0G0N(" size=")V0G0N" + std::to_string(fc_w_size) + R"V0G0N(" />
+            <biases offset=")V0G0N" + std::to_string(offset + fc_w_size) + R"V0G0N(" size=")V0G0N" + std::to_string(p.fc_oc * sizeof(float)) + R"V0G0N(" />
+            <input>
+                <port id="0">)V0G0N" + dims_to_str(conv_out) + R"V0G0N(
+                </port>
+            </input>
+            <output>
+                <port id="1">)V0G0N" + dims_to_str(fc_out) + R"V0G0N(
+                </port>
+            </output>
+        </layer>)V0G0N";
+        offset += fc_w_size + p.fc_oc * sizeof(float);
+        edges += "\n        <edge from-layer=\"" + std::to_string(prev) + "\" from-port=\"" + std::to_string(p.with_sum ? 2 : 1) +
+                 "\" to-layer=\"4\" to-port=\"0\"/>";
+        edges += "\n        <edge from-layer=\"4\" from-port=\"1\" to-layer=\"5\" to-port=\"0\"/>";
+
+        weights_size = offset;
+        return R"V0G0N(
+<Net Name="Sparse_Weights" version="2" precision="FP32" batch="1">
+    <layers>)V0G0N" + layers + R"V0G0N(
+    </layers>
+    <edges>)V0G0N" + edges + R"V0G0N(
+    </edges>
+</Net>
+)V0G0N";
+    }
+
+    // zeroes whole blocks of 16 output channels in a column of the weights, so the blocks of the kernel are empty
+    void prune(float *weights, size_t oc, size_t ic, float density) {
+        for (size_t ob = 0; ob < (oc + 15) / 16; ob++) {
+            for (size_t i = 0; i < ic; i++) {
+                if ((ob * 7 + i * 13) % 100 < density * 100)
+                    continue;
+                for (size_t o = ob * 16; o < std::min(oc, ob * 16 + 16); o++)
+                    weights[o * ic + i] = 0.f;
+            }
+        }
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            sparse_weights_test_params p = ::testing::WithParamInterface<sparse_weights_test_params>::GetParam();
+            size_t weights_size = 0;
+            std::string model = getModel(p, weights_size);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {weights_size});
+            weights->allocate();
+            float *data = (float *) weights->buffer();
+            fill_data_sine(data, weights_size / sizeof(float), 0.f, 0.1f, 0.7f);
+            size_t conv_ic = p.in[1], fc_ic = p.conv_oc * p.in[2] * p.in[3];
+            for (int i = 0; i < (p.with_sum ? 2 : 1); i++) {
+                prune(data, p.conv_oc, conv_ic, p.density);
+                data += p.conv_oc * conv_ic + p.conv_oc;
+            }
+            prune(data, p.fc_oc, fc_ic, p.density);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS,
+                                InferenceEngine::PluginConfigParams::YES}});
+            graph.CreateGraph(net_reader.getNetwork());
+            // sparse kernels are opt-in, the default config keeps the dense primitives
+            MKLDNNGraphTestClass denseGraph;
+            denseGraph.CreateGraph(net_reader.getNetwork());
+
+            bool expect_sparse = p.expect_sparse && mkldnn::impl::cpu::jit_uni_sparse_sgemm::block_size() != 0;
+            size_t sparse_nodes = 0;
+            for (auto &node : graph.getNodes()) {
+                if (node->getType() != MKLDNNPlugin::FullyConnected && node->getType() != MKLDNNPlugin::Convolution &&
+                    node->getType() != MKLDNNPlugin::Convolution_Activation &&
+                    node->getType() != MKLDNNPlugin::Convolution_Sum_Activation)
+                    continue;
+                if (node->getSelectedPrimitiveDescriptor()->getImplementationType() & MKLDNNPlugin::impl_desc_type::sparse)
+                    sparse_nodes++;
+            }
+            // the convolutions (one of them is merged with the sum) and the FullyConnected
+            ASSERT_EQ(expect_sparse ? (p.with_sum ? 3 : 2) : 0, sparse_nodes);
+            for (auto &node : denseGraph.getNodes()) {
+                if (node->getSelectedPrimitiveDescriptor())
+                    ASSERT_EQ(0, node->getSelectedPrimitiveDescriptor()->getImplementationType() & MKLDNNPlugin::impl_desc_type::sparse);
+            }
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, p.in);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::BlobMap outputBlobs, denseOutputBlobs;
+            InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+            InferenceEngine::TBlob<float>::Ptr dense_output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            dense_output->allocate();
+            denseOutputBlobs[item.first] = dense_output;
+
+            graph.Infer(srcs, outputBlobs);
+            denseGraph.Infer(srcs, denseOutputBlobs);
+
+            compare(*output, *dense_output);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphSparseWeightsTests, TestsSparseWeights) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsSparseWeights, MKLDNNGraphSparseWeightsTests,
+        ::testing::Values(
+                sparse_weights_test_params{{1, 64, 14, 14}, 128, 100, false, 0.2f, true},
+                sparse_weights_test_params{{2, 32, 7, 7}, 64, 40, true, 0.3f, true},
+                sparse_weights_test_params{{4, 48, 8, 8}, 96, 16, true, 0.1f, true},
+                // dense enough weights stay with the mkl-dnn primitives
+                sparse_weights_test_params{{1, 64, 14, 14}, 128, 100, false, 0.9f, false}
+        ));
@@ -6451,3 +6451,807 @@ TEST_F(MKLDNNGraphStructureTests, TestCreateGraphWithMultipleData) {
         compare(*outputBlobs[i], *expectedOutputBlobs[i]);
     }
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestParallelBranchesGiveSameResults) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="max_pool" type="Pooling" precision="FP32" id="1">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="1" pad-y="1" stride-x="1" stride-y="1" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="avg_pool" type="Pooling" precision="FP32" id="2">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="1" pad-y="1" stride-x="1" stride-y="1" rounding-type="ceil" pool-method="avg" exclude-pad="true"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale_pool" type="Pooling" precision="FP32" id="4">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="1" stride-y="1" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="5">
+            <concat_data axis="1"/>
+            <input>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="11">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="12">
+                    <dim>1</dim>
+                    <dim>24</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+        <edge from-layer="1" from-port="2" to-layer="5" to-port="9"/>
+        <edge from-layer="2" from-port="4" to-layer="5" to-port="10"/>
+        <edge from-layer="4" from-port="8" to-layer="5" to-port="11"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 8, 16, 16}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data((float *) src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    MKLDNNGraphTestClass sequentialGraph;
+    sequentialGraph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::BlobMap refBlobs;
+    InferenceEngine::TBlob<float>::Ptr refOutput = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    refOutput->allocate();
+    refBlobs[item.first] = refOutput;
+    sequentialGraph.Infer(srcs, refBlobs);
+
+    MKLDNNGraphTestClass parallelGraph;
+    parallelGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                                InferenceEngine::PluginConfigParams::YES}});
+    parallelGraph.CreateGraph(net_reader.getNetwork());
+
+    // several inferences to catch the branches overwriting the buffers of each other
+    for (int i = 0; i < 3; i++) {
+        InferenceEngine::BlobMap outputBlobs;
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        parallelGraph.Infer(srcs, outputBlobs);
+
+        compare(*output, *refOutput);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestParallelBranchesWithScratchpadNodesGiveSameResults) {
+    // gemm and winograd convolutions use the thread-local scratchpad of mkl-dnn, so they must not run in parallel
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="gemm_conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1" PrimitivesPriority="cpu:gemm_blas,cpu:gemm_jit"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </output>
+            <weights offset="0" size="9216"/>
+            <biases offset="9216" size="64"/>
+        </layer>
+        <layer name="wino_conv" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1" PrimitivesPriority="cpu:jit_avx512_winograd,cpu:jit_avx2_winograd"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </output>
+            <weights offset="9280" size="9216"/>
+            <biases offset="18496" size="64"/>
+        </layer>
+        <layer name="pool" type="Pooling" precision="FP32" id="3">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="1" pad-y="1" stride-x="1" stride-y="1" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="4">
+            <concat_data axis="1"/>
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </input>
+            <output>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>48</dim>
+                    <dim>14</dim>
+                    <dim>14</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="5"/>
+        <edge from-layer="1" from-port="2" to-layer="4" to-port="7"/>
+        <edge from-layer="2" from-port="4" to-layer="4" to-port="8"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="9"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {18560});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 16, 14, 14}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data((float *) src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    MKLDNNGraphTestClass sequentialGraph;
+    sequentialGraph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::BlobMap refBlobs;
+    InferenceEngine::TBlob<float>::Ptr refOutput = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    refOutput->allocate();
+    refBlobs[item.first] = refOutput;
+    sequentialGraph.Infer(srcs, refBlobs);
+
+    MKLDNNGraphTestClass parallelGraph;
+    parallelGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                                InferenceEngine::PluginConfigParams::YES}});
+    parallelGraph.CreateGraph(net_reader.getNetwork());
+
+    bool hasGemm = false;
+    for (auto &node : parallelGraph.getNodes()) {
+        if (node->getName() == "gemm_conv")
+            hasGemm = (node->getSelectedPrimitiveDescriptor()->getImplementationType() & MKLDNNPlugin::impl_desc_type::gemm) != 0;
+    }
+    ASSERT_TRUE(hasGemm);
+
+    for (int i = 0; i < 3; i++) {
+        InferenceEngine::BlobMap outputBlobs;
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        parallelGraph.Infer(srcs, outputBlobs);
+
+        compare(*output, *refOutput);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMicroBatchesGiveSameResults) {
+    // 16 channels fill the blocks of every ISA
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="max_pool" type="Pooling" precision="FP32" id="1">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="1" pad-y="1" stride-x="1" stride-y="1" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="avg_pool" type="Pooling" precision="FP32" id="2">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="1" pad-y="1" stride-x="1" stride-y="1" rounding-type="ceil" pool-method="avg" exclude-pad="true"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale_pool" type="Pooling" precision="FP32" id="4">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="1" stride-y="1" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="5">
+            <concat_data axis="1"/>
+            <input>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+                <port id="11">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="12">
+                    <dim>1</dim>
+                    <dim>48</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+        <edge from-layer="1" from-port="2" to-layer="5" to-port="9"/>
+        <edge from-layer="2" from-port="4" to-layer="5" to-port="10"/>
+        <edge from-layer="4" from-port="8" to-layer="5" to-port="11"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    net_reader.getNetwork().setBatchSize(8);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {8, 16, 16, 16}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data((float *) src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    MKLDNNGraphTestClass wholeBatchGraph;
+    wholeBatchGraph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::BlobMap refBlobs;
+    InferenceEngine::TBlob<float>::Ptr refOutput = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    refOutput->allocate();
+    refBlobs[item.first] = refOutput;
+    wholeBatchGraph.Infer(srcs, refBlobs);
+
+    // the last micro-batch is smaller than the rest
+    for (std::string microBatch : {"3", InferenceEngine::PluginConfigParams::YES}) {
+        MKLDNNGraphTestClass graph;
+        graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_MICRO_BATCH, microBatch}});
+        graph.CreateGraph(net_reader.getNetwork());
+
+        InferenceEngine::BlobMap outputBlobs;
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        graph.Infer(srcs, outputBlobs);
+
+        compare(*output, *refOutput);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMicroBatchesOfConvolutionAndFullyConnectedGiveSameResults) {
+    // the primitives with weights have to follow the data handles moved to every micro-batch
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1728"/>
+            <biases offset="1728" size="64"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fc" type="FullyConnected" precision="FP32" id="3">
+            <fc_data out-size="10"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+            <weights offset="1792" size="40960"/>
+            <biases offset="42752" size="40"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {42792});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+    net_reader.getNetwork().setBatchSize(8);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {8, 3, 8, 8}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data((float *) src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    MKLDNNGraphTestClass wholeBatchGraph;
+    wholeBatchGraph.CreateGraph(net_reader.getNetwork());
+
+    InferenceEngine::BlobMap refBlobs;
+    InferenceEngine::TBlob<float>::Ptr refOutput = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    refOutput->allocate();
+    refBlobs[item.first] = refOutput;
+    wholeBatchGraph.Infer(srcs, refBlobs);
+
+    auto inferMicroBatches = [&](MKLDNNGraphTestClass &graph, int batch) {
+        InferenceEngine::BlobMap outputBlobs;
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        graph.Infer(srcs, outputBlobs, batch);
+        return output;
+    };
+
+    // explicit size, the last micro-batch is smaller than the rest
+    MKLDNNGraphTestClass explicitGraph;
+    explicitGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_MICRO_BATCH, "3"}});
+    explicitGraph.CreateGraph(net_reader.getNetwork());
+    compare(*inferMicroBatches(explicitGraph, -1), *refOutput);
+    ASSERT_EQ(3, explicitGraph.getMicroBatchSize());
+
+    // the chosen size, the cache budget is less than any footprint, so every sample is a micro-batch
+    MKLDNNGraphTestClass chosenGraph;
+    chosenGraph.microBatchCacheSize = 1;
+    chosenGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_MICRO_BATCH,
+                              InferenceEngine::PluginConfigParams::YES}});
+    chosenGraph.CreateGraph(net_reader.getNetwork());
+    compare(*inferMicroBatches(chosenGraph, -1), *refOutput);
+    ASSERT_EQ(1, chosenGraph.getMicroBatchSize());
+
+    // dynamic batch limits the micro-batches to the requested samples
+    MKLDNNGraphTestClass dynBatchGraph;
+    dynBatchGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_ENABLED,
+                                InferenceEngine::PluginConfigParams::YES},
+                               {InferenceEngine::PluginConfigParams::KEY_CPU_MICRO_BATCH, "2"}});
+    dynBatchGraph.CreateGraph(net_reader.getNetwork());
+    for (int batch : {5, 8, 1}) {
+        auto output = inferMicroBatches(dynBatchGraph, batch);
+        const float *res = output->readOnly();
+        const float *ref = refOutput->readOnly();
+        for (size_t i = 0; i < static_cast<size_t>(batch) * 10; i++)
+            ASSERT_NEAR(ref[i], res[i], 0.0001f) << "batch " << batch << " index " << i;
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMicroBatchesReuseMemory) {
+    // 12 channels are padded to the blocks of the ISA, the intermediate data of a micro-batch
+    // reuses the memory, only the inputs and outputs of the whole batch live through all the micro-batches
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>12</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="12" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>12</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>12</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="5184"/>
+            <biases offset="5184" size="48"/>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="12" group="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>12</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>12</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="5184"/>
+            <biases offset="5184" size="48"/>
+        </layer>
+        <layer name="conv3" type="Convolution" precision="FP32" id="3">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="12" group="1"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>12</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>12</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="5184"/>
+            <biases offset="5184" size="48"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {5232});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+    net_reader.getNetwork().setBatchSize(8);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {8, 12, 8, 8}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data((float *) src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    auto infer = [&](MKLDNNGraphTestClass &graph) {
+        InferenceEngine::BlobMap outputBlobs;
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    };
+
+    MKLDNNGraphTestClass wholeBatchGraph;
+    wholeBatchGraph.CreateGraph(net_reader.getNetwork());
+    auto refOutput = infer(wholeBatchGraph);
+
+    MKLDNNGraphTestClass microBatchGraph;
+    microBatchGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_MICRO_BATCH, "3"}});
+    microBatchGraph.CreateGraph(net_reader.getNetwork());
+    compare(*infer(microBatchGraph), *refOutput);
+    ASSERT_EQ(3, microBatchGraph.getMicroBatchSize());
+
+    // at most the input and the output do not share the memory, their padded sizes are 16 channels
+    const size_t padded = 8 * 16 * 8 * 8 * sizeof(float);
+    ASSERT_LT(0, wholeBatchGraph.getWorkspaceSize());
+    ASSERT_LE(microBatchGraph.getWorkspaceSize(), wholeBatchGraph.getWorkspaceSize() + 2 * padded);
+}
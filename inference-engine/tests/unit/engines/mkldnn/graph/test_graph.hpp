@@ -23,6 +23,21 @@ public:
     MKLDNNGraphTestClass(): MKLDNNPlugin::MKLDNNGraph() {}
     virtual ~MKLDNNGraphTestClass() = default;
 
+    // cache budget for KEY_CPU_MICRO_BATCH=YES, 0 means the actual one
+    size_t microBatchCacheSize = 0;
+
+    int getMicroBatchSize() const {
+        return microBatchSize;
+    }
+
+    size_t getWorkspaceSize() const {
+        return memWorkspace ? memWorkspace->GetSize() : 0;
+    }
+
+    size_t MicroBatchCacheSize() const override {
+        return microBatchCacheSize ? microBatchCacheSize : MKLDNNPlugin::MKLDNNGraph::MicroBatchCacheSize();
+    }
+
     static std::string getStrPrimitiveDescriptorType(MKLDNNPlugin::impl_desc_type type) {
         std::string str_type;
 
@@ -51,6 +66,7 @@ public:
         SEARCH_TYPE(winograd);
         SEARCH_TYPE(_dw);
         SEARCH_TYPE(_1x1);
+        SEARCH_TYPE(sparse);
 
         if (type == MKLDNNPlugin::impl_desc_type::unknown)
             str_type = "unknown";
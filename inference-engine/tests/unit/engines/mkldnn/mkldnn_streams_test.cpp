@@ -0,0 +1,174 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <future>
+#include <stdexcept>
+#include <vector>
+#include "mkldnn_plugin/mkldnn_streams.h"
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+using namespace std;
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+class MKLDNNStreamsExecutorTest : public ::testing::Test {
+protected:
+    Task::Ptr makeInit(shared_future<void> released, bool fails = false) {
+        return make_shared<Task>([released, fails] {
+            released.wait();
+            if (fails)
+                throw logic_error("stream initialization failed");
+        });
+    }
+};
+
+TEST_F(MKLDNNStreamsExecutorTest, executesTasksBeforeAllWorkersInitialized) {
+    promise<void> slowInit;
+    promise<void> fastInit;
+    fastInit.set_value();
+
+    MultiWorkerTaskExecutor executor({makeInit(fastInit.get_future().share()),
+                                      makeInit(slowInit.get_future().share())});
+    ASSERT_EQ(1, executor.waitFirstReady());
+
+    auto task = make_shared<Task>([] {});
+    ASSERT_TRUE(executor.startTask(task));
+    ASSERT_EQ(Task::TS_DONE, task->wait(-1));
+
+    slowInit.set_value();
+    ASSERT_EQ(2, executor.waitAllInitialized());
+}
+
+TEST_F(MKLDNNStreamsExecutorTest, failedInitializationIsRethrown) {
+    promise<void> released;
+    auto init = released.get_future().share();
+    released.set_value();
+
+    MultiWorkerTaskExecutor executor({makeInit(init, true), makeInit(init)});
+    ASSERT_THROW(executor.waitAllInitialized(), logic_error);
+
+    // a request started after the failure reports it instead of running on the remaining stream
+    auto task = make_shared<Task>([] {});
+    ASSERT_THROW(executor.startTask(task), logic_error);
+    ASSERT_EQ(Task::TS_INITIAL, task->getStatus());
+}
+
+TEST_F(MKLDNNStreamsExecutorTest, reportsNoReadyWorkersIfAllInitializationsFailed) {
+    promise<void> released;
+    auto init = released.get_future().share();
+    released.set_value();
+
+    MultiWorkerTaskExecutor executor({makeInit(init, true), makeInit(init, true)});
+    ASSERT_EQ(0, executor.waitFirstReady());
+}
+
+class MKLDNNCPUResourceManagerTest : public ::testing::Test {
+protected:
+    CPUResourceManager manager{{0, 1, 2, 3, 4, 5, 6, 7}};
+};
+
+TEST_F(MKLDNNCPUResourceManagerTest, splitsCoresBetweenNetworksWithoutOverlap) {
+    auto first = manager.reserve("first", 2);
+    ASSERT_EQ(vector<int>({0, 1, 2, 3, 4, 5, 6, 7}), first->cores());
+
+    auto second = manager.reserve("second", 1);
+    ASSERT_EQ(vector<int>({0, 1, 2, 3}), first->cores());
+    ASSERT_EQ(vector<int>({4, 5, 6, 7}), second->cores());
+    ASSERT_EQ(2, first->threadCore(1, 0));
+    ASSERT_EQ(5, second->threadCore(0, 1));
+}
+
+TEST_F(MKLDNNCPUResourceManagerTest, explicitThreadsGetVacantCoresFirst) {
+    auto shared = manager.reserve("shared", 1);
+    auto exclusive = manager.reserve("exclusive", 2, 2);
+    ASSERT_EQ(vector<int>({0, 1}), exclusive->cores());
+    ASSERT_EQ(vector<int>({2, 3, 4, 5, 6, 7}), shared->cores());
+    ASSERT_EQ(1, exclusive->threadCore(1, 0));
+    // the threads beyond the cores of the stream are not pinned rather than piled on a core
+    ASSERT_EQ(1, exclusive->streamThreads(0));
+    ASSERT_EQ(-1, exclusive->threadCore(0, 3));
+}
+
+TEST_F(MKLDNNCPUResourceManagerTest, explicitThreadsNeverGetTheSameCoreTwice) {
+    auto first = manager.reserve("first", 1, 3);
+    auto second = manager.reserve("second", 1, 8);
+    auto cores = second->cores();
+    std::sort(cores.begin(), cores.end());
+    ASSERT_EQ(vector<int>({0, 1, 2, 3, 4, 5, 6, 7}), cores);
+    ASSERT_EQ(vector<int>({0, 1, 2}), first->cores());
+}
+
+TEST(MKLDNNCPUResourceManagerSMTTest, networksDoNotShareHyperthreadsOfTheCore) {
+    // 4 physical cores with 2 hyperthreads each, numbered as Linux does: the siblings are 4 apart
+    CPUResourceManager manager({0, 1, 2, 3, 4, 5, 6, 7}, {0, 1, 2, 3, 0, 1, 2, 3});
+    auto exclusive = manager.reserve("exclusive", 1, 2);
+    auto shared = manager.reserve("shared", 2);
+
+    // first hyperthreads go first, so 2 threads get 2 physical cores
+    ASSERT_EQ(vector<int>({0, 1, 4, 5}), exclusive->cores());
+    ASSERT_EQ(0, exclusive->threadCore(0, 0));
+    ASSERT_EQ(1, exclusive->threadCore(0, 1));
+    // streams get whole physical cores
+    ASSERT_EQ(vector<int>({2, 6}), manager.coreMap()[1].cores);
+    ASSERT_EQ(vector<int>({3, 7}), manager.coreMap()[2].cores);
+    ASSERT_EQ(2, shared->streamThreads(1));
+
+    exclusive.reset();
+    ASSERT_EQ(vector<int>({0, 1, 4, 5}), manager.coreMap()[0].cores);
+    ASSERT_EQ(vector<int>({2, 3, 6, 7}), manager.coreMap()[1].cores);
+}
+
+TEST_F(MKLDNNCPUResourceManagerTest, rebalancesWhenNetworkIsReleased) {
+    auto first = manager.reserve("first", 1);
+    auto second = manager.reserve("second", 1);
+    const size_t generation = first->generation();
+
+    second.reset();
+    ASSERT_NE(generation, first->generation());
+    ASSERT_EQ(8, first->cores().size());
+}
+
+TEST_F(MKLDNNCPUResourceManagerTest, sharesCoresIfNothingIsVacant) {
+    auto exclusive = manager.reserve("exclusive", 1, 8);
+    auto shared = manager.reserve("shared", 2);
+    ASSERT_EQ(8, exclusive->cores().size());
+    ASSERT_EQ(8, shared->cores().size());
+}
+
+TEST_F(MKLDNNCPUResourceManagerTest, reportsCoreMapOfEveryStream) {
+    auto first = manager.reserve("first", 2, 4);
+    auto second = manager.reserve("second", 1);
+
+    auto map = manager.coreMap();
+    ASSERT_EQ(3, map.size());
+    ASSERT_EQ("first", map[0].network);
+    ASSERT_EQ(vector<int>({0, 1}), map[0].cores);
+    ASSERT_EQ(1, map[1].stream);
+    ASSERT_EQ(vector<int>({2, 3}), map[1].cores);
+    ASSERT_EQ("second", map[2].network);
+    ASSERT_EQ(vector<int>({4, 5, 6, 7}), map[2].cores);
+    ASSERT_EQ("first stream 0: 0 1\nfirst stream 1: 2 3\nsecond stream 0: 4 5 6 7\n", manager.coreMapToString());
+}
+
+#if IE_THREAD == IE_THREAD_OMP
+TEST_F(MKLDNNCPUResourceManagerTest, unpinnedGraphFollowsTheCoresOfItsStream) {
+    const int defaultThreads = omp_get_max_threads();
+    auto first = manager.reserve("first", 1);
+    MKLDNNGraph graph;
+    graph.CreateArena(8);
+    graph.AssignCores(first, 0);
+    ASSERT_EQ(8, omp_get_max_threads());
+
+    auto second = manager.reserve("second", 1);
+    graph.FollowCores();
+    ASSERT_EQ(4, omp_get_max_threads());
+
+    second.reset();
+    graph.FollowCores();
+    ASSERT_EQ(8, omp_get_max_threads());
+    omp_set_num_threads(defaultThreads);
+}
+#endif
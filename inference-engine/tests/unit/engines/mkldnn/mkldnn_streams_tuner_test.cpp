@@ -0,0 +1,210 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "ie_plugin_config.hpp"
+#include <cpp/ie_cnn_net_reader.h>
+#include "mkldnn_plugin/mkldnn_streams_tuner.h"
+
+using namespace std;
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+class MKLDNNStreamsTunerTest : public ::testing::Test {
+protected:
+    static StreamsTuner::Decision make(int streams, double fps, double latency) {
+        StreamsTuner::Decision d;
+        d.streams = streams;
+        d.threads = 8;
+        d.fps = fps;
+        d.latency = latency;
+        return d;
+    }
+};
+
+TEST_F(MKLDNNStreamsTunerTest, triesPowerOfTwoStreamsAndStreamPerCore) {
+    vector<pair<int, int>> expected = {{1, 6}, {2, 6}, {4, 6}, {6, 6}};
+    ASSERT_EQ(expected, StreamsTuner::candidates(6));
+    expected = {{1, 1}};
+    ASSERT_EQ(expected, StreamsTuner::candidates(1));
+}
+
+TEST_F(MKLDNNStreamsTunerTest, selectsBestThroughputUnderLatencyCap) {
+    vector<StreamsTuner::Decision> measured = {make(1, 100, 10), make(2, 150, 13), make(4, 180, 22)};
+    ASSERT_EQ(4, StreamsTuner::select(measured, 0).streams);
+    ASSERT_EQ(2, StreamsTuner::select(measured, 15).streams);
+    // nothing fits the cap
+    ASSERT_EQ(1, StreamsTuner::select(measured, 5).streams);
+}
+
+TEST_F(MKLDNNStreamsTunerTest, latestCachedDecisionWins) {
+    const string file = "mkldnn_streams_tuner_test.cache";
+    remove(file.c_str());
+
+    StreamsTuner::Decision decision;
+    ASSERT_FALSE(StreamsTuner::loadCached(file, "model@cpu", decision));
+
+    StreamsTuner::saveCached(file, "model@cpu", make(2, 150, 13), {make(1, 100, 10), make(2, 150, 13)});
+    StreamsTuner::saveCached(file, "other@cpu", make(1, 10, 1), {});
+    StreamsTuner::saveCached(file, "model@cpu", make(4, 180, 22), {});
+
+    ASSERT_TRUE(StreamsTuner::loadCached(file, "model@cpu", decision));
+    ASSERT_EQ(4, decision.streams);
+    ASSERT_EQ(8, decision.threads);
+    ASSERT_DOUBLE_EQ(180, decision.fps);
+    remove(file.c_str());
+}
+
+TEST_F(MKLDNNStreamsTunerTest, tuneModeIsResetByExplicitStreams) {
+    Config cfg;
+    cfg.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::CPU_THROUGHPUT_TUNE},
+                        {PluginConfigParams::KEY_CPU_THROUGHPUT_LATENCY_CAP, "20"}});
+    ASSERT_TRUE(cfg.tuneStreams);
+    ASSERT_EQ(20, cfg.tuneLatencyCap);
+
+    cfg.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}});
+    ASSERT_FALSE(cfg.tuneStreams);
+    ASSERT_EQ(2, cfg.throughputStreams);
+}
+
+TEST_F(MKLDNNStreamsTunerTest, tunesNetworkOncePerThreadBudget) {
+    std::string model = R"V0G0N(
+<net name="streams_tuner_e2e" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(model.data(), model.length()));
+    CNNNetwork network = reader.getNetwork();
+
+    const string file = "mkldnn_streams_tuner_e2e_test.cache";
+    remove(file.c_str());
+    Config cfg;
+    cfg.tuneStreams = true;
+    cfg.threadsNum = 2;
+    cfg.tuneCacheFile = file;
+
+    StreamsTuner tuner(std::make_shared<MKLDNNExtensionManager>());
+    StreamsTuner::Decision decision = tuner.tune(network, cfg);
+    ASSERT_FALSE(decision.cached);
+    ASSERT_EQ(2, decision.threads);
+    ASSERT_TRUE(decision.streams == 1 || decision.streams == 2);
+    ASSERT_GT(decision.fps, 0);
+
+    // every measured split is reported in the cache file
+    std::ifstream report(file);
+    string line;
+    size_t measured = 0;
+    while (getline(report, line))
+        measured += !line.empty() && line[0] == '#';
+    ASSERT_EQ(StreamsTuner::candidates(2).size(), measured);
+
+    StreamsTuner::Decision cached = tuner.tune(network, cfg);
+    ASSERT_TRUE(cached.cached);
+    ASSERT_EQ(decision.streams, cached.streams);
+
+    // another thread budget is tuned anew
+    cfg.threadsNum = 1;
+    StreamsTuner::Decision single = tuner.tune(network, cfg);
+    ASSERT_FALSE(single.cached);
+    ASSERT_EQ(1, single.streams);
+    ASSERT_EQ(1, single.threads);
+    remove(file.c_str());
+}
+
+TEST_F(MKLDNNStreamsTunerTest, modelHashCoversWholeWeights) {
+    std::string model = R"V0G0N(
+<net name="streams_tuner_hash" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1728"/>
+            <biases offset="1728" size="64"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(model.data(), model.length()));
+    TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {1792}));
+    weights->allocate();
+    memset(weights->buffer().as<uint8_t *>(), 0, weights->byteSize());
+    reader.SetWeights(weights);
+    CNNNetwork network = reader.getNetwork();
+
+    const string hash = StreamsTuner::modelHash(network);
+    ASSERT_EQ(hash, StreamsTuner::modelHash(network));
+
+    // the models differing only in the weights past the first kilobyte are still told apart
+    network.getLayerByName("conv")->blobs["weights"]->buffer().as<float *>()[400] = 1.f;
+    ASSERT_NE(hash, StreamsTuner::modelHash(network));
+}
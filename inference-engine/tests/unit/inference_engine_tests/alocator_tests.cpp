@@ -6,6 +6,9 @@
 #include <gmock/gmock-spec-builders.h>
 
 #include "ie_allocator.hpp"
+#include "pooled_allocator.hpp"
+
+#include <cstdint>
 
 using namespace ::testing;
 using namespace std;
@@ -35,3 +38,97 @@ TEST_F(SystemAllocatorTests, canLockAllocatedMemory) {
     ptr [9999] = 11;
     ASSERT_EQ(ptr[9999], 11);
 }
+
+TEST_F(SystemAllocatorTests, allocatedMemoryIsCacheLineAligned) {
+    for (size_t size : {1, 63, 100, 4097, 3 * 1024 * 1024}) {
+        void * handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(allocator->lock(handle)) % 64);
+        allocator->free(handle);
+    }
+}
+
+TEST_F(SystemAllocatorTests, defaultAllocatorReportsStatistics) {
+    AllocatorStatistics before;
+    GetDefaultAllocatorStatistics(&before);
+
+    void * handle = allocator->alloc(1000);
+    AllocatorStatistics during;
+    GetDefaultAllocatorStatistics(&during);
+    allocator->free(handle);
+
+    EXPECT_GE(during.allocations, before.allocations + 1);
+    EXPECT_GE(during.bytesPeak, 1000);
+}
+
+class MemoryPoolTests: public ::testing::Test {
+protected:
+    MemoryPool::Config config() {
+        MemoryPool::Config config;
+        config.arenas = 1;
+        config.hugePages = MemoryPool::HugePages::OFF;
+        return config;
+    }
+};
+
+TEST_F(MemoryPoolTests, reusesReleasedBlockOfSameSizeClass) {
+    MemoryPool pool(config());
+    void * first = pool.allocate(1000);
+    pool.deallocate(first);
+    void * second = pool.allocate(990);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, pool.statistics().poolHits);
+    pool.deallocate(second);
+}
+
+TEST_F(MemoryPoolTests, doesNotReuseBlockOfOtherSizeClass) {
+    MemoryPool pool(config());
+    void * small = pool.allocate(1000);
+    pool.deallocate(small);
+    void * big = pool.allocate(100000);
+
+    EXPECT_EQ(0, pool.statistics().poolHits);
+    pool.deallocate(big);
+}
+
+TEST_F(MemoryPoolTests, tracksLiveAndPeakBytes) {
+    MemoryPool pool(config());
+    void * a = pool.allocate(100);
+    void * b = pool.allocate(200);
+    EXPECT_EQ(300, pool.statistics().bytesLive);
+    pool.deallocate(a);
+    pool.deallocate(b);
+
+    auto stats = pool.statistics();
+    EXPECT_EQ(0, stats.bytesLive);
+    EXPECT_EQ(300, stats.bytesPeak);
+    EXPECT_EQ(2, stats.allocations);
+    EXPECT_GT(stats.bytesCached, 0);
+}
+
+TEST_F(MemoryPoolTests, trimReleasesCachedBlocks) {
+    MemoryPool pool(config());
+    pool.deallocate(pool.allocate(5000));
+    pool.trim();
+    EXPECT_EQ(0, pool.statistics().bytesCached);
+}
+
+TEST_F(MemoryPoolTests, cacheLimitIsRespected) {
+    auto cfg = config();
+    cfg.cacheLimit = 4096;
+    MemoryPool pool(cfg);
+    pool.deallocate(pool.allocate(100000));
+    EXPECT_EQ(0, pool.statistics().bytesCached);
+}
+
+TEST_F(MemoryPoolTests, canAllocateWithPoolingDisabled) {
+    auto cfg = config();
+    cfg.pooling = false;
+    MemoryPool pool(cfg);
+    void * first = pool.allocate(1000);
+    pool.deallocate(first);
+    pool.deallocate(pool.allocate(1000));
+    EXPECT_EQ(0, pool.statistics().poolHits);
+    EXPECT_EQ(0, pool.statistics().bytesCached);
+}
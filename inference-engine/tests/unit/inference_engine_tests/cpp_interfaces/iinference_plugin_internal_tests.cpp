@@ -167,6 +167,50 @@ TEST_F(InferenceEnginePluginInternalTest, failToSetNotAllocatedBlob) {
     ASSERT_EQ(refError, dsc.msg);
 }
 
+TEST_F(InferenceEnginePluginInternalTest, failToSetROIsOfOutput) {
+    string outputName = MockNotEmptyICNNNetwork::OUTPUT_BLOB_NAME;
+    std::string refError = PARAMETER_MISMATCH_str + "Failed to set regions of interest of output: \'" + outputName + "\'";
+    IInferRequest::Ptr inferRequest;
+    getInferRequestWithMockImplInside(inferRequest);
+    Blob::Ptr blob = make_shared_blob<float>(Precision::FP32, NCHW, {});
+    blob->allocate();
+
+    ASSERT_NO_THROW(sts = inferRequest->SetBlobROIs(outputName.c_str(), blob, {{0, 0, 0, 1, 1}}, &dsc));
+    ASSERT_EQ(StatusCode::GENERAL_ERROR, sts);
+    dsc.msg[refError.length()] = '\0';
+    ASSERT_EQ(refError, dsc.msg);
+}
+
+TEST_F(InferenceEnginePluginInternalTest, failToSetROIsOfNotAllocatedBlob) {
+    string inputName = MockNotEmptyICNNNetwork::INPUT_BLOB_NAME;
+    std::string refError = "Input data was not allocated. Input name: \'" + inputName + "\'";
+    IInferRequest::Ptr inferRequest;
+    getInferRequestWithMockImplInside(inferRequest);
+    Blob::Ptr blob = make_shared_blob<float>(Precision::FP32, NCHW, {});
+
+    ASSERT_NO_THROW(sts = inferRequest->SetBlobROIs(inputName.c_str(), blob, {{0, 0, 0, 1, 1}}, &dsc));
+    ASSERT_EQ(StatusCode::GENERAL_ERROR, sts);
+    dsc.msg[refError.length()] = '\0';
+    ASSERT_EQ(refError, dsc.msg);
+}
+
+TEST(InferRequestInternalROIsTest, numberOfROIsMustBeEqualToBatch) {
+    DataPtr inputData = make_shared<Data>("input", TensorDesc(Precision::FP32, {2, 3, 8, 8}, NCHW));
+    InputInfo::Ptr inputInfo = make_shared<InputInfo>();
+    inputInfo->setInputData(inputData);
+    inputInfo->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+    DataPtr outputData = make_shared<Data>("output", TensorDesc(Precision::FP32, {2, 10}, NC));
+    MockInferRequestInternal request({{"input", inputInfo}}, {{"output", outputData}});
+    Blob::Ptr frame = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3, 32, 32}, NCHW));
+    frame->allocate();
+
+    std::vector<ROI> rois = {{0, 0, 0, 8, 8}, {1, 8, 8, 16, 16}};
+    ASSERT_NO_THROW(request.SetBlobROIs("input", frame, rois));
+    ASSERT_THROW(request.SetBlobROIs("input", frame, {rois[0]}), InferenceEngineException);
+    rois.push_back({2, 0, 0, 32, 32});
+    ASSERT_THROW(request.SetBlobROIs("input", frame, rois), InferenceEngineException);
+}
+
 class InferenceEnginePluginInternal2Test : public ::testing::Test {
 protected:
     shared_ptr<IInferencePlugin> plugin;
@@ -0,0 +1,271 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cpu_detector.hpp"
+
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/ie_preprocess_gapi_kernels_sse42.hpp"
+#endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/ie_preprocess_gapi_kernels_avx2.hpp"
+#include "cpu_x86_avx2/ie_preprocess_data_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/ie_preprocess_gapi_kernels_avx512.hpp"
+#include "cpu_x86_avx512/ie_preprocess_data_avx512.hpp"
+#endif
+
+using namespace std;
+
+namespace {
+
+// The split/merge row kernels and the FP32 resize row kernels of one ISA
+struct IsaKernels {
+    string name;
+    bool supported;
+
+    void (*splitRow_8UC2)(const uint8_t[], uint8_t[], uint8_t[], int);
+    void (*splitRow_8UC3)(const uint8_t[], uint8_t[], uint8_t[], uint8_t[], int);
+    void (*splitRow_8UC4)(const uint8_t[], uint8_t[], uint8_t[], uint8_t[], uint8_t[], int);
+    void (*splitRow_32FC2)(const float[], float[], float[], int);
+    void (*splitRow_32FC3)(const float[], float[], float[], float[], int);
+    void (*splitRow_32FC4)(const float[], float[], float[], float[], float[], int);
+
+    void (*mergeRow_8UC2)(const uint8_t[], const uint8_t[], uint8_t[], int);
+    void (*mergeRow_8UC3)(const uint8_t[], const uint8_t[], const uint8_t[], uint8_t[], int);
+    void (*mergeRow_8UC4)(const uint8_t[], const uint8_t[], const uint8_t[], const uint8_t[], uint8_t[], int);
+    void (*mergeRow_32FC2)(const float[], const float[], float[], int);
+    void (*mergeRow_32FC3)(const float[], const float[], const float[], float[], int);
+    void (*mergeRow_32FC4)(const float[], const float[], const float[], const float[], float[], int);
+
+    // there is no SSE4.2 version of the FP32 resize, these are nullptr for it
+    void (*lerpRows_32F)(float[], const float[], const float[], float, int);
+    void (*lerpCols_32F)(float[], const float[], const int[], const float[], int);
+    void (*blendRows_32F)(float[], const float[], float, const float[], float, int);
+    void (*blendCols_32F)(float[], const float[], const int[], const float[], int);
+};
+
+#define ISA_ROW_KERNELS(NS)                                                 \
+    NS::splitRow_8UC2, NS::splitRow_8UC3, NS::splitRow_8UC4,                \
+    NS::splitRow_32FC2, NS::splitRow_32FC3, NS::splitRow_32FC4,             \
+    NS::mergeRow_8UC2, NS::mergeRow_8UC3, NS::mergeRow_8UC4,                \
+    NS::mergeRow_32FC2, NS::mergeRow_32FC3, NS::mergeRow_32FC4
+
+vector<IsaKernels> isaKernels() {
+    vector<IsaKernels> isas;
+#ifdef HAVE_SSE
+    isas.push_back({"SSE4.2", InferenceEngine::with_cpu_x86_sse42(),
+                    ISA_ROW_KERNELS(InferenceEngine::gapi::kernels),
+                    nullptr, nullptr, nullptr, nullptr});
+#endif
+#ifdef HAVE_AVX2
+    isas.push_back({"AVX2", InferenceEngine::with_cpu_x86_avx2(),
+                    ISA_ROW_KERNELS(InferenceEngine::gapi::kernels::avx2),
+                    InferenceEngine::Resize::avx2::lerpRows_32F, InferenceEngine::Resize::avx2::lerpCols_32F,
+                    InferenceEngine::Resize::avx2::blendRows_32F, InferenceEngine::Resize::avx2::blendCols_32F});
+#endif
+#ifdef HAVE_AVX512
+    isas.push_back({"AVX-512", InferenceEngine::with_cpu_x86_avx512_core(),
+                    ISA_ROW_KERNELS(InferenceEngine::gapi::kernels::avx512),
+                    InferenceEngine::Resize::avx512::lerpRows_32F, InferenceEngine::Resize::avx512::lerpCols_32F,
+                    InferenceEngine::Resize::avx512::blendRows_32F, InferenceEngine::Resize::avx512::blendCols_32F});
+#endif
+    return isas;
+}
+
+#undef ISA_ROW_KERNELS
+
+// the lengths cover a single vector, the tails and the rows shorter than a vector
+const int lengths[] = {1, 3, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257, 1920};
+
+template<typename T> vector<T> randomRow(size_t size) {
+    vector<T> row(size);
+    for (size_t i = 0; i < size; i++)
+        row[i] = static_cast<T>(rand() % 256);
+    return row;
+}
+
+template<typename T, int chs, typename SplitFunc, typename MergeFunc>
+void checkSplitMerge(const string& isa, SplitFunc split, MergeFunc merge) {
+    for (int length : lengths) {
+        auto in = randomRow<T>(length * chs);
+        vector<vector<T>> planes(4, vector<T>(length));
+        vector<T> out(length * chs);
+
+        split(in.data(), planes[0].data(), planes[1].data(), planes[2].data(), planes[3].data(), length);
+        for (int x = 0; x < length; x++)
+            for (int c = 0; c < chs; c++)
+                ASSERT_EQ(in[x*chs + c], planes[c][x]) << isa << " split C" << chs << " length " << length;
+
+        merge(planes[0].data(), planes[1].data(), planes[2].data(), planes[3].data(), out.data(), length);
+        ASSERT_EQ(in, out) << isa << " merge C" << chs << " length " << length;
+    }
+}
+
+// adapts the kernels of 2, 3 and 4 channels to the 4-plane signature of checkSplitMerge
+template<typename T> struct Planes {
+    template<typename F> static function<void(const T*, T*, T*, T*, T*, int)> split2(F f) {
+        return [f](const T* in, T* o0, T* o1, T*, T*, int l) { f(in, o0, o1, l); };
+    }
+    template<typename F> static function<void(const T*, T*, T*, T*, T*, int)> split3(F f) {
+        return [f](const T* in, T* o0, T* o1, T* o2, T*, int l) { f(in, o0, o1, o2, l); };
+    }
+    template<typename F> static function<void(const T*, T*, T*, T*, T*, int)> split4(F f) {
+        return [f](const T* in, T* o0, T* o1, T* o2, T* o3, int l) { f(in, o0, o1, o2, o3, l); };
+    }
+    template<typename F> static function<void(const T*, const T*, const T*, const T*, T*, int)> merge2(F f) {
+        return [f](const T* i0, const T* i1, const T*, const T*, T* out, int l) { f(i0, i1, out, l); };
+    }
+    template<typename F> static function<void(const T*, const T*, const T*, const T*, T*, int)> merge3(F f) {
+        return [f](const T* i0, const T* i1, const T* i2, const T*, T* out, int l) { f(i0, i1, i2, out, l); };
+    }
+    template<typename F> static function<void(const T*, const T*, const T*, const T*, T*, int)> merge4(F f) {
+        return [f](const T* i0, const T* i1, const T* i2, const T* i3, T* out, int l) { f(i0, i1, i2, i3, out, l); };
+    }
+};
+
+void expectNear(const vector<float>& ref, const vector<float>& actual, const string& what) {
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_NEAR(ref[i], actual[i], 1e-4f * (1.f + fabs(ref[i]))) << what << " at " << i;
+}
+
+}  // namespace
+
+class PreprocessKernelsTests : public ::testing::Test {
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        srand(42);
+    }
+};
+
+TEST_F(PreprocessKernelsTests, splitAndMergeRowsMatchReference) {
+    for (auto& isa : isaKernels()) {
+        if (!isa.supported)
+            continue;
+
+        checkSplitMerge<uint8_t, 2>(isa.name, Planes<uint8_t>::split2(isa.splitRow_8UC2), Planes<uint8_t>::merge2(isa.mergeRow_8UC2));
+        checkSplitMerge<uint8_t, 3>(isa.name, Planes<uint8_t>::split3(isa.splitRow_8UC3), Planes<uint8_t>::merge3(isa.mergeRow_8UC3));
+        checkSplitMerge<uint8_t, 4>(isa.name, Planes<uint8_t>::split4(isa.splitRow_8UC4), Planes<uint8_t>::merge4(isa.mergeRow_8UC4));
+        checkSplitMerge<float, 2>(isa.name, Planes<float>::split2(isa.splitRow_32FC2), Planes<float>::merge2(isa.mergeRow_32FC2));
+        checkSplitMerge<float, 3>(isa.name, Planes<float>::split3(isa.splitRow_32FC3), Planes<float>::merge3(isa.mergeRow_32FC3));
+        checkSplitMerge<float, 4>(isa.name, Planes<float>::split4(isa.splitRow_32FC4), Planes<float>::merge4(isa.mergeRow_32FC4));
+    }
+}
+
+TEST_F(PreprocessKernelsTests, resizeRowsMatchReference) {
+    for (auto& isa : isaKernels()) {
+        if (!isa.supported || !isa.lerpRows_32F)
+            continue;
+
+        for (int width : lengths) {
+            int swidth = width + 5;
+            auto src0 = randomRow<float>(swidth);
+            auto src1 = randomRow<float>(swidth);
+            vector<float> alpha(2 * width);
+            vector<int> xofs(width);
+            for (auto& a : alpha)
+                a = (rand() % 100) / 100.f;
+            for (auto& sx : xofs)
+                sx = rand() % (swidth - 1);
+
+            vector<float> ref(width), dst(width);
+            string what = isa.name + " width " + to_string(width);
+
+            isa.lerpRows_32F(dst.data(), src0.data(), src1.data(), 0.3f, width);
+            for (int x = 0; x < width; x++)
+                ref[x] = src0[x] + 0.3f * (src1[x] - src0[x]);
+            expectNear(ref, dst, "lerpRows " + what);
+
+            isa.lerpCols_32F(dst.data(), src0.data(), xofs.data(), alpha.data(), width);
+            for (int x = 0; x < width; x++)
+                ref[x] = src0[xofs[x]] + alpha[x] * (src0[xofs[x] + 1] - src0[xofs[x]]);
+            expectNear(ref, dst, "lerpCols " + what);
+
+            isa.blendRows_32F(dst.data(), src0.data(), 0.3f, src1.data(), 0.7f, width);
+            for (int x = 0; x < width; x++)
+                ref[x] = src0[x] * 0.3f + src1[x] * 0.7f;
+            expectNear(ref, dst, "blendRows " + what);
+
+            isa.blendCols_32F(dst.data(), src0.data(), xofs.data(), alpha.data(), width);
+            for (int x = 0; x < width; x++)
+                ref[x] = src0[xofs[x]] * alpha[2*x] + src0[xofs[x] + 1] * alpha[2*x + 1];
+            expectNear(ref, dst, "blendCols " + what);
+        }
+    }
+}
+
+// Throughput of the row kernels of every ISA the CPU supports, run with --gtest_also_run_disabled_tests
+TEST_F(PreprocessKernelsTests, DISABLED_rowKernelsThroughput) {
+    const int width = 1920;
+    const int iterations = 20000;
+
+    auto measure = [&](const string& isa, const string& kernel, size_t bytes, const function<void()>& run) {
+        run();
+        auto start = chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; i++)
+            run();
+        chrono::duration<double> elapsed = chrono::high_resolution_clock::now() - start;
+        cout << isa << "\t" << kernel << "\t" << bytes * iterations / elapsed.count() / 1e9 << " GB/s" << endl;
+    };
+
+    auto in8 = randomRow<uint8_t>(3 * width);
+    auto in32 = randomRow<float>(3 * width);
+    vector<vector<uint8_t>> planes8(3, vector<uint8_t>(width));
+    vector<vector<float>> planes32(3, vector<float>(width + 1));
+    vector<float> alpha(2 * width), dst(width);
+    vector<int> xofs(width);
+    for (int x = 0; x < width; x++) {
+        xofs[x] = x * 2 / 3;
+        alpha[x] = alpha[width + x] = 0.5f;
+    }
+
+    for (auto& isa : isaKernels()) {
+        if (!isa.supported)
+            continue;
+
+        // the bytes read and written per call
+        measure(isa.name, "splitRow_8UC3", 6 * width, [&]() {
+            isa.splitRow_8UC3(in8.data(), planes8[0].data(), planes8[1].data(), planes8[2].data(), width);
+        });
+        measure(isa.name, "mergeRow_8UC3", 6 * width, [&]() {
+            isa.mergeRow_8UC3(planes8[0].data(), planes8[1].data(), planes8[2].data(), in8.data(), width);
+        });
+        measure(isa.name, "splitRow_32FC3", 24 * width, [&]() {
+            isa.splitRow_32FC3(in32.data(), planes32[0].data(), planes32[1].data(), planes32[2].data(), width);
+        });
+        measure(isa.name, "mergeRow_32FC3", 24 * width, [&]() {
+            isa.mergeRow_32FC3(planes32[0].data(), planes32[1].data(), planes32[2].data(), in32.data(), width);
+        });
+
+        if (!isa.lerpRows_32F)
+            continue;
+
+        measure(isa.name, "lerpRows_32F", 12 * width, [&]() {
+            isa.lerpRows_32F(dst.data(), planes32[0].data(), planes32[1].data(), 0.5f, width);
+        });
+        measure(isa.name, "lerpCols_32F", 12 * width, [&]() {
+            isa.lerpCols_32F(dst.data(), planes32[0].data(), xofs.data(), alpha.data(), width);
+        });
+        measure(isa.name, "blendRows_32F", 12 * width, [&]() {
+            isa.blendRows_32F(dst.data(), planes32[0].data(), 0.5f, planes32[1].data(), 0.5f, width);
+        });
+        measure(isa.name, "blendCols_32F", 16 * width, [&]() {
+            isa.blendCols_32F(dst.data(), planes32[0].data(), xofs.data(), alpha.data(), width);
+        });
+    }
+}
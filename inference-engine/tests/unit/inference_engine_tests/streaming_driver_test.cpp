@@ -0,0 +1,175 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cpp/ie_streaming_driver.hpp>
+#include <ie_blob.h>
+
+#include "mock_iexecutable_network.hpp"
+#include "mock_iasync_infer_request.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+const size_t kBatch = 4;
+const size_t kFrameSize = 3;
+
+class FakeMemoryState : public IMemoryState {
+public:
+    size_t resets = 0;
+
+    StatusCode GetName(char *name, size_t len, ResponseDesc *) const noexcept override {
+        if (len) name[0] = '\0';
+        return OK;
+    }
+    StatusCode Reset(ResponseDesc *) noexcept override {
+        resets++;
+        return OK;
+    }
+    StatusCode SetState(Blob::Ptr, ResponseDesc *) noexcept override {
+        return OK;
+    }
+    StatusCode GetLastState(Blob::CPtr &, ResponseDesc *) const noexcept override {
+        return OK;
+    }
+};
+
+/** @brief request scoring every frame as twice its first feature */
+struct FakeRequest {
+    shared_ptr<NiceMock<MockIInferRequest>> mock = make_shared<NiceMock<MockIInferRequest>>();
+    Blob::Ptr input = make_shared_blob<float>(TensorDesc(Precision::FP32, {kBatch, kFrameSize}, NC));
+    Blob::Ptr output = make_shared_blob<float>(TensorDesc(Precision::FP32, {kBatch, 1}, NC));
+
+    FakeRequest() {
+        input->allocate();
+        output->allocate();
+        ON_CALL(*mock, GetBlob(_, _, _)).WillByDefault(Invoke([this](const char *name, Blob::Ptr &blob, ResponseDesc *) {
+            blob = string(name) == "in" ? input : output;
+            return OK;
+        }));
+        ON_CALL(*mock, StartAsync(_)).WillByDefault(Invoke([this](ResponseDesc *) {
+            auto in = input->buffer().as<float *>();
+            auto out = output->buffer().as<float *>();
+            for (size_t row = 0; row < kBatch; row++) {
+                out[row] = 2.0f * in[row * kFrameSize];
+            }
+            return OK;
+        }));
+        ON_CALL(*mock, Wait(_, _)).WillByDefault(Return(OK));
+    }
+};
+
+}  // namespace
+
+class StreamingDriverTests : public ::testing::Test {
+protected:
+    shared_ptr<NiceMock<MockIExecutableNetwork>> mockNetwork = make_shared<NiceMock<MockIExecutableNetwork>>();
+    vector<shared_ptr<FakeRequest>> requests;
+    FakeMemoryState state;
+
+    void SetUp() override {
+        ON_CALL(*mockNetwork, GetInputsInfo(_, _)).WillByDefault(Invoke([](ConstInputsDataMap &info, ResponseDesc *) {
+            info["in"] = make_shared<InputInfo>();
+            return OK;
+        }));
+        ON_CALL(*mockNetwork, GetOutputsInfo(_, _)).WillByDefault(Invoke([](ConstOutputsDataMap &info, ResponseDesc *) {
+            info["out"] = make_shared<Data>("out", Precision::FP32);
+            return OK;
+        }));
+        ON_CALL(*mockNetwork, CreateInferRequest(_, _)).WillByDefault(Invoke([this](IInferRequest::Ptr &req, ResponseDesc *) {
+            requests.push_back(make_shared<FakeRequest>());
+            req = requests.back()->mock;
+            return OK;
+        }));
+        ON_CALL(*mockNetwork, QueryState(_, _, _)).WillByDefault(Return(OUT_OF_BOUNDS));
+    }
+
+    void withMemoryState() {
+        ON_CALL(*mockNetwork, QueryState(_, _, _)).WillByDefault(Invoke([this](IMemoryState::Ptr &pState, size_t idx,
+                                                                                ResponseDesc *) {
+            if (idx) return OUT_OF_BOUNDS;
+            pState = IMemoryState::Ptr(&state, [](IMemoryState *) {});
+            return OK;
+        }));
+    }
+
+    static StreamingDriver::Source source(const vector<uint32_t> &lengths) {
+        auto next = make_shared<size_t>(0);
+        return [lengths, next](StreamingUtterance &utt) {
+            if (*next == lengths.size()) return false;
+            size_t index = (*next)++;
+            utt.name = to_string(index);
+            utt.numFrames = lengths[index];
+            utt.numFrameElements = kFrameSize;
+            utt.features.assign(utt.numFrames * kFrameSize, 0.0f);
+            for (uint32_t frame = 0; frame < utt.numFrames; frame++) {
+                utt.features[frame * kFrameSize] = 100.0f * index + frame;
+            }
+            return true;
+        };
+    }
+
+    static void checkScores(const vector<StreamingUtterance> &scored, const vector<uint32_t> &lengths) {
+        ASSERT_EQ(lengths.size(), scored.size());
+        for (size_t i = 0; i < scored.size(); i++) {
+            ASSERT_EQ(i, scored[i].index);
+            ASSERT_EQ(lengths[i], scored[i].scores.size());
+            for (uint32_t frame = 0; frame < lengths[i]; frame++) {
+                ASSERT_FLOAT_EQ(2.0f * (100.0f * i + frame), scored[i].scores[frame]);
+            }
+        }
+    }
+};
+
+TEST_F(StreamingDriverTests, statelessModelPacksFramesOfSeveralUtterancesIntoBatch) {
+    vector<uint32_t> lengths = {5, 2, 6};
+    StreamingDriver driver(vector<ExecutableNetwork>{ExecutableNetwork(mockNetwork)}, 2);
+    ASSERT_FALSE(driver.stateful());
+    ASSERT_EQ(kBatch, driver.batchSize());
+
+    vector<StreamingUtterance> scored;
+    auto stats = driver.run(source(lengths), [&](StreamingUtterance &utt) { scored.push_back(utt); });
+
+    checkScores(scored, lengths);
+    ASSERT_EQ(2, requests.size());
+    ASSERT_EQ(3, stats.utterances);
+    ASSERT_EQ(13, stats.frames);
+    ASSERT_EQ(4, stats.inferCalls);
+    ASSERT_EQ(3, stats.paddedFrames);
+}
+
+TEST_F(StreamingDriverTests, statefulModelScoresOneUtterancePerBatchAndResetsState) {
+    withMemoryState();
+    vector<uint32_t> lengths = {5, 0, 2};
+    StreamingDriver driver(vector<ExecutableNetwork>{ExecutableNetwork(mockNetwork)}, 2);
+    ASSERT_TRUE(driver.stateful());
+
+    vector<StreamingUtterance> scored;
+    auto stats = driver.run(source(lengths), [&](StreamingUtterance &utt) { scored.push_back(utt); });
+
+    checkScores(scored, lengths);
+    ASSERT_EQ(1, requests.size());
+    ASSERT_EQ(3, stats.inferCalls);
+    ASSERT_EQ(5, stats.paddedFrames);
+    ASSERT_EQ(2, state.resets);
+}
+
+TEST_F(StreamingDriverTests, throwsOnFrameSizeMismatch) {
+    StreamingDriver driver(vector<ExecutableNetwork>{ExecutableNetwork(mockNetwork)}, 1);
+    bool pulled = false;
+    auto wrongSize = [&](StreamingUtterance &utt) {
+        if (pulled) return false;
+        pulled = true;
+        utt.numFrames = 1;
+        utt.numFrameElements = kFrameSize + 1;
+        utt.features.assign(kFrameSize + 1, 0.0f);
+        return true;
+    };
+    ASSERT_THROW(driver.run(wrongSize, [](StreamingUtterance &) {}), details::InferenceEngineException);
+}
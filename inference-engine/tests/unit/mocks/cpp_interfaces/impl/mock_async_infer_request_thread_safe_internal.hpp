@@ -46,6 +46,11 @@ public:
             const char *name,
             const Blob::Ptr &));
 
+    MOCK_METHOD3(SetBlobROIs_ThreadUnsafe, void(
+            const char *name,
+            const Blob::Ptr &,
+            const std::vector<ROI> &));
+
     MOCK_METHOD1(SetCompletionCallback_ThreadUnsafe, void(IInferRequest::CompletionCallback));
 
 	MOCK_METHOD1(SetBatch, void(int));
@@ -42,6 +42,17 @@ using PreprocParams = std::tuple< InferenceEngine::Precision     // input-output
 
 struct PreprocTest: public TestParams<PreprocParams> {};
 
+using PreprocBatchParams = std::tuple< InferenceEngine::Precision     // input-output data type
+                                     , InferenceEngine::ResizeAlgorithm // resize algorithm
+                                     , InferenceEngine::Layout        // frame tensor layout
+                                     , InferenceEngine::Layout        // output tensor layout
+                                     , int                            // number of channels
+                                     , std::pair<cv::Size, cv::Size>  // frame size, output size
+                                     , int                            // number of regions (batch)
+                                     >;
+
+struct PreprocBatchTest: public TestParams<PreprocBatchParams> {};
+
 } // opencv_test
 
 #endif //OPENCV_GAPI_CORE_TESTS_HPP
@@ -785,6 +785,21 @@ void Blob2Img(const InferenceEngine::Blob::Ptr& blobP, cv::Mat& img, InferenceEn
             THROW_IE_EXCEPTION << "Inconsistent input layout for image processing: " << layout;
     }
 }
+
+// A view of the n-th image of a batched blob
+template <InferenceEngine::Precision::ePrecision PRC>
+InferenceEngine::Blob::Ptr batchSlot(const InferenceEngine::Blob::Ptr& blobP, size_t n) {
+    using namespace InferenceEngine;
+    using data_t = typename PrecisionTrait<PRC>::value_type;
+
+    SizeVector dims = blobP->getTensorDesc().getDims();
+    const size_t slotSize = blobP->size() / dims[0];
+    dims[0] = 1;
+
+    data_t* blobData = blobP->buffer().as<data_t*>();
+    return make_shared_blob<data_t>(TensorDesc(PRC, dims, blobP->getTensorDesc().getLayout()),
+                                    blobData + n * slotSize);
+}
 }  // namespace
 
 TEST_P(PreprocTest, Performance)
@@ -871,6 +886,119 @@ TEST_P(PreprocTest, Performance)
 
 }
 
+TEST_P(PreprocBatchTest, Performance)
+{
+    using namespace InferenceEngine;
+    Precision prec;
+    ResizeAlgorithm interp;
+    Layout in_layout, out_layout;
+    int ocv_chan = -1;
+    std::pair<cv::Size, cv::Size> sizes;
+    int batch = 0;
+    std::tie(prec, interp, in_layout, out_layout, ocv_chan, sizes, batch) = GetParam();
+    cv::Size in_size, out_size;
+    std::tie(in_size, out_size) = sizes;
+
+    const int ocv_depth = prec == Precision::U8 ? CV_8U :
+        prec == Precision::FP32 ? CV_32F : -1;
+    const int ocv_type = CV_MAKETYPE(ocv_depth, ocv_chan);
+    initMatrixRandU(ocv_type, in_size, ocv_type, false);
+
+    // Regions of different sizes all over the frame, both smaller and larger than the output
+    std::vector<ROI> rois;
+    for (int i = 0; i < batch; i++) {
+        const size_t w = in_size.width / 16 + (i * 37) % (in_size.width / 4);
+        const size_t h = in_size.height / 16 + (i * 53) % (in_size.height / 4);
+        rois.push_back(ROI{static_cast<size_t>(i),
+                           (i * 131) % (in_size.width - w), (i * 71) % (in_size.height - h), w, h});
+    }
+
+    const SizeVector out_dims = {static_cast<size_t>(batch), static_cast<size_t>(ocv_chan),
+                                 static_cast<size_t>(out_size.height), static_cast<size_t>(out_size.width)};
+    Blob::Ptr in_blob, out_blob;
+    std::vector<Blob::Ptr> out_ref_blobs;
+    switch (prec)
+    {
+    case Precision::U8:
+        in_blob = img2Blob<Precision::U8>(in_mat1, in_layout);
+        out_blob = make_shared_blob<uint8_t>(TensorDesc(prec, out_dims, out_layout));
+        break;
+
+    case Precision::FP32:
+        in_blob = img2Blob<Precision::FP32>(in_mat1, in_layout);
+        out_blob = make_shared_blob<float>(TensorDesc(prec, out_dims, out_layout));
+        break;
+
+    default:
+        FAIL() << "Unsupported configuration";
+    }
+    out_blob->allocate();
+
+    PreProcessData preprocess;
+    preprocess.setRoiBlob(in_blob, rois);
+    preprocess.execute(out_blob, interp, false);
+
+    // The per-request path: every region is resized by its own pre-processing
+    std::vector<PreProcessData> preprocess_ref(batch);
+    for (int i = 0; i < batch; i++) {
+        preprocess_ref[i].setRoiBlob(make_shared_blob(in_blob, rois[i]));
+        out_ref_blobs.push_back(make_blob_with_precision(TensorDesc(prec, {1, out_dims[1], out_dims[2], out_dims[3]},
+                                                                    out_layout)));
+        out_ref_blobs.back()->allocate();
+        preprocess_ref[i].execute(out_ref_blobs.back(), interp, false);
+    }
+
+    for (int i = 0; i < batch; i++) {
+        cv::Mat out_mat(out_size, ocv_type), out_mat_ref(out_size, ocv_type);
+        switch (prec)
+        {
+        case Precision::U8:
+            Blob2Img<Precision::U8>(batchSlot<Precision::U8>(out_blob, i), out_mat, out_layout);
+            Blob2Img<Precision::U8>(out_ref_blobs[i], out_mat_ref, out_layout);
+            break;
+        case Precision::FP32:
+            Blob2Img<Precision::FP32>(batchSlot<Precision::FP32>(out_blob, i), out_mat, out_layout);
+            Blob2Img<Precision::FP32>(out_ref_blobs[i], out_mat_ref, out_layout);
+            break;
+        default: FAIL() << "Unsupported configuration";
+        }
+
+        EXPECT_EQ(0, cv::countNonZero(out_mat != out_mat_ref)) << "region " << i;
+
+        const cv::Rect rect(rois[i].posX, rois[i].posY, rois[i].sizeX, rois[i].sizeY);
+        cv::Mat ocv_out_mat(out_size, ocv_type);
+        auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA : cv::INTER_LINEAR;
+        cv::resize(in_mat1(rect), ocv_out_mat, out_size, 0, 0, cv_interp);
+
+        cv::Mat absDiff;
+        cv::absdiff(ocv_out_mat, out_mat, absDiff);
+        EXPECT_EQ(cv::countNonZero(absDiff > 1), 0) << "region " << i;
+    }
+
+#if PERF_TEST
+    // iterate testing, and print performance of the batched and the per-request paths
+    const auto type_str = depthToString(ocv_depth);
+    const auto interp_str = interp == RESIZE_AREA ? "AREA"
+        : interp == RESIZE_BILINEAR ? "BILINEAR" : "?";
+
+    test_ms([&]() { preprocess.execute(out_blob, interp, false); },
+            100,
+            "Preproc batch %s %d %s %dx%d -> %d x %dx%d",
+            type_str.c_str(), ocv_chan, interp_str,
+            in_size.width, in_size.height, batch, out_size.width, out_size.height);
+
+    test_ms([&]() {
+                for (int i = 0; i < batch; i++) {
+                    preprocess_ref[i].execute(out_ref_blobs[i], interp, false);
+                }
+            },
+            100,
+            "Preproc per-request %s %d %s %dx%d -> %d x %dx%d",
+            type_str.c_str(), ocv_chan, interp_str,
+            in_size.width, in_size.height, batch, out_size.width, out_size.height);
+#endif // PERF_TEST
+}
+
 } // opencv_test
 
 #endif //OPENCV_GAPI_CORE_TESTS_INL_HPP
@@ -241,4 +241,14 @@ INSTANTIATE_TEST_CASE_P(Everything, PreprocTest,
                                        std::make_pair(cv::Size(256, 256), cv::Size(72, 72)),
                                        std::make_pair(cv::Size(96, 256), cv::Size(128, 384)))));
 
+INSTANTIATE_TEST_CASE_P(CropResize_Batch, PreprocBatchTest,
+                        Combine(Values(IE::Precision::U8, IE::Precision::FP32),
+                                Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(IE::Layout::NCHW),
+                                Values(3),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(62, 62)),   // face crops
+                                       std::make_pair(cv::Size(1280, 720), cv::Size(128, 256))), // person crops
+                                Values(1, 7, 50)));
+
 }
@@ -0,0 +1,84 @@
+// Copyright (C) 2018 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "system_alllocator.hpp"
+#include "pooled_allocator.hpp"
+
+using namespace std;
+using namespace InferenceEngine;
+
+#ifdef ENABLE_STRESS_UNIT_TESTS
+class AllocatorStressTests : public ::testing::Test {
+protected:
+    const size_t THREADS = 8;
+    const size_t ITERATIONS = 20000;
+
+    /**
+     * Emulates blob churn of several infer requests: every thread keeps a small window
+     * of live blobs and replaces them with blobs of typical input/output/temporary sizes.
+     * Every page of a block is touched as a blob filled with data would be.
+     */
+    double churn(IAllocator &allocator) {
+        const vector<size_t> sizes = {
+                1000 * sizeof(float),               // classification output
+                16 * 1024,                          // small temporaries
+                300 * 300 * 3,                      // U8 SSD input
+                224 * 224 * 3 * sizeof(float),      // FP32 image input
+                1024 * 1024 * 4                     // converted-precision intermediate blobs
+        };
+
+        auto worker = [&](size_t seed) {
+            mt19937 gen(static_cast<unsigned>(seed));
+            uniform_int_distribution<size_t> pick(0, sizes.size() - 1);
+            vector<void*> window(4, nullptr);
+            for (size_t i = 0; i < ITERATIONS; i++) {
+                void *&slot = window[i % window.size()];
+                allocator.free(slot);
+                size_t size = sizes[pick(gen)];
+                slot = allocator.alloc(size);
+                char *ptr = reinterpret_cast<char*>(allocator.lock(slot));
+                for (size_t off = 0; off < size; off += 4096) ptr[off] = 1;
+                allocator.unlock(slot);
+            }
+            for (auto handle : window) allocator.free(handle);
+        };
+
+        auto start = chrono::high_resolution_clock::now();
+        vector<thread> threads;
+        for (size_t t = 0; t < THREADS; t++) threads.emplace_back(worker, t);
+        for (auto &t : threads) t.join();
+        return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+    }
+};
+
+TEST_F(AllocatorStressTests, pooledAllocatorServesChurnFromCache) {
+    shared_ptr<IAllocator> system = details::shared_from_irelease(new SystemMemoryAllocator());
+    shared_ptr<IAllocator> pooled = details::shared_from_irelease(new PooledMemoryAllocator());
+
+    double systemTime = churn(*system);
+    auto before = MemoryPool::instance().statistics();
+    double pooledTime = churn(*pooled);
+    auto stats = MemoryPool::instance().statistics();
+
+    size_t allocations = stats.allocations - before.allocations;
+    size_t poolHits = stats.poolHits - before.poolHits;
+    // timings depend on the machine load, they are reported but not compared
+    cout << "system allocator: " << systemTime << " ms" << endl
+         << "pooled allocator: " << pooledTime << " ms" << endl
+         << "pool hit rate: " << 100.0 * poolHits / allocations << "%, peak "
+         << stats.bytesPeak / 1024 << " KB, cached " << stats.bytesCached / 1024 << " KB" << endl;
+
+    ASSERT_EQ(THREADS * ITERATIONS, allocations);
+    ASSERT_GT(poolHits, allocations / 2);
+    ASSERT_EQ(before.bytesLive, stats.bytesLive);
+}
+#endif //ENABLE_STRESS_UNIT_TESTS
@@ -63,6 +63,7 @@
 #include "cpu/jit_uni_dw_convolution.hpp"
 #include "cpu/jit_avx512_core_u8s8s32x_wino_convolution.hpp"
 #include "cpu/jit_avx512_core_fp32_wino_conv_2x3.hpp"
+#include "cpu/jit_avx2_fp32_wino_conv.hpp"
 #include "cpu/jit_uni_roi_pooling.hpp"
 #include "cpu/jit_uni_softmax.hpp"
 #include "cpu/ref_roi_pooling.hpp"
@@ -123,6 +124,7 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(jit_avx512_common_convolution_winograd_fwd_t),
     INSTANCE(jit_avx512_common_convolution_winograd_bwd_data_t),
     INSTANCE(jit_avx512_common_convolution_winograd_bwd_weights_t),
+    INSTANCE(jit_avx2_fp32_wino_conv_fwd_t),
     INSTANCE(jit_avx512_common_convolution_fwd_t<f32>),
     INSTANCE(jit_avx512_common_convolution_bwd_data_t<f32>),
     INSTANCE(jit_avx512_common_convolution_bwd_weights_t<f32>),
@@ -320,6 +322,7 @@ static const pd_create_f cpu_impl_list[] = {
     /* conv_eltwise */
     INSTANCE(jit_avx512_common_dw_convolution_relu_t),
     INSTANCE(jit_avx512_common_convolution_winograd_relu_t),
+    INSTANCE(jit_avx2_fp32_wino_convolution_relu_t),
     INSTANCE(jit_avx512_common_1x1_convolution_relu_f32_t),
     INSTANCE(jit_avx512_common_convolution_relu_t<f32>),
     INSTANCE(jit_avx2_dw_convolution_relu_t),
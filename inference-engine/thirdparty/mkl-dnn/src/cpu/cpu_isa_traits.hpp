@@ -76,6 +76,9 @@ template <> struct cpu_isa_traits<avx512_common> {
 template <> struct cpu_isa_traits<avx512_core>:
     public cpu_isa_traits<avx512_common> {};
 
+template <> struct cpu_isa_traits<avx512_core_vnni>:
+    public cpu_isa_traits<avx512_common> {};
+
 template <> struct cpu_isa_traits<avx512_mic>:
     public cpu_isa_traits<avx512_common> {};
 
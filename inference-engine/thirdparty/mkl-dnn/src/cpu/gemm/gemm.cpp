@@ -21,6 +21,8 @@
 
 #include "jit_avx_gemm_f32.hpp"
 #include "jit_avx512_common_gemm_f32.hpp"
+#include "jit_uni_gemm_s8u8s32.hpp"
+#include "jit_uni_sgemm_packed.hpp"
 #include "gemm.hpp"
 #include "../jit_generator.hpp"
 #include "nstl.hpp"
@@ -196,6 +198,34 @@ mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
     return mkldnn_success;
 }
 
+static const jit_uni_sgemm_packed &sgemm_packed() {
+    static jit_uni_sgemm_packed sgemm;
+    return sgemm;
+}
+
+bool sgemm_pack_is_applicable() {
+    return jit_uni_sgemm_packed::is_applicable();
+}
+
+size_t sgemm_pack_get_size(int m, int k) {
+    return sgemm_packed().packed_size(m, k);
+}
+
+void sgemm_pack(const char *transa, int m, int k, const float *A, int lda,
+        float *A_packed) {
+    sgemm_packed().pack(utils::one_of(*transa, 'T', 't'), m, k, A, lda,
+            A_packed);
+}
+
+void sgemm_compute(const char *transb, int m, int n, int k,
+        const float *A_packed, const float *B, int ldb, float beta, float *C,
+        int ldc) {
+    if (m == 0 || n == 0)
+        return;
+    sgemm_packed().compute(utils::one_of(*transb, 'T', 't'), m, n, k,
+            A_packed, B, ldb, beta, C, ldc);
+}
+
 template <typename b_dt>
 mkldnn_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const char *offsetc, const int *M, const int *N, const int *K,
@@ -217,7 +247,7 @@ mkldnn_status_t gemm_s8x8s32(const char *transa, const char *transb,
     bool AisN = (*transa == 'N' || *transa == 'n');
     bool BisN = (*transb == 'N' || *transb == 'n');
 
-#if defined(USE_MKL) && defined(USE_CBLAS)
+#if USE_MKL_IGEMM
     if (data_traits<b_dt>::data_type == data_type::u8) {
         CBLAS_TRANSPOSE Cblas_trA = AisN ? CblasNoTrans : CblasTrans;
         CBLAS_TRANSPOSE Cblas_trB = BisN ? CblasNoTrans : CblasTrans;
@@ -232,6 +262,14 @@ mkldnn_status_t gemm_s8x8s32(const char *transa, const char *transb,
         return mkldnn_success;
     }
 #endif
+    if (data_traits<b_dt>::data_type == data_type::u8
+            && jit_uni_gemm_s8u8s32::is_applicable()) {
+        static jit_uni_gemm_s8u8s32 igemm;
+        igemm.gemm(!AisN, !BisN, *offsetc, *M, *N, *K, *alpha, A, *LDA, *ao,
+                (const uint8_t *)B, *LDB, *bo, *beta, C, *LDC, co);
+        return mkldnn_success;
+    }
+
     int m = *M, n = *N, k = *K, lda = *LDA, ldb = *LDB, ldc = *LDC;
     size_t sizeA = AisN ? lda * k : lda * m;
     size_t sizeB = BisN ? ldb * n : ldb * k;
@@ -286,6 +324,17 @@ mkldnn_status_t gemm_s8x8s32(const char *transa, const char *transb,
     free(dC);
     return mkldnn_success;
 }
+
+template mkldnn_status_t gemm_s8x8s32<uint8_t>(const char *transa,
+        const char *transb, const char *offsetc, const int *M, const int *N,
+        const int *K, const float *alpha, const int8_t *A, const int *LDA,
+        const int8_t *ao, const uint8_t *B, const int *LDB, const int8_t *bo,
+        const float *beta, int32_t *C, const int *LDC, const int32_t *co);
+template mkldnn_status_t gemm_s8x8s32<int8_t>(const char *transa,
+        const char *transb, const char *offsetc, const int *M, const int *N,
+        const int *K, const float *alpha, const int8_t *A, const int *LDA,
+        const int8_t *ao, const int8_t *B, const int *LDB, const int8_t *bo,
+        const float *beta, int32_t *C, const int *LDC, const int32_t *co);
 }
 }
 }
@@ -24,6 +24,17 @@ mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
         const float *beta, float *C, const int *ldc,
         const float *bias = nullptr, bool force_jit_gemm = false);
 
+/* sgemm with op(A) packed once and reused by the computations, the jit
+ * counterpart of cblas_sgemm_alloc / cblas_sgemm_pack / cblas_sgemm_compute.
+ * Computes C := op(A) * op(B) + beta * C, is applicable starting with avx2 */
+bool sgemm_pack_is_applicable();
+size_t sgemm_pack_get_size(int m, int k);
+void sgemm_pack(const char *transa, int m, int k, const float *A, int lda,
+        float *A_packed);
+void sgemm_compute(const char *transb, int m, int n, int k,
+        const float *A_packed, const float *B, int ldb, float beta, float *C,
+        int ldc);
+
 template <typename b_dt>
 mkldnn_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const char *offsetc, const int *M, const int *N, const int *K,
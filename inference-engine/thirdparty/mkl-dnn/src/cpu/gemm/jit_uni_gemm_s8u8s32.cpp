@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "mkldnn_thread.hpp"
+#include "math_utils.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "jit_uni_gemm_s8u8s32.hpp"
+
+#define GET_OFF(field) offsetof(jit_gemm_s8u8s32_call_s, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+using namespace mkldnn::impl::utils;
+
+namespace {
+/* upper bounds of the M/N blocks a thread computes at once,
+ * the blocks are shrunk until every thread has a block */
+const int BM = 256;
+const int BN = 64;
+}
+
+/* Computes an m_unroll x n_unroll tile of C from the packed panels of A and B:
+ *   a: [k_quads][m_unroll][4] s8
+ *   b: [k_quads][n_unroll][4] u8
+ *   c: n_unroll columns of m_unroll s32 values, ldc bytes apart */
+template <cpu_isa_t isa>
+struct jit_uni_gemm_s8u8s32_kern : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gemm_s8u8s32_kern)
+
+    using Vmm = typename utils::conditional<isa == avx2, Ymm, Zmm>::type;
+
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int m_vecs = 2;
+    static constexpr int m_unroll = m_vecs * vlen / (int)sizeof(int32_t);
+    static constexpr int n_unroll = isa == avx2 ? 4 : 8;
+
+    jit_uni_gemm_s8u8s32_kern() {
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(const_cast<uint8_t*>(
+                       getCode()));
+    }
+
+    void (*ker_)(const jit_gemm_s8u8s32_call_s *);
+
+private:
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_a = r8;
+    Reg64 reg_b = r9;
+    Reg64 reg_c = r10;
+    Reg64 reg_ldc = r11;
+    Reg64 reg_k = r12;
+
+    Vmm vmm_acc(int i, int j) { return Vmm(j * m_vecs + i); }
+    Vmm vmm_a(int i) { return Vmm(n_unroll * m_vecs + i); }
+    Vmm vmm_b = Vmm(n_unroll * m_vecs + m_vecs);
+    Vmm vmm_tmp = Vmm(n_unroll * m_vecs + m_vecs + 1);
+    Vmm vmm_one = Vmm(n_unroll * m_vecs + m_vecs + 2);
+
+    Label l_one;
+
+    void generate();
+};
+
+template <cpu_isa_t isa>
+void jit_uni_gemm_s8u8s32_kern<isa>::generate() {
+    preamble();
+
+    mov(reg_a, ptr[reg_param + GET_OFF(a)]);
+    mov(reg_b, ptr[reg_param + GET_OFF(b)]);
+    mov(reg_c, ptr[reg_param + GET_OFF(c)]);
+    mov(reg_ldc, ptr[reg_param + GET_OFF(ldc)]);
+    mov(reg_k, ptr[reg_param + GET_OFF(k_quads)]);
+
+    if (isa != avx512_core_vnni)
+        vpbroadcastd(vmm_one, ptr[rip + l_one]);
+
+    for (int j = 0; j < n_unroll; j++)
+        for (int i = 0; i < m_vecs; i++)
+            uni_vpxor(vmm_acc(i, j), vmm_acc(i, j), vmm_acc(i, j));
+
+    Label k_loop;
+    L(k_loop); {
+        for (int i = 0; i < m_vecs; i++)
+            uni_vmovdqu(vmm_a(i), ptr[reg_a + i * vlen]);
+        for (int j = 0; j < n_unroll; j++) {
+            vpbroadcastd(vmm_b, ptr[reg_b + j * 4]);
+            for (int i = 0; i < m_vecs; i++) {
+                if (isa == avx512_core_vnni) {
+                    vpdpbusd(vmm_acc(i, j), vmm_b, vmm_a(i));
+                } else {
+                    vpmaddubsw(vmm_tmp, vmm_b, vmm_a(i));
+                    vpmaddwd(vmm_tmp, vmm_tmp, vmm_one);
+                    vpaddd(vmm_acc(i, j), vmm_acc(i, j), vmm_tmp);
+                }
+            }
+        }
+        add(reg_a, m_unroll * 4);
+        add(reg_b, n_unroll * 4);
+        dec(reg_k);
+        jnz(k_loop, T_NEAR);
+    }
+
+    for (int j = 0; j < n_unroll; j++) {
+        for (int i = 0; i < m_vecs; i++)
+            uni_vmovdqu(ptr[reg_c + i * vlen], vmm_acc(i, j));
+        add(reg_c, reg_ldc);
+    }
+
+    postamble();
+
+    /* pairs of s16 ones summing the vpmaddubsw results into s32 */
+    align(4);
+    L(l_one);
+    dd(0x00010001);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gemm_s8u8s32::create_kernel() {
+    auto kern = new jit_uni_gemm_s8u8s32_kern<isa>();
+    kern_ = kern;
+    ker_ = kern->ker_;
+    m_unroll_ = jit_uni_gemm_s8u8s32_kern<isa>::m_unroll;
+    n_unroll_ = jit_uni_gemm_s8u8s32_kern<isa>::n_unroll;
+}
+
+jit_uni_gemm_s8u8s32::jit_uni_gemm_s8u8s32()
+    : kern_(nullptr), ker_(nullptr), m_unroll_(0), n_unroll_(0) {
+    if (mayiuse(avx512_core_vnni))
+        create_kernel<avx512_core_vnni>();
+    else if (mayiuse(avx512_core))
+        create_kernel<avx512_core>();
+    else if (mayiuse(avx2))
+        create_kernel<avx2>();
+}
+
+jit_uni_gemm_s8u8s32::~jit_uni_gemm_s8u8s32() {
+    delete kern_;
+}
+
+namespace {
+/* Packs n rows (the outer dimension of src, ld apart) of k values into
+ * panels[n / unroll][k_quads][unroll][4], zero-padded. sum[i] gets the sum
+ * of the row if requested */
+template <typename data_t>
+void pack_rows(int n, int k, const data_t *src, int ld, int unroll,
+        data_t *panels, int32_t *sum) {
+    const int kp = 4 * div_up(k, 4);
+    const int k_full = k / 4 * 4;
+    for (int i = 0; i < n; i++) {
+        const data_t *row = src + (size_t)i * ld;
+        data_t *dst = panels + (size_t)(i / unroll) * kp * unroll
+            + i % unroll * 4;
+        for (int kk = 0; kk < k_full; kk += 4) {
+            int32_t quad;
+            memcpy(&quad, row + kk, sizeof(quad));
+            memcpy(dst + kk * unroll, &quad, sizeof(quad));
+        }
+        for (int kk = k_full; kk < kp; kk++)
+            dst[k_full * unroll + kk % 4] = kk < k ? row[kk] : (data_t)0;
+        if (sum) {
+            int32_t s = 0;
+            for (int kk = 0; kk < k; kk++)
+                s += row[kk];
+            sum[i] = s;
+        }
+    }
+}
+
+/* The same for n columns (the inner dimension of src, k rows ld apart) */
+template <typename data_t>
+void pack_cols(int n, int k, const data_t *src, int ld, int unroll,
+        data_t *panels, int32_t *sum) {
+    const int kp = 4 * div_up(k, 4);
+    if (sum) {
+        for (int i = 0; i < n; i++)
+            sum[i] = 0;
+    }
+    for (int i0 = 0; i0 < n; i0 += unroll) {
+        const int len = nstl::min(unroll, n - i0);
+        data_t *tile = panels + (size_t)i0 * kp;
+        for (int kk = 0; kk < k; kk++) {
+            const data_t *row = src + (size_t)kk * ld + i0;
+            data_t *dst = tile + kk / 4 * 4 * unroll + kk % 4;
+            for (int i = 0; i < len; i++)
+                dst[i * 4] = row[i];
+            if (sum) {
+                for (int i = 0; i < len; i++)
+                    sum[i0 + i] += row[i];
+            }
+        }
+    }
+}
+}
+
+/* a_pack[m / m_unroll][k_quads][m_unroll][4], a_sum[i] = sum_k op(A)[i][k] */
+void jit_uni_gemm_s8u8s32::pack_a(bool transa, int m, int k, const int8_t *a,
+        int lda, int8_t *a_pack, int32_t *a_sum) const {
+    memset(a_pack, 0, (size_t)rnd_up(m, m_unroll_) * 4 * div_up(k, 4));
+    if (transa)
+        pack_rows(m, k, a, lda, m_unroll_, a_pack, a_sum);
+    else
+        pack_cols(m, k, a, lda, m_unroll_, a_pack, a_sum);
+}
+
+/* b_pack[n / n_unroll][k_quads][n_unroll][4], b_sum[j] = sum_k op(B)[k][j] */
+void jit_uni_gemm_s8u8s32::pack_b(bool transb, int n, int k, const uint8_t *b,
+        int ldb, uint8_t *b_pack, int32_t *b_sum) const {
+    memset(b_pack, 0, (size_t)rnd_up(n, n_unroll_) * 4 * div_up(k, 4));
+    if (transb)
+        pack_cols(n, k, b, ldb, n_unroll_, b_pack, b_sum);
+    else
+        pack_rows(n, k, b, ldb, n_unroll_, b_pack, b_sum);
+}
+
+void jit_uni_gemm_s8u8s32::gemm(bool transa, bool transb, char offsetc,
+        int m, int n, int k, float alpha, const int8_t *a, int lda, int8_t ao,
+        const uint8_t *b, int ldb, int8_t bo, float beta, int32_t *c, int ldc,
+        const int32_t *co) const {
+    assert(ker_ != nullptr);
+
+    const bool OCisR = utils::one_of(offsetc, 'R', 'r');
+    const bool OCisC = utils::one_of(offsetc, 'C', 'c');
+    const int mu = m_unroll_, nu = n_unroll_;
+    const int k_quads = div_up(k, 4);
+
+    /* no nested threading when called from a parallel region (e.g. by the
+     * im2col convolution threaded over images) */
+    const int max_nthr = mkldnn_in_parallel() ? 1 : mkldnn_get_max_threads();
+
+    int bm = nstl::min(BM, rnd_up(m, mu));
+    int bn = nstl::min(BN, rnd_up(n, nu));
+    auto nblocks = [&]() { return div_up(m, bm) * div_up(n, bn); };
+    while (nblocks() < max_nthr && (bn > nu || bm > mu)) {
+        if (bn > nu)
+            bn = rnd_up(bn / 2, nu);
+        else
+            bm = rnd_up(bm / 2, mu);
+    }
+    const int nb_m = div_up(m, bm);
+    const int nb_n = div_up(n, bn);
+
+    parallel(nstl::min(max_nthr, nb_m * nb_n), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        balance211((size_t)nb_m * nb_n, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        int8_t *a_pack = (int8_t *)malloc((size_t)bm * k_quads * 4, PAGE_4K);
+        uint8_t *b_pack = (uint8_t *)malloc((size_t)bn * k_quads * 4, PAGE_4K);
+        int32_t *acc = (int32_t *)malloc(
+                (size_t)bm * bn * sizeof(int32_t), PAGE_4K);
+        int32_t *a_sum = (int32_t *)malloc(bm * sizeof(int32_t), 64);
+        int32_t *b_sum = (int32_t *)malloc(bn * sizeof(int32_t), 64);
+
+        /* consecutive blocks of a thread share the packed A */
+        int packed_mb = -1;
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const int mb = (int)(iwork / nb_n), nb = (int)(iwork % nb_n);
+            const int m0 = mb * bm, m_len = nstl::min(bm, m - m0);
+            const int n0 = nb * bn, n_len = nstl::min(bn, n - n0);
+
+            if (mb != packed_mb) {
+                pack_a(transa, m_len, k,
+                        transa ? a + (size_t)m0 * lda : a + m0, lda,
+                        a_pack, bo != 0 ? a_sum : nullptr);
+                packed_mb = mb;
+            }
+            pack_b(transb, n_len, k,
+                    transb ? b + n0 : b + (size_t)n0 * ldb, ldb,
+                    b_pack, ao != 0 ? b_sum : nullptr);
+
+            for (int nt = 0; nt < div_up(n_len, nu); nt++) {
+                for (int mt = 0; mt < div_up(m_len, mu); mt++) {
+                    jit_gemm_s8u8s32_call_s p;
+                    p.a = a_pack + (size_t)mt * k_quads * mu * 4;
+                    p.b = b_pack + (size_t)nt * k_quads * nu * 4;
+                    p.c = acc + (size_t)nt * nu * bm + mt * mu;
+                    p.ldc = bm * sizeof(int32_t);
+                    p.k_quads = k_quads;
+                    ker_(&p);
+                }
+            }
+
+            const double ab_off = (double)k * ao * bo;
+            for (int jj = 0; jj < n_len; jj++) {
+                const int j = n0 + jj;
+                for (int ii = 0; ii < m_len; ii++) {
+                    const int i = m0 + ii;
+                    double ab = (double)acc[(size_t)jj * bm + ii] + ab_off;
+                    if (bo != 0) ab += (double)bo * a_sum[ii];
+                    if (ao != 0) ab += (double)ao * b_sum[jj];
+                    const double coffset = OCisR ? co[j] : OCisC ? co[i] : co[0];
+                    int32_t &dst = c[i + (size_t)j * ldc];
+                    const double val = (beta == 0.0f ? 0.0 : (double)beta * dst)
+                        + (double)alpha * ab + coffset;
+                    dst = math::out_round<int32_t>(
+                            math::saturate<int32_t>(val));
+                }
+            }
+        }
+
+        free(a_pack);
+        free(b_pack);
+        free(acc);
+        free(a_sum);
+        free(b_sum);
+    });
+}
+
+}
+}
+}
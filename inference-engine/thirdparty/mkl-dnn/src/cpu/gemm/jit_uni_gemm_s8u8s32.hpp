@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_GEMM_S8U8S32_HPP
+#define JIT_UNI_GEMM_S8U8S32_HPP
+
+#include <stdint.h>
+
+#include "c_types_map.hpp"
+#include "../jit_generator.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+struct jit_gemm_s8u8s32_call_s {
+    const int8_t *a;
+    const uint8_t *b;
+    int32_t *c;
+    size_t ldc; /* in bytes */
+    size_t k_quads;
+};
+
+/* C := alpha * (op(A) + ao) * (op(B) + bo) + beta * C + co
+ * for s8 A, u8 B and s32 C, all column-major (the cblas_gemm_s8u8s32 semantics)
+ *
+ * A and B are packed into quads of K, so that the jit kernel computes a
+ * dot product of 4 pairs with a single vpdpbusd (avx512_core_vnni) or with
+ * vpmaddubsw + vpmaddwd (avx2, avx512_core). Like in the other int8 jit
+ * kernels the intermediate s16 sums of the latter may saturate.
+ * The work is threaded over M/N blocks, offsets are applied at the end using
+ * the row sums of A and the column sums of B. */
+class jit_uni_gemm_s8u8s32 {
+public:
+    jit_uni_gemm_s8u8s32();
+    ~jit_uni_gemm_s8u8s32();
+
+    static bool is_applicable() { return mayiuse(avx2); }
+
+    void gemm(bool transa, bool transb, char offsetc, int m, int n, int k,
+            float alpha, const int8_t *a, int lda, int8_t ao,
+            const uint8_t *b, int ldb, int8_t bo, float beta,
+            int32_t *c, int ldc, const int32_t *co) const;
+
+private:
+    template <cpu_isa_t isa> void create_kernel();
+
+    void pack_a(bool transa, int m, int k, const int8_t *a, int lda,
+            int8_t *a_pack, int32_t *a_sum) const;
+    void pack_b(bool transb, int n, int k, const uint8_t *b, int ldb,
+            uint8_t *b_pack, int32_t *b_sum) const;
+
+    jit_generator *kern_;
+    void (*ker_)(const jit_gemm_s8u8s32_call_s *);
+    int m_unroll_, n_unroll_;
+};
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,301 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "jit_uni_sgemm_packed.hpp"
+
+#define GET_OFF(field) offsetof(jit_sgemm_packed_call_s, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+using namespace mkldnn::impl::utils;
+
+/* Computes an m_unroll x n_len tile of C (n_len <= n_unroll) from the packed
+ * panels:
+ *   a: [k][m_unroll]
+ *   b: [k][n_unroll]
+ *   c: n_len columns of m_unroll values, ldc bytes apart */
+template <cpu_isa_t isa>
+struct jit_uni_sgemm_packed_kern : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sgemm_packed_kern)
+
+    using Vmm = typename utils::conditional<isa == avx2, Ymm, Zmm>::type;
+
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int m_vecs = 2;
+    static constexpr int m_unroll = m_vecs * vlen / (int)sizeof(float);
+    static constexpr int n_unroll = isa == avx2 ? 6 : 12;
+    static constexpr int k_unroll = 4;
+
+    jit_uni_sgemm_packed_kern(int n_len) : n_len_(n_len) {
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(const_cast<uint8_t*>(
+                       getCode()));
+    }
+
+    void (*ker_)(const jit_sgemm_packed_call_s *);
+
+private:
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_a = r8;
+    Reg64 reg_b = r9;
+    Reg64 reg_c = r10;
+    Reg64 reg_ldc = r11;
+    Reg64 reg_k = r12;
+    Reg64 reg_accumulate = r13;
+
+    int n_len_;
+
+    Vmm vmm_acc(int i, int j) { return Vmm(j * m_vecs + i); }
+    Vmm vmm_a(int i) { return Vmm(n_unroll * m_vecs + i); }
+    Vmm vmm_b = Vmm(n_unroll * m_vecs + m_vecs);
+
+    void fma_step(int kk);
+    void generate();
+};
+
+template <cpu_isa_t isa>
+void jit_uni_sgemm_packed_kern<isa>::fma_step(int kk) {
+    const int a_off = kk * m_unroll * sizeof(float);
+    /* the A panel is streamed from memory, fetch it a few steps ahead */
+    prefetcht0(ptr[reg_a + a_off + 8 * m_unroll * sizeof(float)]);
+    for (int i = 0; i < m_vecs; i++)
+        uni_vmovups(vmm_a(i), ptr[reg_a + a_off + i * vlen]);
+    for (int j = 0; j < n_len_; j++) {
+        uni_vbroadcastss(vmm_b,
+                ptr[reg_b + (kk * n_unroll + j) * sizeof(float)]);
+        for (int i = 0; i < m_vecs; i++)
+            vfmadd231ps(vmm_acc(i, j), vmm_a(i), vmm_b);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sgemm_packed_kern<isa>::generate() {
+    preamble();
+
+    mov(reg_a, ptr[reg_param + GET_OFF(a)]);
+    mov(reg_b, ptr[reg_param + GET_OFF(b)]);
+    mov(reg_c, ptr[reg_param + GET_OFF(c)]);
+    mov(reg_ldc, ptr[reg_param + GET_OFF(ldc)]);
+    mov(reg_k, ptr[reg_param + GET_OFF(k)]);
+    mov(reg_accumulate, ptr[reg_param + GET_OFF(accumulate)]);
+
+    for (int j = 0; j < n_len_; j++)
+        for (int i = 0; i < m_vecs; i++)
+            uni_vpxor(vmm_acc(i, j), vmm_acc(i, j), vmm_acc(i, j));
+
+    Label k_loop, k_tail_loop, k_done;
+    cmp(reg_k, k_unroll);
+    jl(k_tail_loop, T_NEAR);
+    L(k_loop); {
+        for (int kk = 0; kk < k_unroll; kk++)
+            fma_step(kk);
+        add(reg_a, k_unroll * m_unroll * sizeof(float));
+        add(reg_b, k_unroll * n_unroll * sizeof(float));
+        sub(reg_k, k_unroll);
+        cmp(reg_k, k_unroll);
+        jge(k_loop, T_NEAR);
+    }
+    cmp(reg_k, 0);
+    je(k_done, T_NEAR);
+    L(k_tail_loop); {
+        fma_step(0);
+        add(reg_a, m_unroll * sizeof(float));
+        add(reg_b, n_unroll * sizeof(float));
+        dec(reg_k);
+        jnz(k_tail_loop, T_NEAR);
+    }
+    L(k_done);
+
+    Label store;
+    cmp(reg_accumulate, 0);
+    je(store, T_NEAR);
+    mov(reg_a, reg_c);
+    for (int j = 0; j < n_len_; j++) {
+        for (int i = 0; i < m_vecs; i++)
+            vaddps(vmm_acc(i, j), vmm_acc(i, j), ptr[reg_a + i * vlen]);
+        add(reg_a, reg_ldc);
+    }
+
+    L(store);
+    for (int j = 0; j < n_len_; j++) {
+        for (int i = 0; i < m_vecs; i++)
+            uni_vmovups(ptr[reg_c + i * vlen], vmm_acc(i, j));
+        add(reg_c, reg_ldc);
+    }
+
+    postamble();
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sgemm_packed::create_kernel() {
+    m_unroll_ = jit_uni_sgemm_packed_kern<isa>::m_unroll;
+    n_unroll_ = jit_uni_sgemm_packed_kern<isa>::n_unroll;
+    for (int n_len = 1; n_len <= n_unroll_; n_len++) {
+        auto kern = new jit_uni_sgemm_packed_kern<isa>(n_len);
+        kern_[n_len - 1] = kern;
+        ker_[n_len - 1] = kern->ker_;
+    }
+}
+
+jit_uni_sgemm_packed::jit_uni_sgemm_packed() : m_unroll_(0), n_unroll_(0) {
+    for (int i = 0; i < max_n_unroll; i++) {
+        kern_[i] = nullptr;
+        ker_[i] = nullptr;
+    }
+    if (mayiuse(avx512_common))
+        create_kernel<avx512_common>();
+    else if (mayiuse(avx2))
+        create_kernel<avx2>();
+}
+
+jit_uni_sgemm_packed::~jit_uni_sgemm_packed() {
+    for (int i = 0; i < max_n_unroll; i++)
+        delete kern_[i];
+}
+
+namespace {
+/* Packs the unroll-wide panels of n vectors of k values into
+ * panels[n / unroll][k][unroll], zero-padded. The vectors are either
+ * contiguous (is_row: vector i at src + i * ld) or strided (vector i at
+ * src + i with its values ld apart) */
+void pack_panel(bool is_row, int len, int k, const float *src, int ld,
+        int unroll, float *panel) {
+    if (is_row) {
+        for (int i = 0; i < len; i++) {
+            const float *row = src + (size_t)i * ld;
+            for (int kk = 0; kk < k; kk++)
+                panel[(size_t)kk * unroll + i] = row[kk];
+        }
+    } else {
+        for (int kk = 0; kk < k; kk++)
+            memcpy(panel + (size_t)kk * unroll, src + (size_t)kk * ld,
+                    len * sizeof(float));
+    }
+    if (len < unroll) {
+        for (int kk = 0; kk < k; kk++)
+            for (int i = len; i < unroll; i++)
+                panel[(size_t)kk * unroll + i] = 0.f;
+    }
+}
+}
+
+size_t jit_uni_sgemm_packed::packed_size(int m, int k) const {
+    return (size_t)rnd_up(m, m_unroll_) * k * sizeof(float);
+}
+
+void jit_uni_sgemm_packed::pack(bool transa, int m, int k, const float *a,
+        int lda, float *a_packed) const {
+    const int mu = m_unroll_;
+    parallel_nd(div_up(m, mu), [&](int mt) {
+        const int m0 = mt * mu;
+        pack_panel(transa, nstl::min(mu, m - m0), k,
+                transa ? a + (size_t)m0 * lda : a + m0, lda, mu,
+                a_packed + (size_t)m0 * k);
+    });
+}
+
+void jit_uni_sgemm_packed::compute(bool transb, int m, int n, int k,
+        const float *a_packed, const float *b, int ldb, float beta, float *c,
+        int ldc) const {
+    assert(ker_[0] != nullptr);
+    const int mu = m_unroll_, nu = n_unroll_;
+
+    if (k == 0) {
+        parallel_nd(n, [&](int j) {
+            for (int i = 0; i < m; i++)
+                c[i + (size_t)j * ldc] = beta == 0.f
+                    ? 0.f : beta * c[i + (size_t)j * ldc];
+        });
+        return;
+    }
+
+    const int nb_m = div_up(m, mu);
+    const int nb_n = div_up(n, nu);
+    const bool direct_beta = utils::one_of(beta, 0.f, 1.f);
+
+    /* no nested threading when called from a parallel region */
+    const int max_nthr = mkldnn_in_parallel() ? 1 : mkldnn_get_max_threads();
+
+    /* op(B)^T is packed the same way as op(A) */
+    float *b_packed = (float *)malloc(
+            (size_t)nb_n * nu * k * sizeof(float), PAGE_4K);
+    parallel(nstl::min(max_nthr, nb_n), [&](const int ithr, const int nthr) {
+        int start = 0, end = 0;
+        balance211(nb_n, nthr, ithr, start, end);
+        for (int nt = start; nt < end; nt++) {
+            const int n0 = nt * nu;
+            pack_panel(!transb, nstl::min(nu, n - n0), k,
+                    transb ? b + n0 : b + (size_t)n0 * ldb, ldb, nu,
+                    b_packed + (size_t)n0 * k);
+        }
+    });
+
+    /* the tiles of a thread go along N first, so the A panel stays in
+     * cache while the (small) B is swept */
+    parallel(nstl::min(max_nthr, nb_m * nb_n),
+            [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        balance211((size_t)nb_m * nb_n, nthr, ithr, start, end);
+        float tile[512];
+        assert(mu * nu <= 512);
+
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const int mt = (int)(iwork / nb_n), nt = (int)(iwork % nb_n);
+            const int m0 = mt * mu, m_len = nstl::min(mu, m - m0);
+            const int n0 = nt * nu, n_len = nstl::min(nu, n - n0);
+
+            jit_sgemm_packed_call_s p;
+            p.a = a_packed + (size_t)m0 * k;
+            p.b = b_packed + (size_t)n0 * k;
+            p.k = k;
+
+            float *c_tile = c + m0 + (size_t)n0 * ldc;
+            if (direct_beta && m_len == mu) {
+                p.c = c_tile;
+                p.ldc = ldc * sizeof(float);
+                p.accumulate = beta != 0.f;
+                ker_[n_len - 1](&p);
+                continue;
+            }
+
+            p.c = tile;
+            p.ldc = mu * sizeof(float);
+            p.accumulate = 0;
+            ker_[n_len - 1](&p);
+            for (int jj = 0; jj < n_len; jj++) {
+                float *dst = c_tile + (size_t)jj * ldc;
+                const float *src = tile + jj * mu;
+                for (int ii = 0; ii < m_len; ii++)
+                    dst[ii] = (beta == 0.f ? 0.f : beta * dst[ii]) + src[ii];
+            }
+        }
+    });
+
+    free(b_packed);
+}
+
+}
+}
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_SGEMM_PACKED_HPP
+#define JIT_UNI_SGEMM_PACKED_HPP
+
+#include <stddef.h>
+
+#include "c_types_map.hpp"
+#include "../jit_generator.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+struct jit_sgemm_packed_call_s {
+    const float *a;
+    const float *b;
+    float *c;
+    size_t ldc; /* in bytes */
+    size_t k;
+    size_t accumulate; /* C += A * B instead of C = A * B */
+};
+
+/* C := op(A) * op(B) + beta * C for f32 column-major matrices, where op(A)
+ * is packed once by pack() and reused by any number of compute() calls
+ * (the cblas_sgemm_pack / cblas_sgemm_compute semantics without MKL).
+ *
+ * The packed A is a sequence of panels[m / m_unroll][k][m_unroll] padded with
+ * zeros, B is packed by every compute() call into panels[n / n_unroll][k]
+ * [n_unroll], that is cheap for the small n it is meant for (e.g. the batch
+ * of an rnn cell, while A is its weights). The work is threaded over the
+ * m_unroll x n_unroll tiles of C, the tiles of the N tail are computed by the
+ * kernels of their width. */
+class jit_uni_sgemm_packed {
+public:
+    jit_uni_sgemm_packed();
+    ~jit_uni_sgemm_packed();
+
+    static bool is_applicable() { return mayiuse(avx2); }
+
+    /* size of the packed op(A) in bytes */
+    size_t packed_size(int m, int k) const;
+    void pack(bool transa, int m, int k, const float *a, int lda,
+            float *a_packed) const;
+    void compute(bool transb, int m, int n, int k, const float *a_packed,
+            const float *b, int ldb, float beta, float *c, int ldc) const;
+
+private:
+    template <cpu_isa_t isa> void create_kernel();
+
+    /* a kernel per width of the N tail */
+    static constexpr int max_n_unroll = 12;
+    jit_generator *kern_[max_n_unroll];
+    void (*ker_[max_n_unroll])(const jit_sgemm_packed_call_s *);
+    int m_unroll_, n_unroll_;
+};
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,379 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <limits.h>
+#include <string.h>
+
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "../jit_generator.hpp"
+#include "jit_uni_sparse_sgemm.hpp"
+
+#define GET_OFF(field) offsetof(jit_sparse_sgemm_call_s, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+using namespace mkldnn::impl::utils;
+
+/* Computes a tile of a block of C rows and n_len columns:
+ *   w: [nnz][vlen] values of the kept columns of the block
+ *   off: [nnz] byte offsets of their B rows from b
+ *   b: B element (column, j) at b + off + j * ldb_n
+ *   c: n_len vectors of the block, ldc_n bytes apart
+ * Short tiles split the columns between several accumulator sets, so the
+ * FMA chains stay long enough to hide the latency. */
+template <cpu_isa_t isa>
+struct jit_uni_sparse_sgemm_kern : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_sgemm_kern)
+
+    using Vmm = typename utils::conditional<isa == avx2, Ymm, Zmm>::type;
+
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int n_unroll = isa == avx2 ? 12 : 24;
+    static constexpr int max_k_unroll = 4;
+
+    jit_uni_sparse_sgemm_kern(int n_len, size_t ldb_n, bool accumulate,
+            bool with_relu, float relu_alpha)
+        : jit_generator(nullptr, 16 * 1024), n_len_(n_len)
+        , k_unroll_(nstl::max(1, nstl::min(max_k_unroll, n_unroll / n_len)))
+        , ldb_n_(ldb_n), accumulate_(accumulate), with_relu_(with_relu)
+        , relu_alpha_(relu_alpha) {
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(const_cast<uint8_t*>(
+                       getCode()));
+    }
+
+    void (*ker_)(const jit_sparse_sgemm_call_s *);
+
+private:
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_w = r8;
+    Reg64 reg_off = r9;
+    Reg64 reg_nnz = r10;
+    Reg64 reg_b = r11;
+    Reg64 reg_c = r12;
+    Reg64 reg_ldc = r13;
+    Reg64 reg_b_off = r14;
+    Reg64 reg_tmp = r15;
+
+    int n_len_, k_unroll_;
+    size_t ldb_n_;
+    bool accumulate_, with_relu_;
+    float relu_alpha_;
+
+    Vmm vmm_acc(int u, int j) { return Vmm(u * n_len_ + j); }
+    Vmm vmm_w = Vmm(n_unroll);
+    Vmm vmm_b = Vmm(n_unroll + 1);
+    Vmm vmm_alpha = Vmm(n_unroll + 2);
+
+    void fma_step(int u, int acc_set);
+    void generate();
+};
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_sgemm_kern<isa>::fma_step(int u, int acc_set) {
+    movsxd(reg_b_off, dword[reg_off + u * sizeof(int32_t)]);
+    uni_vmovups(vmm_w, ptr[reg_w + u * vlen]);
+    for (int j = 0; j < n_len_; j++) {
+        const size_t b_off = j * ldb_n_ * sizeof(float);
+        if (isa == avx2) {
+            uni_vbroadcastss(vmm_b, ptr[reg_b + reg_b_off + b_off]);
+            vfmadd231ps(vmm_acc(acc_set, j), vmm_w, vmm_b);
+        } else {
+            vfmadd231ps(vmm_acc(acc_set, j), vmm_w,
+                    ptr_b[reg_b + reg_b_off + b_off]);
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_sgemm_kern<isa>::generate() {
+    preamble();
+
+    mov(reg_w, ptr[reg_param + GET_OFF(w)]);
+    mov(reg_off, ptr[reg_param + GET_OFF(off)]);
+    mov(reg_nnz, ptr[reg_param + GET_OFF(nnz)]);
+    mov(reg_b, ptr[reg_param + GET_OFF(b)]);
+    mov(reg_c, ptr[reg_param + GET_OFF(c)]);
+    mov(reg_ldc, ptr[reg_param + GET_OFF(ldc_n)]);
+
+    mov(reg_tmp, ptr[reg_param + GET_OFF(bias)]);
+    for (int j = 0; j < n_len_; j++)
+        uni_vmovups(vmm_acc(0, j), ptr[reg_tmp]);
+    for (int u = 1; u < k_unroll_; u++)
+        for (int j = 0; j < n_len_; j++)
+            uni_vpxor(vmm_acc(u, j), vmm_acc(u, j), vmm_acc(u, j));
+
+    Label k_loop, k_tail, k_tail_loop, k_done;
+    if (k_unroll_ > 1) {
+        cmp(reg_nnz, k_unroll_);
+        jl(k_tail, T_NEAR);
+        L(k_loop); {
+            for (int u = 0; u < k_unroll_; u++)
+                fma_step(u, u);
+            add(reg_w, k_unroll_ * vlen);
+            add(reg_off, k_unroll_ * sizeof(int32_t));
+            sub(reg_nnz, k_unroll_);
+            cmp(reg_nnz, k_unroll_);
+            jge(k_loop, T_NEAR);
+        }
+    }
+    L(k_tail);
+    cmp(reg_nnz, 0);
+    je(k_done, T_NEAR);
+    L(k_tail_loop); {
+        fma_step(0, 0);
+        add(reg_w, vlen);
+        add(reg_off, sizeof(int32_t));
+        dec(reg_nnz);
+        jnz(k_tail_loop, T_NEAR);
+    }
+    L(k_done);
+
+    for (int u = 1; u < k_unroll_; u++)
+        for (int j = 0; j < n_len_; j++)
+            vaddps(vmm_acc(0, j), vmm_acc(0, j), vmm_acc(u, j));
+
+    if (accumulate_) {
+        mov(reg_tmp, reg_c);
+        for (int j = 0; j < n_len_; j++) {
+            vaddps(vmm_acc(0, j), vmm_acc(0, j), ptr[reg_tmp]);
+            add(reg_tmp, reg_ldc);
+        }
+    }
+
+    if (with_relu_) {
+        if (relu_alpha_ == 0.f) {
+            uni_vpxor(vmm_alpha, vmm_alpha, vmm_alpha);
+            for (int j = 0; j < n_len_; j++)
+                vmaxps(vmm_acc(0, j), vmm_acc(0, j), vmm_alpha);
+        } else {
+            mov(reg_tmp.cvt32(), float2int(relu_alpha_));
+            movd(Xmm(vmm_alpha.getIdx()), reg_tmp.cvt32());
+            vbroadcastss(vmm_alpha, Xmm(vmm_alpha.getIdx()));
+            for (int j = 0; j < n_len_; j++) {
+                vmulps(vmm_b, vmm_acc(0, j), vmm_alpha);
+                vmaxps(vmm_acc(0, j), vmm_acc(0, j), vmm_b);
+            }
+        }
+    }
+
+    for (int j = 0; j < n_len_; j++) {
+        uni_vmovups(ptr[reg_c], vmm_acc(0, j));
+        add(reg_c, reg_ldc);
+    }
+
+    postamble();
+}
+
+namespace {
+int vector_length() {
+    if (mayiuse(avx512_common))
+        return cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+    if (mayiuse(avx2))
+        return cpu_isa_traits<avx2>::vlen / sizeof(float);
+    return 0;
+}
+
+/* the byte offset of element (i, 0) of B or C */
+size_t offset(const jit_uni_sparse_sgemm::layout_t &l, int i) {
+    return ((size_t)(i / l.blk) * l.ld_blk + i % l.blk) * sizeof(float);
+}
+}
+
+bool jit_uni_sparse_sgemm::is_applicable(int m, int k,
+        const layout_t &b_layout, const layout_t &c_layout) {
+    const int vlen = vector_length();
+    if (vlen == 0 || m <= 0 || k <= 0)
+        return false;
+    if (c_layout.blk != m && c_layout.blk % vlen != 0)
+        return false;
+    /* the offsets of the B rows and the columns of a tile are 32-bit */
+    const int n_unroll = vlen == 16 ? 24 : 12;
+    return offset(b_layout, k - 1) <= INT_MAX
+        && (n_unroll - 1) * b_layout.ld_n * sizeof(float) <= INT_MAX;
+}
+
+int jit_uni_sparse_sgemm::block_size() {
+    return vector_length();
+}
+
+float jit_uni_sparse_sgemm::block_density(int m, int k, const float *a,
+        int lda) {
+    const int vlen = vector_length();
+    if (vlen == 0 || m <= 0 || k <= 0)
+        return 1.f;
+    const int nb_m = div_up(m, vlen);
+    size_t nnz = 0;
+    for (int mb = 0; mb < nb_m; mb++) {
+        const int m0 = mb * vlen, m_len = nstl::min(vlen, m - m0);
+        for (int kk = 0; kk < k; kk++) {
+            for (int i = 0; i < m_len; i++) {
+                if (a[(size_t)(m0 + i) * lda + kk] != 0.f) {
+                    nnz++;
+                    break;
+                }
+            }
+        }
+    }
+    return (float)nnz / ((size_t)nb_m * k);
+}
+
+template <int vlen>
+void jit_uni_sparse_sgemm::create_kernels(bool accumulate, bool with_relu,
+        float relu_alpha) {
+    using kern_t = typename utils::conditional<vlen == 16,
+          jit_uni_sparse_sgemm_kern<avx512_common>,
+          jit_uni_sparse_sgemm_kern<avx2>>::type;
+    n_unroll_ = kern_t::n_unroll;
+    for (int n_len = 1; n_len <= n_unroll_; n_len++) {
+        auto kern = new kern_t(n_len, b_layout_.ld_n, accumulate, with_relu,
+                relu_alpha);
+        kern_[n_len - 1] = kern;
+        ker_[n_len - 1] = kern->ker_;
+    }
+}
+
+jit_uni_sparse_sgemm::jit_uni_sparse_sgemm(int m, int k, const float *a,
+        int lda, const float *bias, const layout_t &b_layout,
+        const layout_t &c_layout, bool accumulate, bool with_relu,
+        float relu_alpha)
+    : m_(m), vlen_(vector_length()), n_unroll_(0)
+    , nb_m_(div_up(m, vector_length())), b_layout_(b_layout)
+    , c_layout_(c_layout), accumulate_(accumulate) {
+    assert(is_applicable(m, k, b_layout, c_layout));
+    for (int i = 0; i < max_n_unroll; i++) {
+        kern_[i] = nullptr;
+        ker_[i] = nullptr;
+    }
+    if (vlen_ == 16)
+        create_kernels<16>(accumulate, with_relu, relu_alpha);
+    else
+        create_kernels<8>(accumulate, with_relu, relu_alpha);
+
+    blk_start_ = (size_t *)malloc((nb_m_ + 1) * sizeof(size_t), 64);
+    blk_start_[0] = 0;
+    for (int mb = 0; mb < nb_m_; mb++) {
+        const int m0 = mb * vlen_, m_len = nstl::min(vlen_, m - m0);
+        size_t nnz = 0;
+        for (int kk = 0; kk < k; kk++) {
+            for (int i = 0; i < m_len; i++) {
+                if (a[(size_t)(m0 + i) * lda + kk] != 0.f) {
+                    nnz++;
+                    break;
+                }
+            }
+        }
+        blk_start_[mb + 1] = blk_start_[mb] + nnz;
+    }
+
+    const size_t nnz = blk_start_[nb_m_];
+    w_ = (float *)malloc(nstl::max<size_t>(nnz, 1) * vlen_ * sizeof(float),
+            PAGE_4K);
+    off_ = (int32_t *)malloc(nstl::max<size_t>(nnz, 1) * sizeof(int32_t),
+            64);
+    bias_ = (float *)malloc((size_t)nb_m_ * vlen_ * sizeof(float), 64);
+
+    parallel_nd(nb_m_, [&](int mb) {
+        const int m0 = mb * vlen_, m_len = nstl::min(vlen_, m - m0);
+        size_t pos = blk_start_[mb];
+        for (int kk = 0; kk < k; kk++) {
+            bool is_zero = true;
+            for (int i = 0; i < m_len; i++)
+                is_zero = is_zero && a[(size_t)(m0 + i) * lda + kk] == 0.f;
+            if (is_zero)
+                continue;
+            float *w = w_ + pos * vlen_;
+            for (int i = 0; i < vlen_; i++)
+                w[i] = i < m_len ? a[(size_t)(m0 + i) * lda + kk] : 0.f;
+            off_[pos] = (int32_t)offset(b_layout_, kk);
+            pos++;
+        }
+        for (int i = 0; i < vlen_; i++)
+            bias_[m0 + i] = bias != nullptr && i < m_len ? bias[m0 + i] : 0.f;
+    });
+}
+
+jit_uni_sparse_sgemm::~jit_uni_sparse_sgemm() {
+    for (int i = 0; i < max_n_unroll; i++)
+        delete kern_[i];
+    free(w_);
+    free(off_);
+    free(blk_start_);
+    free(bias_);
+}
+
+void jit_uni_sparse_sgemm::compute(int n, const float *b, float *c) const {
+    const int mu = vlen_, nu = n_unroll_;
+    const int nb_n = div_up(n, nu);
+    const size_t work_amount = (size_t)nb_n * nb_m_;
+
+    /* no nested threading when called from a parallel region */
+    const int max_nthr = mkldnn_in_parallel() ? 1 : mkldnn_get_max_threads();
+
+    /* the blocks of a thread go along M first, so its B columns stay in
+     * cache while the compressed A is streamed */
+    parallel((int)nstl::min<size_t>(max_nthr, work_amount),
+            [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        float tile[16 * max_n_unroll];
+
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const int nt = (int)(iwork / nb_m_), mb = (int)(iwork % nb_m_);
+            const int m0 = mb * mu, m_len = nstl::min(mu, m_ - m0);
+            const int n0 = nt * nu, n_len = nstl::min(nu, n - n0);
+
+            jit_sparse_sgemm_call_s p;
+            p.w = w_ + blk_start_[mb] * mu;
+            p.off = off_ + blk_start_[mb];
+            p.nnz = blk_start_[mb + 1] - blk_start_[mb];
+            p.b = b + (size_t)n0 * b_layout_.ld_n;
+            p.bias = bias_ + m0;
+
+            float *c_tile = (float *)((char *)c + offset(c_layout_, m0))
+                + (size_t)n0 * c_layout_.ld_n;
+            if (m_len == mu) {
+                p.c = c_tile;
+                p.ldc_n = c_layout_.ld_n * sizeof(float);
+                ker_[n_len - 1](&p);
+                continue;
+            }
+
+            /* the tail of a whole C block goes through a full-width tile */
+            for (int j = 0; j < n_len; j++) {
+                for (int i = 0; i < mu; i++)
+                    tile[j * mu + i] = accumulate_ && i < m_len
+                        ? c_tile[(size_t)j * c_layout_.ld_n + i] : 0.f;
+            }
+            p.c = tile;
+            p.ldc_n = mu * sizeof(float);
+            ker_[n_len - 1](&p);
+            for (int j = 0; j < n_len; j++)
+                memcpy(c_tile + (size_t)j * c_layout_.ld_n, tile + j * mu,
+                        m_len * sizeof(float));
+        }
+    });
+}
+
+}
+}
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_SPARSE_SGEMM_HPP
+#define JIT_UNI_SPARSE_SGEMM_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+class jit_generator;
+
+struct jit_sparse_sgemm_call_s {
+    const float *w; /* the value vectors of the non-zero blocks */
+    const int32_t *off; /* the byte offsets of their B rows */
+    size_t nnz;
+    const float *b;
+    float *c;
+    size_t ldc_n; /* in bytes */
+    const float *bias;
+};
+
+/* C := A * B + bias [+ C] [ReLU] for a sparse f32 m x k matrix A that is
+ * compressed once and reused by any number of compute() calls (the weights
+ * of a pruned FullyConnected or 1x1 convolution).
+ *
+ * The rows of A are split into blocks of the vector length (16 for avx512,
+ * 8 for avx2) and a block keeps only its columns with a non-zero value: the
+ * vector of the column values and the byte offset of the B row the column
+ * multiplies. A C tile of a block and up to n_unroll columns is accumulated in
+ * registers, each kept column costs one vector load and an FMA with a
+ * broadcast B value per C column.
+ *
+ * Element (i, j) of B and C is at (i / blk) * ld_blk + i % blk + j * ld_n of
+ * their layouts, so both the rows of FullyConnected activations (blk = k or m,
+ * ld_n = row length) and the pixels of nChw8c/nChw16c tensors (blk = 8/16,
+ * ld_blk = H * W * blk, ld_n = blk) are handled. The blocks of C must be
+ * either whole or a multiple of the vector length.
+ *
+ * ReLU is max(x, alpha * x), so the negative slope must be in [0, 1]. */
+class jit_uni_sparse_sgemm {
+public:
+    struct layout_t {
+        int blk;
+        size_t ld_blk;
+        size_t ld_n;
+    };
+
+    jit_uni_sparse_sgemm(int m, int k, const float *a, int lda,
+            const float *bias, const layout_t &b_layout,
+            const layout_t &c_layout, bool accumulate, bool with_relu,
+            float relu_alpha);
+    ~jit_uni_sparse_sgemm();
+
+    static bool is_applicable(int m, int k, const layout_t &b_layout,
+            const layout_t &c_layout);
+    /* the number of rows of a block */
+    static int block_size();
+    /* the share of the blocks with a non-zero value in a m x k matrix */
+    static float block_density(int m, int k, const float *a, int lda);
+
+    /* the number of kept blocks */
+    size_t nnz() const { return blk_start_[nb_m_]; }
+
+    void compute(int n, const float *b, float *c) const;
+
+private:
+    template <int vlen> void create_kernels(bool accumulate, bool with_relu,
+            float relu_alpha);
+
+    static constexpr int max_n_unroll = 24;
+    jit_generator *kern_[max_n_unroll];
+    void (*ker_[max_n_unroll])(const jit_sparse_sgemm_call_s *);
+
+    int m_, vlen_, n_unroll_, nb_m_;
+    layout_t b_layout_, c_layout_;
+    bool accumulate_;
+
+    float *w_;
+    int32_t *off_;
+    size_t *blk_start_;
+    float *bias_;
+};
+
+}
+}
+}
+
+#endif
@@ -28,7 +28,6 @@ using namespace memory_format;
 
 template <data_type_t dst_type>
 void gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
-#if USE_MKL_IGEMM
     auto src = reinterpret_cast<const src_data_t *>(this->input_memory(0));
     auto weights = reinterpret_cast<const wei_data_t *>(this->input_memory(1));
     auto bias = reinterpret_cast<const char *>(this->input_memory(2));
@@ -72,9 +71,10 @@ void gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
         return 0;
     };
 
-    cblas_gemm_s8u8s32(CblasColMajor, wei_tr ? CblasTrans : CblasNoTrans,
-            CblasNoTrans, CblasFixOffset, M, N, K, 1., weights,
-            wei_tr ? K : M, off_a, src, K, off_b, 0., acc, M, &off_c);
+    const float alpha = 1.0f, beta = 0.0f;
+    const int lda = wei_tr ? K : M;
+    gemm_s8x8s32(wei_tr ? "T" : "N", "N", "F", &M, &N, &K, &alpha, weights,
+            &lda, &off_a, src, &K, &off_b, &beta, acc, &M, &off_c);
 
     parallel_nd(MB, OC, [&](int mb, int oc) {
         size_t dst_off = mb * OC + oc;
@@ -86,7 +86,6 @@ void gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
             d *= nslope;
         dst[dst_off] = qz_a1b0<float, dst_data_t>()(d, rmode);
     });
-#endif
 }
 
 using namespace data_type;
@@ -26,6 +26,8 @@
 #include "utils.hpp"
 #include "scratchpad.hpp"
 
+#include "cpu_isa_traits.hpp"
+#include "gemm/gemm.hpp"
 #include "gemm/os_blas.hpp"
 
 namespace mkldnn {
@@ -49,9 +51,7 @@ struct gemm_u8s8s32x_inner_product_fwd_t: public cpu_primitive_t {
             assert(engine()->kind() == engine_kind::cpu);
 
             bool ok = true
-#if !USE_MKL_IGEMM
-                && false
-#endif
+                && IMPLICATION(!USE_MKL_IGEMM, mayiuse(avx2))
                 && this->set_default_params() == status::success
                 && one_of(desc()->prop_kind, prop_kind::forward_training,
                         prop_kind::forward_inference)
@@ -23,6 +23,8 @@
 #include "jit_primitive_conf.hpp"
 #include "gemm_convolution_utils.hpp"
 
+#include "cpu_isa_traits.hpp"
+#include "gemm/gemm.hpp"
 #include "gemm/os_blas.hpp"
 
 namespace mkldnn {
@@ -48,9 +50,7 @@ struct _gemm_x8s8s32x_convolution_fwd_t: public cpu_primitive_t {
             assert(this->engine()->kind() == engine_kind::cpu);
 
             bool ok = true
-#if !USE_MKL_IGEMM
-                && false
-#endif
+                && IMPLICATION(!USE_MKL_IGEMM, mayiuse(avx2))
                 && this->set_default_params() == status::success
                 && utils::one_of(this->cdesc_().prop_kind,
                         prop_kind::forward_training,
@@ -176,9 +176,7 @@ struct _gemm_u8s8s32x_convolution_bwd_data_t: public cpu_primitive_t {
             assert(this->engine()->kind() == engine_kind::cpu);
 
             bool ok = true
-#if !USE_MKL_IGEMM
-                && false
-#endif
+                && IMPLICATION(!USE_MKL_IGEMM, mayiuse(avx2))
                 && this->set_default_params() == status::success
                 && this->desc()->prop_kind == prop_kind::backward_data
                 && this->desc()->alg_kind == alg_kind::convolution_direct
@@ -0,0 +1,646 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "cpu_convolution_pd.hpp"
+#include "cpu_engine.hpp"
+#include "mkldnn_thread.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_avx2_fp32_wino_conv.hpp"
+#include "jit_generator.hpp"
+
+#define GET_OFF(field) offsetof( \
+    jit_avx2_fp32_wino_conv_fwd_ker_t::call_params_t, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::memory_format;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+namespace {
+/* F(4x4, 3x3) is not used for deeper inputs: the error of its transforms
+ * accumulated over ic exceeds the one of the direct convolution noticeably */
+const int max_ic_4x3 = 1024;
+/* the transformed weights are alpha^2 / r^2 times larger than the direct
+ * ones and are read for every tile block, so a few tiles do not pay it off
+ * (e.g. 7x7 outputs of resnet_50 res5 with batch 1 are slower than jit:avx2) */
+const int min_tiles = 8;
+const int simd_w = 8;
+}
+
+/// GEMM kernel ///////////////////////////////////////////////////////////////
+struct jit_avx2_fp32_wino_conv_fwd_ker_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_fp32_wino_conv_fwd_ker_t)
+
+    struct call_params_t {
+        const float *src;
+        const float *wei;
+        float *dst;
+        size_t m_groups;
+    };
+    void (*ker_)(const call_params_t *);
+
+    static bool post_ops_ok(jit_conv_conf_avx2_wino_t &jcp,
+            const primitive_attr_t &attr);
+
+    static status_t init_conf(
+            jit_conv_conf_avx2_wino_t &jcp, const convolution_desc_t &cd,
+            cpu_memory_t::pd_t &src_pd, cpu_memory_t::pd_t &wei_pd,
+            cpu_memory_t::pd_t &dst_pd, cpu_memory_t::pd_t &bias_pd,
+            const primitive_attr_t &attr, bool with_relu,
+            float relu_negative_slope, memory_desc_t &expect_wei_md);
+
+    jit_avx2_fp32_wino_conv_fwd_ker_t(jit_conv_conf_avx2_wino_t ajcp)
+        : jcp(ajcp) {
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(
+                const_cast<uint8_t *>(getCode()));
+    }
+
+    jit_conv_conf_avx2_wino_t jcp;
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+
+    void generate();
+
+    /* tile block of src and dst rows of the gemm is processed by groups of
+     * m_unroll rows, k is unrolled by simd_w */
+    Ymm vreg_acc(int m, int n) {
+        assert(m < jcp.m_unroll && n < jcp.n2_block);
+        return Ymm(m * jcp.n2_block + n);
+    }
+    Ymm vreg_wei(int n) {
+        assert(n < jcp.n2_block);
+        return Ymm(jcp.m_unroll * jcp.n2_block + n);
+    }
+    Ymm vreg_src = Ymm(15);
+
+    reg64_t reg_src = r8;
+    reg64_t reg_wei = r9;
+    reg64_t reg_dst = r10;
+    reg64_t reg_m_groups = r11;
+    reg64_t reg_aux_src = r12;
+    reg64_t reg_aux_wei = r13;
+    reg64_t reg_k = r14;
+};
+
+void jit_avx2_fp32_wino_conv_fwd_ker_t::generate() {
+    Label m_loop_label, k_loop_label;
+    const int typesize = sizeof(float);
+
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_wei, ptr[param1 + GET_OFF(wei)]);
+    mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+    mov(reg_m_groups, ptr[param1 + GET_OFF(m_groups)]);
+
+    L(m_loop_label);
+    {
+        for (int m = 0; m < jcp.m_unroll; m++)
+            for (int n = 0; n < jcp.n2_block; n++)
+                vxorps(vreg_acc(m, n), vreg_acc(m, n), vreg_acc(m, n));
+
+        mov(reg_aux_src, reg_src);
+        mov(reg_aux_wei, reg_wei);
+        mov(reg_k, jcp.ic / simd_w);
+
+        L(k_loop_label);
+        {
+            for (int k = 0; k < simd_w; k++) {
+                for (int n = 0; n < jcp.n2_block; n++)
+                    vmovups(vreg_wei(n), ptr[reg_aux_wei + typesize
+                            * (k * jcp.wei_ic_stride + n * jcp.wei_ob_stride)]);
+                for (int m = 0; m < jcp.m_unroll; m++) {
+                    vbroadcastss(vreg_src,
+                            ptr[reg_aux_src + typesize * (m * jcp.ic + k)]);
+                    for (int n = 0; n < jcp.n2_block; n++)
+                        vfmadd231ps(vreg_acc(m, n), vreg_wei(n), vreg_src);
+                }
+            }
+            add(reg_aux_src, typesize * simd_w);
+            add(reg_aux_wei, typesize * simd_w * jcp.wei_ic_stride);
+            dec(reg_k);
+            jnz(k_loop_label, T_NEAR);
+        }
+
+        for (int m = 0; m < jcp.m_unroll; m++)
+            for (int n = 0; n < jcp.n2_block; n++)
+                vmovups(ptr[reg_dst + typesize
+                        * (m * jcp.oc + n * jcp.oc_block)], vreg_acc(m, n));
+
+        add(reg_src, typesize * jcp.m_unroll * jcp.ic);
+        add(reg_dst, typesize * jcp.m_unroll * jcp.oc);
+        dec(reg_m_groups);
+        jnz(m_loop_label, T_NEAR);
+    }
+
+    postamble();
+}
+
+bool jit_avx2_fp32_wino_conv_fwd_ker_t::post_ops_ok(
+        jit_conv_conf_avx2_wino_t &jcp, const primitive_attr_t &attr) {
+    const auto &p = attr.post_ops_;
+
+    auto is_relu = [&](int idx) { return p.entry_[idx].is_relu(true, false); };
+    auto is_sum = [&](int idx) { return p.entry_[idx].is_sum(false); };
+
+    switch (p.len_) {
+    case 0: return true;
+    case 1: return true
+                && IMPLICATION(jcp.with_relu, is_sum(0))
+                && IMPLICATION(!jcp.with_relu, is_relu(0) || is_sum(0));
+    case 2: return true
+                && IMPLICATION(jcp.with_relu, is_sum(0) && is_relu(1))
+                && IMPLICATION(!jcp.with_relu, false
+                        || (is_sum(0) && is_relu(1))
+                        || (is_relu(0) && is_sum(1)));
+    case 3: return true
+                && jcp.with_relu == false
+                && (is_relu(0) && is_sum(1) && is_relu(2));
+    default: return false;
+    }
+
+    return false;
+}
+
+status_t jit_avx2_fp32_wino_conv_fwd_ker_t::init_conf(
+        jit_conv_conf_avx2_wino_t &jcp, const convolution_desc_t &cd,
+        cpu_memory_t::pd_t &src_pd, cpu_memory_t::pd_t &wei_pd,
+        cpu_memory_t::pd_t &dst_pd, cpu_memory_t::pd_t &bias_pd,
+        const primitive_attr_t &attr, bool with_relu, float relu_negative_slope,
+        memory_desc_t &expect_wei_md) {
+    if (!mayiuse(avx2))
+        return status::unimplemented;
+
+    const memory_desc_wrapper src_d(&src_pd);
+    const memory_desc_wrapper wei_d(&wei_pd);
+    const memory_desc_wrapper dst_d(&dst_pd);
+    const memory_desc_wrapper bias_d(&bias_pd);
+
+    const bool with_groups = wei_d.ndims() == src_d.ndims() + 1;
+    if (with_groups && wei_d.dims()[0] != 1)
+        return status::unimplemented;
+
+    jcp.mb = src_d.dims()[0];
+    jcp.oc = dst_d.dims()[1];
+    jcp.oc_without_padding = jcp.oc;
+    jcp.ic = src_d.dims()[1];
+    jcp.ih = src_d.dims()[2];
+    jcp.iw = src_d.dims()[3];
+    jcp.oh = dst_d.dims()[2];
+    jcp.ow = dst_d.dims()[3];
+    jcp.kh = wei_d.dims()[with_groups + 2];
+    jcp.kw = wei_d.dims()[with_groups + 3];
+    jcp.t_pad = cd.padding[0][0];
+    jcp.l_pad = cd.padding[0][1];
+    jcp.stride_h = cd.strides[0];
+    jcp.stride_w = cd.strides[1];
+    jcp.dilate_h = cd.dilates[0];
+    jcp.dilate_w = cd.dilates[1];
+
+    jcp.r = 3;
+    jcp.with_bias = cd.bias_desc.format != memory_format::undef;
+    jcp.with_relu = with_relu;
+    jcp.relu_negative_slope = relu_negative_slope;
+    if (!post_ops_ok(jcp, attr))
+        return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    const int sum_idx = p.find(primitive_kind::sum);
+    jcp.with_sum = sum_idx != -1;
+    jcp.sum_scale = jcp.with_sum ? p.entry_[sum_idx].sum.scale : 1.f;
+    jcp.with_relu_postsum = false;
+    jcp.relu_postsum_negative_slope = 0.f;
+    for (int i = 0; i < p.len_; i++) {
+        if (!p.entry_[i].is_relu(true, false))
+            continue;
+        if (jcp.with_sum && i > sum_idx) {
+            jcp.with_relu_postsum = true;
+            jcp.relu_postsum_negative_slope = p.entry_[i].eltwise.alpha;
+        } else {
+            jcp.with_relu = true;
+            jcp.relu_negative_slope = p.entry_[i].eltwise.alpha;
+        }
+    }
+
+    jcp.oc = rnd_up(jcp.oc, simd_w);
+    jcp.ic = rnd_up(jcp.ic, simd_w);
+
+    if (src_d.format() != nChw8c
+            || dst_d.format() != nChw8c
+            || !IMPLICATION(jcp.with_bias, bias_d.format() == x))
+        return status::unimplemented;
+
+    bool ok = true && jcp.kh == 3 && jcp.kw == 3
+            && jcp.stride_h == 1 && jcp.stride_w == 1
+            && jcp.dilate_h == 0 && jcp.dilate_w == 0
+            && jcp.t_pad >= 0 && jcp.t_pad < jcp.kh
+            && jcp.l_pad >= 0 && jcp.l_pad < jcp.kw
+            && jcp.oh == jcp.ih + jcp.t_pad + cd.padding[1][0] - jcp.kh + 1
+            && jcp.ow == jcp.iw + jcp.l_pad + cd.padding[1][1] - jcp.kw + 1;
+    if (!ok)
+        return status::unimplemented;
+
+    /* F(4x4, 3x3) needs 2.25 times less multiplications per output than
+     * F(2x2, 3x3), but does more work on the tiles out of the image */
+    auto gemm_work = [&](int m) {
+        const int alpha = m + jcp.r - 1;
+        return (float)div_up(jcp.oh, m) * div_up(jcp.ow, m) * alpha * alpha;
+    };
+    jcp.m = (jcp.ic <= max_ic_4x3 && gemm_work(4) < gemm_work(2)) ? 4 : 2;
+    jcp.alpha = jcp.m + jcp.r - 1;
+
+    jcp.ic_block = simd_w;
+    jcp.oc_block = simd_w;
+    jcp.nb_ic = jcp.ic / jcp.ic_block;
+    jcp.nb_oc = jcp.oc / jcp.oc_block;
+
+    jcp.tile_h = div_up(jcp.oh, jcp.m);
+    jcp.tile_w = div_up(jcp.ow, jcp.m);
+    jcp.ntiles = jcp.tile_h * jcp.tile_w;
+    if (jcp.mb * jcp.ntiles < min_tiles)
+        return status::unimplemented;
+
+    /* 16 ymm registers: m_unroll x n2_block accumulators,
+     * n2_block weights and a broadcast src */
+    float best_eff = 0.f;
+    for (int n2 = 1; n2 <= 4; n2++) {
+        if (jcp.nb_oc % n2)
+            continue;
+        int mu = nstl::min((15 - n2) / n2, jcp.ntiles);
+        float eff = (float)mu * n2 / (mu + n2);
+        if (eff > best_eff) {
+            best_eff = eff;
+            jcp.m_unroll = mu;
+            jcp.n2_block = n2;
+        }
+    }
+    jcp.n_chunks = jcp.nb_oc / jcp.n2_block;
+
+    /* transformed src and dst of a tile block are to stay in L2, and the
+     * tile block is to be large enough to amortize the weights reading */
+    const int aa = jcp.alpha * jcp.alpha;
+    const int L2_cap = get_cache_size(2, true) / sizeof(float);
+    const int nthr = mkldnn_get_max_threads();
+    const int max_tile_block = rnd_up(jcp.ntiles, jcp.m_unroll);
+    const int min_tile_block = nstl::min(max_tile_block, 4 * jcp.m_unroll);
+    int tile_block = rnd_dn(L2_cap / (aa * (jcp.ic + jcp.oc)), jcp.m_unroll);
+    tile_block = nstl::max(min_tile_block,
+            nstl::min(max_tile_block, tile_block));
+    while (tile_block > jcp.m_unroll
+            && jcp.mb * div_up(jcp.ntiles, tile_block) < nthr)
+        tile_block -= jcp.m_unroll;
+    jcp.tile_block = tile_block;
+    jcp.nb_tile_blocks = div_up(jcp.ntiles, jcp.tile_block);
+
+    /* re-create weights primitive descriptor
+                                    and set weights wino_blocking */
+    expect_wei_md.format = mkldnn_wino_fmt;
+    expect_wei_md.data_type = data_type::f32;
+    mkldnn_wino_desc_t &wd = expect_wei_md.layout_desc.wino_desc;
+    wd.r = jcp.r;
+    wd.alpha = jcp.alpha;
+    wd.ic = jcp.ic;
+    wd.oc = jcp.oc;
+    wd.ic_block = jcp.ic_block;
+    wd.oc_block = jcp.oc_block;
+    wd.oc2_block = jcp.n2_block;
+    wd.adj_scale = 1.f;
+    if (jcp.m == 2) {
+        wd.wino_format = mkldnn_wino_wei_aaOBiOo;
+        wd.ic2_block = 1;
+        jcp.wei_ic_stride = jcp.n2_block * jcp.oc_block;
+        jcp.wei_ob_stride = jcp.oc_block;
+    } else {
+        wd.wino_format = mkldnn_wino_wei_OBaaIBOIio;
+        wd.ic2_block = jcp.nb_ic;
+        jcp.wei_ic_stride = jcp.oc_block;
+        jcp.wei_ob_stride = jcp.ic * jcp.oc_block;
+    }
+    jcp.wino_format = wd.wino_format;
+    wd.size = sizeof(float) * aa * jcp.ic * jcp.oc;
+
+    return status::success;
+}
+
+/// Transforms ////////////////////////////////////////////////////////////////
+/* 1D transforms of simd_w channels of alpha (src) or alpha -> m (dst) points
+ * which are given with strides, the 2D transforms are done by rows and then by
+ * columns. The constants of F(4x4, 3x3) match G in the wino reorder. */
+namespace {
+template <int m>
+void trans_src_1d(float *o, int os, const float *i, int is);
+
+template <>
+void trans_src_1d<2>(float *o, int os, const float *i, int is) {
+    PRAGMA_OMP_SIMD()
+    for (int v = 0; v < simd_w; v++) {
+        const float i0 = i[v], i1 = i[is + v], i2 = i[2 * is + v],
+                i3 = i[3 * is + v];
+        o[v] = i0 - i2;
+        o[os + v] = i1 + i2;
+        o[2 * os + v] = i2 - i1;
+        o[3 * os + v] = i1 - i3;
+    }
+}
+
+template <>
+void trans_src_1d<4>(float *o, int os, const float *i, int is) {
+    PRAGMA_OMP_SIMD()
+    for (int v = 0; v < simd_w; v++) {
+        const float i0 = i[v], i1 = i[is + v], i2 = i[2 * is + v],
+                i3 = i[3 * is + v], i4 = i[4 * is + v], i5 = i[5 * is + v];
+        const float t0 = i2 * -2.25f + i4;
+        const float t1 = i1 * -2.25f + i3;
+        const float t2 = i2 * -0.390625f + i4;
+        const float t3 = i1 * -0.390625f + i3;
+        const float t4 = i0 * 0.87890625f + i4;
+        const float t5 = i1 * 0.87890625f + i5;
+
+        o[v] = i2 * -2.640625f + t4;
+        o[os + v] = t1 * 0.625f + t0;
+        o[2 * os + v] = t1 * -0.625f + t0;
+        o[3 * os + v] = t3 * 1.5f + t2;
+        o[4 * os + v] = t3 * -1.5f + t2;
+        o[5 * os + v] = i3 * -2.640625f + t5;
+    }
+}
+
+template <int m>
+void trans_dst_1d(float *o, int os, const float *i, int is);
+
+template <>
+void trans_dst_1d<2>(float *o, int os, const float *i, int is) {
+    PRAGMA_OMP_SIMD()
+    for (int v = 0; v < simd_w; v++) {
+        const float i0 = i[v], i1 = i[is + v], i2 = i[2 * is + v],
+                i3 = i[3 * is + v];
+        o[v] = i0 + i1 + i2;
+        o[os + v] = i1 - i2 - i3;
+    }
+}
+
+template <>
+void trans_dst_1d<4>(float *o, int os, const float *i, int is) {
+    PRAGMA_OMP_SIMD()
+    for (int v = 0; v < simd_w; v++) {
+        const float i0 = i[v], i1 = i[is + v], i2 = i[2 * is + v],
+                i3 = i[3 * is + v], i4 = i[4 * is + v], i5 = i[5 * is + v];
+        const float t0 = i1 + i2;
+        const float t1 = i3 + i4;
+        const float t2 = i1 - i2;
+        const float t3 = i3 - i4;
+
+        o[v] = t0 + t1 + i0;
+        o[os + v] = t2 * 0.625f + t3 * 1.5f;
+        o[2 * os + v] = t0 * 0.390625f + t1 * 2.25f;
+        o[3 * os + v] = t2 * 0.244140625f + t3 * 3.375f + i5;
+    }
+}
+
+/* wino_src is [alpha * alpha][tile_block][ic], the rows of the padded tail
+ * of the tile block are zeroed as the gemm computes them as well */
+template <int m>
+void src_transform_tiles(const jit_conv_conf_avx2_wino_t &jcp,
+        const float *src, float *wino_src, int img, int tile_start,
+        int ntiles) {
+    constexpr int alpha = m + 2;
+    const int u_stride = jcp.tile_block * jcp.ic;
+    float I[alpha][alpha][simd_w];
+    float T[alpha][alpha][simd_w];
+
+    for (int tl = 0; tl < rnd_up(ntiles, jcp.m_unroll); tl++) {
+        if (tl >= ntiles) {
+            for (int u = 0; u < alpha * alpha; u++)
+                array_set(wino_src + u * u_stride + tl * jcp.ic, 0.f, jcp.ic);
+            continue;
+        }
+        const int tile = tile_start + tl;
+        const int y0 = (tile / jcp.tile_w) * m - jcp.t_pad;
+        const int x0 = (tile % jcp.tile_w) * m - jcp.l_pad;
+
+        for (int icb = 0; icb < jcp.nb_ic; icb++) {
+            const float *s = src
+                    + (size_t)(img * jcp.nb_ic + icb) * jcp.ih * jcp.iw
+                            * simd_w;
+            for (int i = 0; i < alpha; i++) {
+                const int y = y0 + i;
+                for (int j = 0; j < alpha; j++) {
+                    const int x = x0 + j;
+                    const bool inside = y >= 0 && y < jcp.ih
+                            && x >= 0 && x < jcp.iw;
+                    const float *sp = s + (y * jcp.iw + x) * simd_w;
+                    PRAGMA_OMP_SIMD()
+                    for (int v = 0; v < simd_w; v++)
+                        I[i][j][v] = inside ? sp[v] : 0.f;
+                }
+            }
+
+            for (int j = 0; j < alpha; j++)
+                trans_src_1d<m>(&T[0][j][0], alpha * simd_w,
+                        &I[0][j][0], alpha * simd_w);
+            for (int i = 0; i < alpha; i++)
+                trans_src_1d<m>(wino_src + i * alpha * u_stride
+                        + tl * jcp.ic + icb * simd_w, u_stride,
+                        &T[i][0][0], simd_w);
+        }
+    }
+}
+
+/* wino_dst is [alpha * alpha][tile_block][oc] */
+template <int m>
+void dst_transform_tiles(const jit_conv_conf_avx2_wino_t &jcp,
+        const float *wino_dst, float *dst, const float *bia, int img,
+        int tile_start, int ntiles) {
+    constexpr int alpha = m + 2;
+    const int u_stride = jcp.tile_block * jcp.oc;
+    float T[alpha][m][simd_w];
+    float O[m][m][simd_w];
+
+    for (int tl = 0; tl < ntiles; tl++) {
+        const int tile = tile_start + tl;
+        const int y0 = (tile / jcp.tile_w) * m;
+        const int x0 = (tile % jcp.tile_w) * m;
+
+        for (int ocb = 0; ocb < jcp.nb_oc; ocb++) {
+            const float *w = wino_dst + tl * jcp.oc + ocb * simd_w;
+            for (int i = 0; i < alpha; i++)
+                trans_dst_1d<m>(&T[i][0][0], simd_w,
+                        w + i * alpha * u_stride, u_stride);
+            for (int j = 0; j < m; j++)
+                trans_dst_1d<m>(&O[0][j][0], m * simd_w,
+                        &T[0][j][0], m * simd_w);
+
+            float *d = dst
+                    + (size_t)(img * jcp.nb_oc + ocb) * jcp.oh * jcp.ow
+                            * simd_w;
+            const float *b = jcp.with_bias ? bia + ocb * simd_w : nullptr;
+            for (int i = 0; i < m && y0 + i < jcp.oh; i++) {
+                for (int j = 0; j < m && x0 + j < jcp.ow; j++) {
+                    float *dp = d + ((y0 + i) * jcp.ow + x0 + j) * simd_w;
+                    PRAGMA_OMP_SIMD()
+                    for (int v = 0; v < simd_w; v++) {
+                        float val = O[i][j][v];
+                        if (jcp.with_bias)
+                            val += b[v];
+                        if (jcp.with_relu && val < 0)
+                            val *= jcp.relu_negative_slope;
+                        if (jcp.with_sum)
+                            val += jcp.sum_scale * dp[v];
+                        if (jcp.with_relu_postsum && val < 0)
+                            val *= jcp.relu_postsum_negative_slope;
+                        dp[v] = val;
+                    }
+                }
+            }
+        }
+    }
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <bool with_relu>
+status_t _jit_avx2_fp32_wino_conv_fwd_t<with_relu>
+    ::pd_t::jit_conf(memory_desc_t& expect_wei_md) {
+    return jit_avx2_fp32_wino_conv_fwd_ker_t::init_conf(
+            jcp_, this->cdesc_(), this->src_pd_, this->weights_pd_,
+            this->dst_pd_, this->bias_pd_, *this->attr(),
+            with_relu, this->negative_slope(), expect_wei_md);
+}
+
+template <bool with_relu>
+_jit_avx2_fp32_wino_conv_fwd_t<with_relu>::
+        _jit_avx2_fp32_wino_conv_fwd_t(const pd_t *pd,
+                const input_vector &inputs, const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs)
+    , conf_(*pd), padded_bias_(nullptr) {
+    const auto &jcp = conf_.jcp_;
+    const int nthreads = mkldnn_get_max_threads();
+    kernel_ = new jit_avx2_fp32_wino_conv_fwd_ker_t(jcp);
+
+    const size_t aa = jcp.alpha * jcp.alpha;
+    size_wino_src = aa * jcp.tile_block * jcp.ic;
+    size_wino_dst = aa * jcp.tile_block * jcp.oc;
+
+    wino_src_ = (float *)malloc(sizeof(float) * nthreads * size_wino_src, 4096);
+    wino_dst_ = (float *)malloc(sizeof(float) * nthreads * size_wino_dst, 4096);
+    if (conf_.want_padded_bias()) {
+        padded_bias_ = (float *)malloc(sizeof(float) * jcp.oc, 64);
+        for (int oc = jcp.oc_without_padding; oc < jcp.oc; ++oc)
+            padded_bias_[oc] = 0;
+    }
+}
+
+template <bool with_relu>
+_jit_avx2_fp32_wino_conv_fwd_t<with_relu>
+    ::~_jit_avx2_fp32_wino_conv_fwd_t() {
+    delete kernel_;
+
+    free(wino_src_);
+    free(wino_dst_);
+    free(padded_bias_);
+}
+
+template <bool with_relu>
+void _jit_avx2_fp32_wino_conv_fwd_t<with_relu>::src_transform(
+        const float *src, float *wino_src, int img, int tile_start,
+        int ntiles) const {
+    const auto &jcp = kernel_->jcp;
+    if (jcp.m == 2)
+        src_transform_tiles<2>(jcp, src, wino_src, img, tile_start, ntiles);
+    else
+        src_transform_tiles<4>(jcp, src, wino_src, img, tile_start, ntiles);
+}
+
+template <bool with_relu>
+void _jit_avx2_fp32_wino_conv_fwd_t<with_relu>::dst_transform(
+        const float *wino_dst, float *dst, const float *bia, int img,
+        int tile_start, int ntiles) const {
+    const auto &jcp = kernel_->jcp;
+    if (jcp.m == 2)
+        dst_transform_tiles<2>(jcp, wino_dst, dst, bia, img, tile_start,
+                ntiles);
+    else
+        dst_transform_tiles<4>(jcp, wino_dst, dst, bia, img, tile_start,
+                ntiles);
+}
+
+template <bool with_relu>
+void _jit_avx2_fp32_wino_conv_fwd_t<with_relu>::execute_forward() {
+    auto src = reinterpret_cast<const float *>(input_memory(0));
+    auto wei = reinterpret_cast<const float *>(input_memory(1));
+    auto bia = reinterpret_cast<const float *>(input_memory(2));
+    auto dst = reinterpret_cast<float *>(memory(0));
+
+    const auto &jcp = kernel_->jcp;
+    const int aa = jcp.alpha * jcp.alpha;
+    const size_t wei_chunk_size
+            = (size_t)jcp.ic * jcp.n2_block * jcp.oc_block;
+
+    if (conf_.want_padded_bias()) {
+        for (int oc = 0; oc < jcp.oc_without_padding; ++oc)
+            padded_bias_[oc] = bia[oc];
+        bia = padded_bias_;
+    }
+
+    parallel_nd(jcp.mb, jcp.nb_tile_blocks, [&](int img, int tb) {
+        const int ithr = mkldnn_get_thread_num();
+        float *wino_src = wino_src_ + size_wino_src * ithr;
+        float *wino_dst = wino_dst_ + size_wino_dst * ithr;
+
+        const int tile_start = tb * jcp.tile_block;
+        const int ntiles = nstl::min(jcp.tile_block, jcp.ntiles - tile_start);
+
+        /* transformation of input tensor to winograd domain */
+        src_transform(src, wino_src, img, tile_start, ntiles);
+
+        /* gemms */
+        auto gemm_p = jit_avx2_fp32_wino_conv_fwd_ker_t::call_params_t();
+        gemm_p.m_groups = div_up(ntiles, jcp.m_unroll);
+        for (int u = 0; u < aa; u++) {
+            for (int occ = 0; occ < jcp.n_chunks; occ++) {
+                const int wei_chunk = jcp.m == 2
+                        ? u * jcp.n_chunks + occ
+                        : occ * aa + u;
+                gemm_p.src = wino_src + u * jcp.tile_block * jcp.ic;
+                gemm_p.wei = wei + wei_chunk * wei_chunk_size;
+                gemm_p.dst = wino_dst + u * jcp.tile_block * jcp.oc
+                        + occ * jcp.n2_block * jcp.oc_block;
+                kernel_->ker_(&gemm_p);
+            }
+        }
+
+        /* transformation from winograd domain to output tensor */
+        dst_transform(wino_dst, dst, bia, img, tile_start, ntiles);
+    });
+}
+
+template struct _jit_avx2_fp32_wino_conv_fwd_t<true>;
+template struct _jit_avx2_fp32_wino_conv_fwd_t<false>;
+
+}
+}
+}
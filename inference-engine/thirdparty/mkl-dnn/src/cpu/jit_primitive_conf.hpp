@@ -190,6 +190,34 @@ struct jit_conv_conf_2x3_wino_t {
     int k2_block, k_chunks;
 };
 
+struct jit_conv_conf_avx2_wino_t {
+    int m;
+    int r;
+    int alpha;
+
+    int mb;
+    int ic, oc, oc_without_padding;
+    int ih, iw, oh, ow;
+    int l_pad, t_pad;
+    int kh, kw;
+    int stride_h, stride_w;
+    int dilate_h, dilate_w;
+
+    int nb_ic, ic_block;
+    int nb_oc, oc_block;
+
+    int tile_h, tile_w, ntiles;
+    int tile_block, nb_tile_blocks;
+    int m_unroll, n2_block, n_chunks;
+    int wei_ic_stride, wei_ob_stride;
+    mkldnn_wino_memory_format_t wino_format;
+
+    bool with_bias, with_sum;
+    bool with_relu, with_relu_postsum;
+    float relu_negative_slope, relu_postsum_negative_slope;
+    float sum_scale;
+};
+
 /*
    Winograd sched policy:
 
@@ -578,7 +606,15 @@ struct jit_softmax_conf_t {
     size_t inner_size;
     size_t ur_channel;
     size_t ur_inner;
-    size_t outer_block;
+
+    /* rows: softmax over the last dim or over the channel blocks of nChw8c/16c */
+    bool blocked;
+    size_t blk_vecs;      // vectors in one block of channels
+    size_t row_blocks;    // blocks of channels in one row
+    size_t ur_blocks;     // blocks processed by one unrolled step
+    size_t block_stride;  // bytes between the blocks of a row
+    size_t row_stride;    // bytes between the rows
+    size_t tail;          // channels left after the vectors of a dense row
 };
 
 struct jit_softmax_call_s {
@@ -59,7 +59,7 @@ void jit_uni_softmax_fwd_t<isa>::execute_forward()
 
     size_t dim = jpp.channels * jpp.inner_size;
 
-    if (jpp.inner_size > 1) {
+    if (jpp.inner_size > 1 && !jpp.blocked) {
         auto ker = [&](const int ithr, const int nthr) {
             size_t start{0}, end{0};
 
@@ -84,34 +84,48 @@ void jit_uni_softmax_fwd_t<isa>::execute_forward()
         };
 
         parallel(0, ker);
-    } else {
+    } else if (jpp.blocked) {
+        // Rows are the spatial points, the ones of one sample are contiguous
+        const size_t blk_size = data_d.blocking_desc().block_dims[1];
+        const size_t rows = outer_size * jpp.inner_size;
+
         auto ker = [&](const int ithr, const int nthr) {
             size_t start{0}, end{0};
+            balance211(rows, nthr, ithr, start, end);
 
-            int ou_blocks = div_up(outer_size, jpp.outer_block);
-
-            const size_t work_amount = ou_blocks;
-            balance211(work_amount, nthr, ithr, start, end);
-
-            size_t oub{0};
-            nd_iterator_init(start, oub, ou_blocks);
-
-            for (size_t iwork = start; iwork < end; ++iwork) {
-                size_t work = nstl::min(jpp.outer_block, outer_size - oub * jpp.outer_block);
+            while (start < end) {
+                size_t ou = start / jpp.inner_size;
+                size_t in = start % jpp.inner_size;
+                size_t work = nstl::min(end - start, jpp.inner_size - in);
 
                 jit_softmax_call_s args{};
-                args.channels = jpp.channels;
                 args.work = work;
-                size_t off = data_d.off_l(oub * jpp.outer_block * dim);
+                size_t off = data_d.blk_off(ou) + in * blk_size;
                 args.src = src + off;
                 args.dst = dst + off;
 
                 (*kernel_)(&args);
 
-                nd_iterator_step(oub, ou_blocks);
+                start += work;
             }
         };
 
+        parallel(0, ker);
+    } else {
+        auto ker = [&](const int ithr, const int nthr) {
+            size_t start{0}, end{0};
+            balance211(outer_size, nthr, ithr, start, end);
+            if (start >= end) return;
+
+            jit_softmax_call_s args{};
+            args.work = end - start;
+            size_t off = data_d.off_l(start * dim);
+            args.src = src + off;
+            args.dst = dst + off;
+
+            (*kernel_)(&args);
+        };
+
         parallel(0, ker);
     }
 }
@@ -48,24 +48,15 @@ struct jit_uni_softmax_fwd_t : public cpu_primitive_t {
         virtual status_t init() override {
             using namespace prop_kind;
 
-            auto desired_fmt = memory_format::nchw;
-
             assert(engine()->kind() == engine_kind::cpu);
 
-            auto ndims = desc_.data_desc.ndims;
-            auto dims = desc_.data_desc.dims;
-            auto axis = desc_.softmax_axis;
-
-            size_t inner_size = utils::array_product(dims + axis + 1, ndims - axis - 1);
-
+            // The layouts along the axis are checked by the kernel
             bool ok = mayiuse(isa)
                       && utils::one_of(desc()->prop_kind, forward_training,
                                        forward_inference)
                       && utils::everyone_is(data_type::f32, desc()->data_desc.data_type)
                       && memory_desc_wrapper(src_pd()).is_dense(true)
-                      && utils::everyone_is(desired_fmt, src_pd()->desc()->format,
-                                            dst_pd()->desc()->format)
-                      && inner_size > 1;
+                      && memory_desc_wrapper(src_pd()) == memory_desc_wrapper(dst_pd());
 
             if (!ok) return status::unimplemented;
 
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <climits>
+
 #include "mkldnn_types.h"
 #include "mkldnn_thread.hpp"
 #include "nstl.hpp"
@@ -37,14 +39,27 @@ status_t jit_uni_softmax_kernel_f32<isa>::init_conf(jit_softmax_conf_t &jpp,
     auto dims = pd.data_desc.dims;
     auto axis = pd.softmax_axis;
 
+    const auto &blk = src_d.blocking_desc();
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    // The dims from the axis onward are either stored in the logical order or
+    // the axis is the channel dim of a channel blocked format
     bool is_plain = true;
-    for (int i = axis; i < ndims; i++) {
-        if (src_d.blocking_desc().block_dims[i] != 1) {
+    ptrdiff_t plain_stride = 1;
+    for (int i = ndims - 1; i >= axis; i--) {
+        if (blk.block_dims[i] != 1 || blk.strides[0][i] != plain_stride) {
             is_plain = false;
         }
+        plain_stride *= dims[i];
     }
 
-    if (!is_plain) {
+    jpp.blocked = !is_plain && axis == 1
+            && utils::one_of(src_d.format(), memory_format::nChw8c, memory_format::nChw16c,
+                             memory_format::nCdhw8c, memory_format::nCdhw16c)
+            && blk.padding_dims[1] == dims[1]
+            && blk.block_dims[1] % simd_w == 0;
+
+    if (!is_plain && !jpp.blocked) {
         return status::unimplemented;
     }
 
@@ -53,6 +68,7 @@ status_t jit_uni_softmax_kernel_f32<isa>::init_conf(jit_softmax_conf_t &jpp,
     size_t regs_for_one_unroll = 2;
     size_t max_inner_unroll = (nregs - aux_simd_registers) / regs_for_one_unroll;
     size_t max_channels_unroll = 4;
+    size_t max_row_vecs_unroll = 4;
 
     jpp.outer_size = utils::array_product(dims, axis);
     jpp.channels = dims[axis];
@@ -64,18 +80,28 @@ status_t jit_uni_softmax_kernel_f32<isa>::init_conf(jit_softmax_conf_t &jpp,
 
     jpp.ur_inner = max_inner_unroll;
     jpp.ur_channel = nstl::min(max_channels_unroll, jpp.channels);
-    jpp.outer_block = 2 * cpu_isa_traits<isa>::vlen / sizeof(float);
 
-    if (jpp.inner_size == 1) {
-        // limit max jit code size for dense case
-        if (jpp.channels > 128) {
-            return status::unimplemented;
-        }
+    if (jpp.blocked) {
+        // A row is one spatial point, its channels are spread over the blocks
+        size_t blk_size = blk.block_dims[1];
+        jpp.blk_vecs = blk_size / simd_w;
+        jpp.row_blocks = jpp.channels / blk_size;
+        jpp.block_stride = jpp.inner_size * blk_size * sizeof(float);
+        jpp.row_stride = blk_size * sizeof(float);
+        jpp.tail = 0;
+    } else {
+        // A dense row of channels, the vector loop is followed by scalar tail
+        jpp.blk_vecs = 1;
+        jpp.row_blocks = jpp.channels / simd_w;
+        jpp.block_stride = cpu_isa_traits<isa>::vlen;
+        jpp.row_stride = jpp.channels * sizeof(float);
+        jpp.tail = jpp.channels % simd_w;
+    }
+    jpp.ur_blocks = nstl::max((size_t)1, max_row_vecs_unroll / jpp.blk_vecs);
 
-        // ref implementation is faster for small work amount
-        if (jpp.channels * jpp.outer_size < 16) {
-            return status::unimplemented;
-        }
+    // Displacements of the unrolled step are encoded as 32 bit immediates
+    if (jpp.ur_blocks * jpp.block_stride > INT_MAX) {
+        return status::unimplemented;
     }
 
     return status::success;
@@ -487,52 +513,6 @@ void jit_uni_softmax_kernel_f32<isa>::scalar_loop_div() {
     L(loop_channel_end);
 }
 
-template <cpu_isa_t isa>
-void jit_uni_softmax_kernel_f32<isa>::dense_loop(int ou_block) {
-    for (int ou = 0; ou < ou_block; ou++) {
-        movups(xmm_max, xmm_float_min);
-        for (int ch = 0; ch < (int)jpp.channels; ch++) {
-            maxss(xmm_max, ptr[reg_src_base_ptr + (ou * jpp.channels + ch) * sizeof(float)]);
-        }
-
-        for (int ch = 0; ch < (int)jpp.channels; ch++) {
-            movss(xmm_src, ptr[reg_src_base_ptr + (ou * jpp.channels + ch) * sizeof(float)]);
-            subss(xmm_src, xmm_max);
-            movss(ptr[reg_dst_base_ptr + (ou * jpp.channels + ch) * sizeof(float)], xmm_src);
-        }
-    }
-
-    int full_work = ou_block * (int)jpp.channels;
-    int i = 0;
-    for (; i <= full_work - simd_w; i += simd_w) {
-        uni_vmovups(vreg_src(0), ptr[reg_dst_base_ptr + i * sizeof(float)]);
-        simd_expf(vreg_src(0));
-        uni_vmovups(ptr[reg_dst_base_ptr + i * sizeof(float)], vreg_src(0));
-    }
-
-    for (; i < full_work; i++) {
-        movss(xmm_src, ptr[reg_dst_base_ptr + i * sizeof(float)]);
-        scalar_expf(xmm_src);
-        movss(ptr[reg_dst_base_ptr + i * sizeof(float)], xmm_src);
-    }
-
-    for (int ou = 0; ou < ou_block; ou++) {
-        pxor(xmm_denom, xmm_denom);
-        for (int ch = 0; ch < (int)jpp.channels; ch++) {
-            addss(xmm_denom, ptr[reg_dst_base_ptr + (ou * jpp.channels + ch) * sizeof(float)]);
-        }
-
-        movss(xmm_one, ptr[imm_addr64 + 0 * vlen]);
-        divss(xmm_one, xmm_denom);
-        movss(xmm_denom, xmm_one);
-        for (int ch = 0; ch < (int)jpp.channels; ch++) {
-            movss(xmm_src, ptr[reg_dst_base_ptr + (ou * jpp.channels + ch) * sizeof(float)]);
-            mulss(xmm_src, xmm_denom);
-            movss(ptr[reg_dst_base_ptr + (ou * jpp.channels + ch) * sizeof(float)], xmm_src);
-        }
-    }
-}
-
 template <cpu_isa_t isa>
 void jit_uni_softmax_kernel_f32<isa>::generate() {
     this->preamble();
@@ -602,53 +582,208 @@ void jit_uni_softmax_kernel_f32<isa>::generate() {
 }
 
 template <cpu_isa_t isa>
-void jit_uni_softmax_kernel_f32<isa>::generate_dense() {
-    this->preamble();
+void jit_uni_softmax_kernel_f32<isa>::reduce_lanes(const Vmm &vmm, bool is_max) {
+    auto op = [&](const Vmm &vmm_src) {
+        if (is_max)
+            uni_vmaxps(vmm, vmm, vmm_src);
+        else
+            uni_vaddps(vmm, vmm, vmm_src);
+    };
 
-    mov(reg_src_base_ptr, ptr[abi_param1 + GET_OFF(src)]);
-    mov(reg_dst_base_ptr, ptr[abi_param1 + GET_OFF(dst)]);
-    mov(reg_work_amount, ptr[abi_param1 + GET_OFF(work)]);
+    // Leaves the result in all the lanes
+    if (isa == avx512_common) {
+        vshuff32x4(Zmm(vmm_aux0.getIdx()), Zmm(vmm.getIdx()), Zmm(vmm.getIdx()), 0x4E);
+        op(vmm_aux0);
+        vshuff32x4(Zmm(vmm_aux0.getIdx()), Zmm(vmm.getIdx()), Zmm(vmm.getIdx()), 0xB1);
+        op(vmm_aux0);
+    } else if (isa == avx2) {
+        vperm2f128(Ymm(vmm_aux0.getIdx()), Ymm(vmm.getIdx()), Ymm(vmm.getIdx()), 0x01);
+        op(vmm_aux0);
+    }
 
-    mov(reg_min, float2int(-FLT_MAX));
-    movq(xmm_float_min, reg_min);
+    for (unsigned char imm : {0x4E, 0xB1}) {
+        if (isa == sse42) {
+            movups(xmm_aux0, Xmm(vmm.getIdx()));
+            shufps(xmm_aux0, xmm_aux0, imm);
+        } else {
+            vshufps(vmm_aux0, vmm, vmm, imm);
+        }
+        op(vmm_aux0);
+    }
+}
 
-    mov(imm_addr64, jit_uni_softmax_kernel_f32<isa>::l_table);
-    uni_vmovups(vmm_one, ptr[imm_addr64 + 0 * vlen]);
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::load_scalar(const Vmm &vmm, const Address &addr) {
+    if (isa == sse42)
+        movss(Xmm(vmm.getIdx()), addr);
+    else
+        vmovss(Xmm(vmm.getIdx()), addr);
+}
 
-    int outer_tail = jpp.outer_size % jpp.outer_block;
-    Label ou_loop_tail_label;
-    Label ou_loop_tail_1_label;
-    Label ou_loop_exit_label;
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::store_scalar(const Address &addr, const Vmm &vmm) {
+    if (isa == sse42)
+        movss(addr, Xmm(vmm.getIdx()));
+    else
+        vmovss(addr, Xmm(vmm.getIdx()));
+}
 
-    cmp(reg_work_amount, jpp.outer_block);
-    jne(ou_loop_tail_label, T_NEAR);
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::rows_step_max(int ur_blocks) {
+    int nvecs = ur_blocks * (int)jpp.blk_vecs;
 
-    dense_loop(jpp.outer_block);
+    for (int i = 0; i < nvecs; ++i) {
+        uni_vmovups(vreg_row(i), ptr[reg_src_ptr + row_vec_off(i)]);
+        uni_vmaxps(vmm_max, vmm_max, vreg_row(i));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::rows_step_exp(int ur_blocks) {
+    int nvecs = ur_blocks * (int)jpp.blk_vecs;
+
+    for (int i = 0; i < nvecs; ++i) {
+        uni_vmovups(vreg_row(i), ptr[reg_src_ptr + row_vec_off(i)]);
+        uni_vsubps(vreg_row(i), vreg_row(i), vmm_max);
+        simd_expf(vreg_row(i));
+        uni_vaddps(vmm_denom, vmm_denom, vreg_row(i));
+        uni_vmovups(ptr[reg_dst_ptr + row_vec_off(i)], vreg_row(i));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::rows_step_div(int ur_blocks) {
+    int nvecs = ur_blocks * (int)jpp.blk_vecs;
+
+    for (int i = 0; i < nvecs; ++i) {
+        uni_vmovups(vreg_row(i), ptr[reg_dst_ptr + row_vec_off(i)]);
+        uni_vmulps(vreg_row(i), vreg_row(i), vmm_denom);
+        uni_vmovups(ptr[reg_dst_ptr + row_vec_off(i)], vreg_row(i));
+    }
+}
 
-    jmp(ou_loop_exit_label, T_NEAR);
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::rows_loop(rows_pass_t pass) {
+    Label loop_blocks_unroll;
+    Label loop_blocks;
+    Label loop_blocks_end;
+
+    auto step = [&](int ur_blocks) {
+        switch (pass) {
+            case rows_max: rows_step_max(ur_blocks); break;
+            case rows_exp: rows_step_exp(ur_blocks); break;
+            case rows_div: rows_step_div(ur_blocks); break;
+        }
+    };
 
-    L(ou_loop_tail_label);
-    cmp(reg_work_amount, outer_tail);
-    jne(ou_loop_tail_1_label, T_NEAR);
+    mov(reg_src_ptr, reg_src_base_ptr);
+    mov(reg_dst_ptr, reg_dst_base_ptr);
+    mov(reg_ch_work, jpp.row_blocks);
 
-    dense_loop(outer_tail);
+    if (jpp.ur_blocks > 1) {
+        L(loop_blocks_unroll); {
+            cmp(reg_ch_work, jpp.ur_blocks);
+            jl(loop_blocks, T_NEAR);
 
-    jmp(ou_loop_exit_label, T_NEAR);
+            step(jpp.ur_blocks);
 
-    L(ou_loop_tail_1_label); {
-        cmp(reg_work_amount, 1);
-        jl(ou_loop_exit_label, T_NEAR);
+            add(reg_src_ptr, jpp.ur_blocks * jpp.block_stride);
+            add(reg_dst_ptr, jpp.ur_blocks * jpp.block_stride);
+            sub(reg_ch_work, jpp.ur_blocks);
+            jmp(loop_blocks_unroll, T_NEAR);
+        }
+    }
 
-        dense_loop(1);
+    L(loop_blocks); {
+        cmp(reg_ch_work, 0);
+        jle(loop_blocks_end, T_NEAR);
 
-        add(reg_src_base_ptr, sizeof(float)*jpp.channels);
-        add(reg_dst_base_ptr, sizeof(float)*jpp.channels);
-        dec(reg_work_amount);
+        step(1);
+
+        add(reg_src_ptr, jpp.block_stride);
+        add(reg_dst_ptr, jpp.block_stride);
+        dec(reg_ch_work);
+        jmp(loop_blocks, T_NEAR);
+    }
+
+    L(loop_blocks_end);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_softmax_kernel_f32<isa>::generate_rows() {
+    this->preamble();
+
+    mov(reg_src_base_ptr, ptr[abi_param1 + GET_OFF(src)]);
+    mov(reg_dst_base_ptr, ptr[abi_param1 + GET_OFF(dst)]);
+    mov(reg_work_amount, ptr[abi_param1 + GET_OFF(work)]);
+
+    mov(reg_min, float2int(-FLT_MAX));
+    movq(xmm_float_min, reg_min);
+
+    mov(imm_addr64, jit_uni_softmax_kernel_f32<isa>::l_table);
+    uni_vmovups(vmm_one, ptr[imm_addr64 + 0 * vlen]);
 
-        jmp(ou_loop_tail_1_label, T_NEAR);
+    Label loop_rows;
+    Label loop_rows_end;
+
+    // Channels of a dense row that do not fill a vector follow the vectors.
+    // They go through the vector instructions in the low lane: mixing the
+    // legacy scalar encoding with the wide registers stalls on each row.
+    auto tail_loop = [&](rows_pass_t pass) {
+        for (int t = 0; t < (int)jpp.tail; ++t) {
+            auto src_addr = ptr[reg_src_ptr + t * sizeof(float)];
+            auto dst_addr = ptr[reg_dst_ptr + t * sizeof(float)];
+            switch (pass) {
+                case rows_max:
+                    load_scalar(vreg_row(0), src_addr);
+                    uni_vmaxps(vmm_max, vmm_max, vreg_row(0));
+                    break;
+                case rows_exp:
+                    load_scalar(vreg_row(0), src_addr);
+                    uni_vsubps(vreg_row(0), vreg_row(0), vmm_max);
+                    simd_expf(vreg_row(0));
+                    uni_vaddps(vmm_denom, vmm_denom, vreg_row(0));
+                    store_scalar(dst_addr, vreg_row(0));
+                    break;
+                case rows_div:
+                    load_scalar(vreg_row(0), dst_addr);
+                    uni_vmulps(vreg_row(0), vreg_row(0), vmm_denom);
+                    store_scalar(dst_addr, vreg_row(0));
+                    break;
+            }
+        }
+    };
+
+    L(loop_rows); {
+        cmp(reg_work_amount, 0);
+        jle(loop_rows_end, T_NEAR);
+
+        // The lanes are reduced after each pass and the low lane,
+        // updated by the tail, is broadcast for the next pass
+        uni_vbroadcastss(vmm_max, xmm_float_min);
+        rows_loop(rows_max);
+        reduce_lanes(vmm_max, true);
+        tail_loop(rows_max);
+        uni_vbroadcastss(vmm_max, xmm_max);
+
+        uni_vpxor(vmm_denom, vmm_denom, vmm_denom);
+        rows_loop(rows_exp);
+        reduce_lanes(vmm_denom, false);
+        tail_loop(rows_exp);
+
+        uni_vmovups(vmm_aux1, vmm_one);
+        uni_vdivps(vmm_aux1, vmm_aux1, vmm_denom);
+        uni_vbroadcastss(vmm_denom, xmm_aux1);
+        rows_loop(rows_div);
+        tail_loop(rows_div);
+
+        add(reg_src_base_ptr, jpp.row_stride);
+        add(reg_dst_base_ptr, jpp.row_stride);
+        dec(reg_work_amount);
+        jmp(loop_rows, T_NEAR);
     }
 
-    L(ou_loop_exit_label);
+    L(loop_rows_end);
 
     this->postamble();
 
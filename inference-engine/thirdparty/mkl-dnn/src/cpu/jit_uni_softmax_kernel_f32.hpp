@@ -38,10 +38,10 @@ struct jit_uni_softmax_kernel_f32 : public jit_generator {
             isa == avx2, Ymm, Zmm>::type;
 
     jit_uni_softmax_kernel_f32(jit_softmax_conf_t ajpp) : jpp(ajpp) {
-        if (jpp.inner_size > 1)
+        if (jpp.inner_size > 1 && !jpp.blocked)
             this->generate();
         else
-            this->generate_dense();
+            this->generate_rows();
 
         jit_ker = (decltype(jit_ker))this->getCode();
     }
@@ -67,8 +67,15 @@ struct jit_uni_softmax_kernel_f32 : public jit_generator {
     void scalar_loop_exp();
     void scalar_loop_div();
 
-    void dense_loop(int ou_block);
-    void generate_dense();
+    void load_scalar(const Vmm &vmm, const Address &addr);
+    void store_scalar(const Address &addr, const Vmm &vmm);
+    void reduce_lanes(const Vmm &vmm, bool is_max);
+    enum rows_pass_t { rows_max, rows_exp, rows_div };
+    void rows_step_max(int ur_blocks);
+    void rows_step_exp(int ur_blocks);
+    void rows_step_div(int ur_blocks);
+    void rows_loop(rows_pass_t pass);
+    void generate_rows();
 private:
     void (*jit_ker)(jit_softmax_call_s *);
 
@@ -100,6 +107,9 @@ private:
     Xmm xmm_denom           = Xmm(6);
     Xmm xmm_src             = Xmm(7);
 
+    Vmm vmm_max             = Vmm(5);
+    Vmm vmm_denom           = Vmm(6);
+
     Opmask k_mask_tmp       = Opmask(2);
 
     unsigned char _cmp_gt_os = isa == avx512_common ? 14 : 6;
@@ -111,6 +121,10 @@ private:
     auto vreg_max(int ur_inner) -> Vmm;
     auto vreg_denom(int ur_inner) -> Vmm;
     auto vreg_src(int ur_inner) -> Vmm;
+    auto vreg_row(int i) -> Vmm { return Vmm(9 + i); }
+    size_t row_vec_off(int i) {
+        return (i / jpp.blk_vecs) * jpp.block_stride + (i % jpp.blk_vecs) * vlen;
+    }
 
     Label loop_simd_unroll;
     Label loop_simd;
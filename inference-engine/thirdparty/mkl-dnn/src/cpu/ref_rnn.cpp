@@ -202,15 +202,8 @@ gemm_sig(_ref_rnn_common_t<aprop>::packed_gemm) {
             is_B_trans ? CblasTrans : CblasNoTrans, m, n, k, a_, strideA_m, b_,
             is_B_trans ? strideB_n : strideB_k, beta, c_, strideC_m);
 #else
-    UNUSED(m);
-    UNUSED(n);
-    UNUSED(k);
-    UNUSED(a_);
-    UNUSED(b_);
-    UNUSED(c_);
-    UNUSED(is_B_trans);
-    UNUSED(beta);
-    assert(!"packed gemm is disabled");
+    sgemm_compute(is_B_trans ? "T" : "N", m, n, k, a_, b_,
+            is_B_trans ? strideB_n : strideB_k, beta, c_, strideC_m);
 #endif
 }
 
@@ -865,52 +858,50 @@ void _ref_rnn_common_t<prop_kind::backward>::copy_res_iter(int n_layer,
 
 template <prop_kind_t aprop>
 packing_sig(_ref_rnn_common_t<aprop>::pack_weights) {
-#if (USE_MKL_PACKED_GEMM)
     AOC<const float, 5> w(
             w_, n_layer, n_direction, IC_size, n_gates, OC_size);
     AOC<float *, 3> weights(weights_, n_layer, n_direction, n_parts);
     int m = 0, n = 0, k = 0;
+#if (USE_MKL_PACKED_GEMM)
     auto transA = CblasNoTrans;
+#endif
     bool is_fwd = aprop == prop_kind::forward;
     if (is_fwd) {
         m = n_gates * OC_size;
         n = batch;
         k = IC_size;
         //todo: do a transposition if ldgoi
-        transA = CblasNoTrans;
     } else {
         m = IC_size;
         n = batch;
         k = n_gates * OC_size;
         //TODO: do a transposition if ldigo
-        transA = CblasNoTrans;
     }
+    UNUSED(n);
+    UNUSED(do_copy);
+#if !(USE_MKL_PACKED_GEMM)
+    // the jit packed weights go to the storage owned by the primitive
+    char *packed = (char *)scratch_mem;
+#endif
     for (int i = 0; i < n_layer; i++) {
         for (int d = 0; d < n_direction; d++) {
             for (int p = 0; p < n_parts; p++) {
                 int m_p = is_fwd ? (gates_per_part[p] * OC_size) : m;
                 int k_p = is_fwd ? k : (gates_per_part[p] * OC_size);
                 int g = (p > 0) ? gates_per_part[p - 1] : 0;
+#if (USE_MKL_PACKED_GEMM)
                 weights(i, d, p) = cblas_sgemm_alloc(CblasAMatrix, m_p, n, k_p);
                 cblas_sgemm_pack(CblasColMajor, CblasAMatrix, transA, m_p, n,
                         k_p, 1.0f, &(w(i, d, 0, g, 0)), m, weights(i, d, p));
+#else
+                weights(i, d, p) = (float *)packed;
+                sgemm_pack("N", m_p, k_p, &(w(i, d, 0, g, 0)), m,
+                        weights(i, d, p));
+                packed += sgemm_pack_get_size(m_p, k_p);
+#endif
             }
         }
     }
-#else
-    UNUSED(n_layer);
-    UNUSED(n_direction);
-    UNUSED(n_weights);
-    UNUSED(n_gates);
-    UNUSED(n_parts);
-    UNUSED(gates_per_part);
-    UNUSED(batch);
-    UNUSED(OC_size);
-    UNUSED(IC_size);
-    UNUSED(weights_);
-    UNUSED(w_);
-    assert(!"packed gemm is disabled");
-#endif
 }
 
 template <prop_kind_t aprop>
@@ -981,11 +972,11 @@ free_packed_sig(_ref_rnn_common_t<aprop>::free_packed_weights) {
             for (int k = 0; k < n_parts; k++)
                 cblas_sgemm_free(weights(i, j, k));
 #else
+    // the jit packed weights are kept by the primitive for the next execution
     UNUSED(n_layer);
     UNUSED(n_direction);
     UNUSED(n_parts);
     UNUSED(weights_);
-    assert(!"packed gemm is disabled");
 #endif
 }
 
@@ -1113,14 +1104,30 @@ void _ref_rnn_common_t<aprop>::execute_() {
     bool is_lr = !one_of(exec_dir, b2t_r2l, t2b_r2l);
     bool is_rl = !one_of(exec_dir, b2t_l2r, t2b_l2r);
     // we pack the weights if we are using the packed API
-    (this->*weights_state_pack_func)(n_layer, n_direction, n_weights_state,
-            n_gates, batch, dic, sic, ptr_wei_state_, n_parts_wei_st,
-            (is_orig_gru ? parts_wei_st_gru : &parts_wei_st), w_state,
-            ws_weights_iter_, copy_weights_iter_);
-    (this->*weights_input_pack_func)(n_layer, n_direction, n_weights_input,
-            n_gates, batch, dic, slc, ptr_wei_input_, n_parts_wei_i,
-            &parts_wei_i, w_input,
-            ws_weights_layer_, copy_weights_layer_);
+    const bool keep_packed
+            = conf_.desc()->prop_kind == prop_kind::forward_inference;
+    if (!packed_weights_iter_ || !keep_packed
+            || packed_from_weights_iter_ != w_state) {
+        (this->*weights_state_pack_func)(n_layer, n_direction,
+                n_weights_state, n_gates, batch, dic, sic, ptr_wei_state_,
+                n_parts_wei_st,
+                (is_orig_gru ? parts_wei_st_gru : &parts_wei_st), w_state,
+                packed_weights_iter_ ? packed_weights_iter_ : ws_weights_iter_,
+                copy_weights_iter_);
+        if (packed_weights_iter_)
+            packed_from_weights_iter_ = w_state;
+    }
+    if (!packed_weights_layer_ || !keep_packed
+            || packed_from_weights_layer_ != w_input) {
+        (this->*weights_input_pack_func)(n_layer, n_direction,
+                n_weights_input, n_gates, batch, dic, slc, ptr_wei_input_,
+                n_parts_wei_i, &parts_wei_i, w_input,
+                packed_weights_layer_ ? packed_weights_layer_
+                                      : ws_weights_layer_,
+                copy_weights_layer_);
+        if (packed_weights_layer_)
+            packed_from_weights_layer_ = w_input;
+    }
 
     // we first need to copy the initial states and input into ws
     copy_init_layer(is_lr, is_rl, n_layer, n_direction, n_iter, batch, slc, dic,
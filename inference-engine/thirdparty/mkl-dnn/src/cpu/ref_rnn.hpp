@@ -27,6 +27,7 @@
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
+#include "gemm/gemm.hpp"
 #include "gemm/os_blas.hpp"
 
 namespace mkldnn {
@@ -212,12 +213,20 @@ struct _ref_rnn_common_t : public cpu_primitive_t {
             f = pack_w ? &class_name::free_packed_weights :
                              &class_name::free_no_packed_weights;
         };
-#ifdef USE_MKL_PACKED_GEMM
+#if USE_MKL_PACKED_GEMM
         const bool weights_pack_cond =
             (conf_.T() > 1) && (conf_.MB() == 32) &&
             (conf_.SIC() == 512) &&(conf_.SLC() == 512) && (conf_.DIC() == 512);
+        const bool weights_input_pack_cond = weights_pack_cond;
 #else
-        const bool weights_pack_cond = false;
+        /* the jit sgemm would re-pack the weights for every timestep, so
+         * they are packed once and reused by all of them.
+         * The merged layer gemm runs once per layer, nothing to reuse. */
+        const bool weights_pack_cond = (aprop == prop_kind::forward)
+            && (conf_.T() > 1) && (conf_.MB() <= max_packed_gemm_mb)
+            && !mayiuse(avx512_mic) && sgemm_pack_is_applicable();
+        const bool weights_input_pack_cond = weights_pack_cond
+            && !merge_gemm_layer;
 #endif
 
         const bool is_weights_state_packed = conf_.desc()->weights_iter_desc.format == packed_format;
@@ -226,8 +235,8 @@ struct _ref_rnn_common_t : public cpu_primitive_t {
                 weights_state_pack_func, weights_state_free_packed_func);
 
         const bool is_weights_input_packed = conf_.desc()->weights_layer_desc.format == packed_format;
-        set_pack_funcs(weights_pack_cond || is_weights_input_packed,
-                gemm_input_func, weights_pack_cond && !is_weights_input_packed,
+        set_pack_funcs(weights_input_pack_cond || is_weights_input_packed,
+                gemm_input_func, weights_input_pack_cond && !is_weights_input_packed,
                 weights_input_pack_func, weights_input_free_packed_func);
 
         switch (conf_.cell_kind()) {
@@ -327,11 +336,39 @@ struct _ref_rnn_common_t : public cpu_primitive_t {
         int ptr_wei_sz = conf_.L() * conf_.D() * max_nparts;
         ptr_wei_input_ = (float **)malloc(sizeof(float *) * ptr_wei_sz, 64);
         ptr_wei_state_ = (float **)malloc(sizeof(float *) * ptr_wei_sz, 64);
+
+        packed_weights_layer_ = nullptr;
+        packed_weights_iter_ = nullptr;
+        packed_from_weights_layer_ = nullptr;
+        packed_from_weights_iter_ = nullptr;
+#if !USE_MKL_PACKED_GEMM
+        /* storage of the jit-packed weights, the parts of the original gru
+         * state weights are packed separately */
+        auto packed_size = [&](int n_parts, const int *gates_per_part,
+                int IC_size) {
+            size_t size = 0;
+            for (int p = 0; p < n_parts; p++)
+                size += sgemm_pack_get_size(gates_per_part[p] * conf_.DIC(),
+                        IC_size);
+            return size * conf_.L() * conf_.D();
+        };
+        const int all_gates = conf_.G(), gru_gates[2] = { 2, 1 };
+        if (weights_state_pack_func == &class_name::pack_weights)
+            packed_weights_iter_ = (float *)malloc(
+                    conf_.cell_kind() == alg_kind::vanilla_gru
+                    ? packed_size(2, gru_gates, conf_.SIC())
+                    : packed_size(1, &all_gates, conf_.SIC()), 64);
+        if (weights_input_pack_func == &class_name::pack_weights)
+            packed_weights_layer_ = (float *)malloc(
+                    packed_size(1, &all_gates, conf_.SLC()), 64);
+#endif
     }
     ~_ref_rnn_common_t() {
         delete scratchpad_;
         free(ptr_wei_input_);
         free(ptr_wei_state_);
+        free(packed_weights_layer_);
+        free(packed_weights_iter_);
     }
 
     // typedef typename prec_traits::type data_t;
@@ -406,6 +443,18 @@ private:
 
     float **ptr_wei_input_;
     float **ptr_wei_state_;
+    float *packed_weights_layer_;
+    float *packed_weights_iter_;
+    /* the weights memory the jit packed weights were made of. Inference
+     * weights are constant (as in the inference engine), so they are packed
+     * once and packed again only if another memory is passed. The training
+     * updates the weights in place, so it packs them on every execution */
+    const float *packed_from_weights_layer_;
+    const float *packed_from_weights_iter_;
+
+    /* the batch the jit packed gemm is used up to, the regular jit sgemm is
+     * faster on the larger ones */
+    static constexpr int max_packed_gemm_mb = 32;
 
     execution_direction exec_dir;
     grid_execution_f grid_computation;
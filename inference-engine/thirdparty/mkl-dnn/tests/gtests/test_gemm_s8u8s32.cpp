@@ -30,4 +30,50 @@ TEST_P(gemm_test, TestGEMM)
 #define TEST_CASE_NAME_PREFIX s8u8s32
 #define S8U8S32
 #include "gemm_in.h"
+
+/* explicit non-zero offsets in every offsetc mode and transposition, sizes
+ * cross the blocking of the jit gemm and k is not a multiple of 4 */
+TEST(gemm_s8u8s32_offsets, TestGEMM)
+{
+    const int M = 300, N = 70, K = 37;
+    const float alpha = 2.0f, beta = 1.0f;
+    const int8_t ao = -3, bo = 5;
+
+    for (char offsetc : {'F', 'C', 'R'})
+    for (char transA : {'N', 'T'})
+    for (char transB : {'N', 'T'}) {
+        const bool tr_a = transA == 'T', tr_b = transB == 'T';
+        const int lda = (tr_a ? K : M) + 3;
+        const int ldb = (tr_b ? N : K) + 1;
+        const int ldc = M + 2;
+        const size_t sizeA = (size_t)lda * (tr_a ? M : K);
+        const size_t sizeB = (size_t)ldb * (tr_b ? K : N);
+        const size_t sizeC = (size_t)ldc * N;
+        const size_t sizeco = offsetc == 'R' ? N : offsetc == 'C' ? M : 1;
+
+        std::vector<int8_t> A(sizeA);
+        std::vector<uint8_t> B(sizeB);
+        std::vector<int32_t> C(sizeC), C_ref(sizeC), co(sizeco);
+        /* values keep the s16 intermediate sums of avx2 in range */
+        for (size_t i = 0; i < sizeA; i++) A[i] = (int8_t)((i * 7) % 121 - 60);
+        for (size_t i = 0; i < sizeB; i++) B[i] = (uint8_t)((i * 13) % 201);
+        for (size_t i = 0; i < sizeC; i++) C[i] = C_ref[i] = (int32_t)(i % 17) - 8;
+        for (size_t i = 0; i < sizeco; i++) co[i] = (int32_t)(i % 11) - 5;
+
+        auto status = mkldnn_gemm_s8u8s32(&transA, &transB, &offsetc,
+            &M, &N, &K, &alpha, A.data(), &lda, &ao, B.data(), &ldb, &bo,
+            &beta, C.data(), &ldc, co.data());
+        ASSERT_EQ(mkldnn_success, status) << offsetc << transA << transB;
+
+        ref_gemm_s8x8s32<uint8_t>(&transA, &transB, &offsetc, M, N, K, alpha,
+            A.data(), lda, &ao, B.data(), ldb, &bo, beta, C_ref.data(), ldc,
+            co.data());
+
+        for (int j = 0; j < N; j++)
+        for (int i = 0; i < M; i++)
+            ASSERT_EQ(C_ref[j * ldc + i], C[j * ldc + i])
+                << offsetc << transA << transB << " Row: " << i
+                << " Column: " << j;
+    }
+}
 }